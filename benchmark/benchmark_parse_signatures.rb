@@ -0,0 +1,29 @@
+require_relative './utils'
+
+require 'benchmark/ips'
+require 'etc'
+
+buffers = []
+RBS::EnvironmentLoader.new.each_dir do |_, dir|
+  RBS::FileFinder.each_file(dir, skip_hidden: true) do |path|
+    buffers << RBS::Buffer.new(name: path, content: path.read(encoding: "UTF-8"))
+  end
+end
+
+Benchmark.ips do |x|
+  x.time = 10
+
+  x.report("parse_signature") do
+    buffers.each { |buffer| RBS::Parser.parse_signature(buffer) }
+  end
+
+  x.report("parse_signatures (1 thread)") do
+    RBS::Parser.parse_signatures(buffers, threads: 1)
+  end
+
+  x.report("parse_signatures (#{Etc.nprocessors} threads)") do
+    RBS::Parser.parse_signatures(buffers)
+  end
+
+  x.compare!
+end
@@ -0,0 +1,209 @@
+/**
+ * Benchmark of the hash function and the interning of `rbs_constant_pool_t`.
+ *
+ * Lexes the given RBS files, collects the identifier tokens, and reports
+ * the average and maximum probe lengths of a constant pool filled with the
+ * distinct identifiers, and the throughput of hashing and interning all of the
+ * identifiers. The byte-at-a-time djb2 hash, which the pool used before, is
+ * measured as the baseline.
+ *
+ * ```
+ * $ cc -O2 -DNDEBUG -Iinclude -o constant_pool_bench benchmark/constant_pool_bench.c src/[a-z]*.c src/util/[a-z]*.c
+ * $ ./constant_pool_bench $(find core stdlib -name '*.rbs')
+ * ```
+ */
+
+#include "rbs/lexer.h"
+#include "rbs/parser.h"
+#include "rbs/util/rbs_allocator.h"
+#include "rbs/util/rbs_constant_pool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    const uint8_t *start;
+    size_t length;
+    uint32_t hash;
+} identifier_t;
+
+typedef uint32_t (*hash_function_t)(const uint8_t *start, size_t length);
+
+static uint32_t djb2_hash(const uint8_t *start, size_t length) {
+    uint32_t value = 5381;
+
+    for (size_t index = 0; index < length; index++) {
+        value = ((value << 5) + value) + start[index];
+    }
+
+    return value;
+}
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+static char *read_file(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char *content = (char *) malloc((size_t) size + 1);
+    *length = fread(content, 1, (size_t) size, file);
+    content[*length] = '\0';
+    fclose(file);
+
+    return content;
+}
+
+static void collect_identifiers(rbs_allocator_t *allocator, const char *content, size_t length, identifier_t **identifiers, size_t *count, size_t *capacity) {
+    rbs_string_t string = rbs_string_new(content, content + length);
+    rbs_lexer_t *lexer = rbs_lexer_new(allocator, string, RBS_ENCODING_UTF_8_ENTRY, 0, (int) length);
+    if (lexer == NULL) return;
+
+    for (;;) {
+        rbs_token_t token = rbs_lexer_next_token(lexer);
+        if (token.type == pEOF || token.type == ErrorToken) break;
+        if (!RBS_TOKEN_HASHED_P(token.type)) continue;
+
+        if (*count == *capacity) {
+            *capacity = *capacity ? *capacity * 2 : 1024;
+            *identifiers = (identifier_t *) realloc(*identifiers, sizeof(identifier_t) * *capacity);
+        }
+
+        // Copy the identifiers next to each other, so that the benchmark measures the hash instead of cache misses on
+        // the comments between the identifiers. The lexer hashes a token right after reading it.
+        size_t token_length = (size_t) RBS_RANGE_BYTES(token.range);
+        uint8_t *copy = rbs_allocator_alloc_many(allocator, token_length, uint8_t);
+        memcpy(copy, content + token.range.start.byte_pos, token_length);
+
+        (*identifiers)[(*count)++] = (identifier_t) {
+            .start = copy,
+            .length = token_length,
+            .hash = token.hash,
+        };
+    }
+}
+
+// Fills an open addressing table, as `rbs_constant_pool_t` does, with the distinct identifiers, and reports the probe lengths of finding them.
+static void report_probes(const char *name, hash_function_t hash, const identifier_t *identifiers, size_t count) {
+    // The capacity that `rbs_constant_pool_t` grows to for the distinct identifiers.
+    rbs_constant_pool_t pool;
+    rbs_constant_pool_init(&pool, 2);
+    for (size_t i = 0; i < count; i++) {
+        rbs_constant_pool_insert_shared(&pool, identifiers[i].start, identifiers[i].length);
+    }
+    uint32_t capacity = pool.capacity;
+    rbs_constant_pool_free(&pool);
+
+    const identifier_t **table = (const identifier_t **) calloc(capacity, sizeof(identifier_t *));
+    size_t distinct = 0, total_probes = 0, max_probes = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const identifier_t *identifier = &identifiers[i];
+        uint32_t index = hash(identifier->start, identifier->length) & (capacity - 1);
+        size_t probes = 1;
+
+        while (table[index] != NULL) {
+            if (table[index]->length == identifier->length && memcmp(table[index]->start, identifier->start, identifier->length) == 0) break;
+            index = (index + 1) & (capacity - 1);
+            probes++;
+        }
+
+        if (table[index] == NULL) {
+            table[index] = identifier;
+            distinct++;
+            total_probes += probes;
+            if (probes > max_probes) max_probes = probes;
+        }
+    }
+
+    printf("%-12s %zu distinct in %u buckets: %.3f average probes, %zu max probes\n", name, distinct, capacity, (double) total_probes / (double) distinct, max_probes);
+    free(table);
+}
+
+static void report_hash_throughput(const char *name, hash_function_t hash, const identifier_t *identifiers, size_t count) {
+    const int rounds = 50;
+    uint32_t sink = 0;
+
+    double start = now();
+    for (int round = 0; round < rounds; round++) {
+        for (size_t i = 0; i < count; i++) {
+            sink += hash(identifiers[i].start, identifiers[i].length);
+        }
+    }
+    double elapsed = now() - start;
+
+    printf("%-12s hash:   %6.2f ns/identifier (%u)\n", name, elapsed * 1e9 / (double) (count * rounds), sink & 1);
+}
+
+static void report_intern_throughput(const identifier_t *identifiers, size_t count, bool with_hash) {
+    const int rounds = 20;
+    uint32_t sink = 0;
+
+    double start = now();
+    for (int round = 0; round < rounds; round++) {
+        rbs_constant_pool_t pool;
+        rbs_constant_pool_init(&pool, 2);
+
+        for (size_t i = 0; i < count; i++) {
+            if (with_hash) {
+                sink += rbs_constant_pool_insert_shared_with_hash(&pool, identifiers[i].start, identifiers[i].length, identifiers[i].hash);
+            } else {
+                sink += rbs_constant_pool_insert_shared(&pool, identifiers[i].start, identifiers[i].length);
+            }
+        }
+
+        rbs_constant_pool_free(&pool);
+    }
+    double elapsed = now() - start;
+
+    printf("%-12s intern: %6.2f ns/identifier (%u)\n", with_hash ? "with_hash" : "shared", elapsed * 1e9 / (double) (count * rounds), sink & 1);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s FILE.rbs...\n", argv[0]);
+        return 1;
+    }
+
+    rbs_allocator_t *allocator = rbs_allocator_init();
+    identifier_t *identifiers = NULL;
+    size_t count = 0, capacity = 0;
+
+    for (int i = 1; i < argc; i++) {
+        size_t length;
+        char *content = read_file(argv[i], &length);
+        if (content == NULL) {
+            fprintf(stderr, "cannot read %s\n", argv[i]);
+            return 1;
+        }
+
+        collect_identifiers(allocator, content, length, &identifiers, &count, &capacity);
+        free(content);
+    }
+
+    printf("%zu identifiers in %d files\n\n", count, argc - 1);
+
+    report_probes("djb2", djb2_hash, identifiers, count);
+    report_probes("constant", rbs_constant_pool_hash, identifiers, count);
+    printf("\n");
+
+    report_hash_throughput("djb2", djb2_hash, identifiers, count);
+    report_hash_throughput("constant", rbs_constant_pool_hash, identifiers, count);
+    printf("\n");
+
+    report_intern_throughput(identifiers, count, false);
+    report_intern_throughput(identifiers, count, true);
+
+    free(identifiers);
+    rbs_allocator_free(allocator);
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * Benchmark of `rbs_lexer_next_token` and `rbs_lexer_tokenize_all`.
+ *
+ * Reads the given RBS files, and reports the throughput of lexing all of them to the end, a token at a time as the
+ * parser does, and into an array in one call. The files are lexed several times, and the fastest round is reported.
+ *
+ * ```
+ * $ cc -O2 -DNDEBUG -Iinclude -o lexer_bench benchmark/lexer_bench.c src/[a-z]*.c src/util/[a-z]*.c
+ * $ ./lexer_bench $(find core -name '*.rbs')
+ * ```
+ */
+
+#include "rbs/lexer.h"
+#include "rbs/parser.h"
+#include "rbs/util/rbs_allocator.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    char *content;
+    size_t length;
+} source_t;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+}
+
+static char *read_file(const char *path, size_t *length) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    char *content = (char *) malloc((size_t) size + 1);
+    *length = fread(content, 1, (size_t) size, file);
+    content[*length] = '\0';
+    fclose(file);
+
+    return content;
+}
+
+static size_t lex(rbs_allocator_t *allocator, const source_t *source, size_t counts[], bool bulk) {
+    rbs_string_t string = rbs_string_new(source->content, source->content + source->length);
+    rbs_lexer_t *lexer = rbs_lexer_new(allocator, string, RBS_ENCODING_UTF_8_ENTRY, 0, (int) source->length);
+    if (lexer == NULL) return 0;
+
+    size_t tokens = 0;
+    if (bulk) {
+        rbs_lexer_tokenize_all(lexer, &tokens);
+    } else {
+        for (;;) {
+            rbs_token_t token = rbs_lexer_next_token(lexer);
+            tokens++;
+            if (counts != NULL) counts[token.type]++;
+            if (token.type == pEOF) break;
+        }
+    }
+
+    rbs_allocator_reset(allocator, 0);
+    return tokens;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s FILE.rbs...\n", argv[0]);
+        return 1;
+    }
+
+    size_t count = (size_t) (argc - 1);
+    source_t *sources = (source_t *) calloc(count, sizeof(source_t));
+    size_t bytes = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        sources[i].content = read_file(argv[i + 1], &sources[i].length);
+        if (sources[i].content == NULL) {
+            fprintf(stderr, "cannot read %s\n", argv[i + 1]);
+            return 1;
+        }
+        bytes += sources[i].length;
+    }
+
+    rbs_allocator_t *allocator = rbs_allocator_init();
+
+    size_t counts[tANNOTATION + 1] = { 0 };
+    size_t tokens = 0;
+    for (size_t i = 0; i < count; i++) {
+        tokens += lex(allocator, &sources[i], counts, false);
+    }
+
+    size_t words = 0;
+    for (int type = kALIAS; type <= tEQIDENT; type++) {
+        words += counts[type];
+    }
+
+    printf("%zu tokens, %zu bytes in %zu files\n", tokens, bytes, count);
+    printf("trivia %.1f%%, comments %.1f%%, identifiers and keywords %.1f%%\n\n", 100.0 * (double) counts[tTRIVIA] / (double) tokens, 100.0 * (double) (counts[tCOMMENT] + counts[tLINECOMMENT]) / (double) tokens, 100.0 * (double) words / (double) tokens);
+
+    const int rounds = 20;
+    for (int bulk = 0; bulk <= 1; bulk++) {
+        double best = 0;
+        for (int round = 0; round < rounds; round++) {
+            double start = now();
+            for (size_t i = 0; i < count; i++) {
+                lex(allocator, &sources[i], NULL, bulk);
+            }
+            double elapsed = now() - start;
+            if (round == 0 || elapsed < best) best = elapsed;
+        }
+
+        printf("%-22s %.2f ms/round, %.1f MB/s, %.1f ns/token\n", bulk ? "rbs_lexer_tokenize_all" : "rbs_lexer_next_token", best * 1e3, (double) bytes / best / 1e6, best * 1e9 / (double) tokens);
+    }
+
+    rbs_allocator_free(allocator);
+    for (size_t i = 0; i < count; i++) {
+        free(sources[i].content);
+    }
+    free(sources);
+    return 0;
+}
@@ -11,6 +11,8 @@
 #include "rbs_string_bridging.h"
 #include "legacy_location.h"
 
+#include "rbs/util/rbs_constant_pool_seeds.h"
+
 VALUE EMPTY_ARRAY;
 VALUE EMPTY_HASH;
 
@@ -27,26 +29,69 @@ rbs_translation_context_t rbs_translation_context_create(rbs_constant_pool_t *co
     };
 }
 
+/// The IDs of the seeded constants (see `rbs_constant_pool_seeds.h`), indexed by `constant_id - 1`.
+static ID seeded_constant_ids[RBS_CONSTANT_POOL_SEED_COUNT];
+
+void rbs__init_ast_translation(void) {
+    for (size_t i = 0; i < RBS_CONSTANT_POOL_SEED_COUNT; i++) {
+        seeded_constant_ids[i] = rb_intern2((const char *) rbs_constant_pool_seeds[i].start, (long) rbs_constant_pool_seeds[i].length);
+    }
+}
+
+/// Returns the Symbol of a constant.
+///
+/// The seeded constants are ASCII, so their Symbols are the same in every ASCII compatible encoding, and are interned once
+/// at load time.
+///
+/// When the constant pool is a view onto a global pool, the ID of the constant is cached in the global pool, so that each
+/// constant is interned with `rb_intern3()` once for all the parsers sharing the pool, like the parsers of a
+/// `_parse_signatures` batch. IDs from `rb_intern3()` are never collected, so the cache
+/// doesn't need to be marked. Only UTF-8 symbols are cached, since the ID depends on the encoding of the buffer.
+static VALUE rbs_constant_to_ruby_symbol(rbs_translation_context_t ctx, rbs_constant_id_t constant_id) {
+    if (constant_id <= RBS_CONSTANT_POOL_SEED_COUNT && rb_enc_asciicompat(ctx.encoding)) {
+        return ID2SYM(seeded_constant_ids[constant_id - 1]);
+    }
+
+    rbs_global_constant_pool_t *global = ctx.constant_pool->global;
+    bool cacheable = global != NULL && ctx.encoding == rb_utf8_encoding();
+
+    if (cacheable) {
+        ID id = (ID) rbs_global_constant_pool_get_data(global, constant_id);
+        if (id) return ID2SYM(id);
+    }
+
+    rbs_constant_t *constant = rbs_constant_pool_id_to_constant(ctx.constant_pool, constant_id);
+    assert(constant != NULL && "constant is NULL");
+    assert(constant->start != NULL && "constant->start is NULL");
+
+    ID id = rb_intern3((const char *) constant->start, constant->length, ctx.encoding);
+    if (cacheable) {
+        rbs_global_constant_pool_set_data(global, constant_id, (uintptr_t) id);
+    }
+
+    return ID2SYM(id);
+}
+
 VALUE rbs_node_list_to_ruby_array(rbs_translation_context_t ctx, rbs_node_list_t *list) {
-    VALUE ruby_array = rb_ary_new();
+    VALUE ruby_array = rb_ary_new_capa((long) list->length);
 
-    for (rbs_node_list_node_t *n = list->head; n != NULL; n = n->next) {
-        rb_ary_push(ruby_array, rbs_struct_to_ruby_value(ctx, n->node));
+    for (size_t i = 0; i < list->length; i++) {
+        rb_ary_push(ruby_array, rbs_struct_to_ruby_value(ctx, list->items[i]));
     }
 
     return ruby_array;
 }
 
 VALUE rbs_hash_to_ruby_hash(rbs_translation_context_t ctx, rbs_hash_t *rbs_hash) {
-    if (!rbs_hash->head) {
+    if (rbs_hash->length == 0) {
         return EMPTY_HASH;
     }
 
-    VALUE ruby_hash = rb_hash_new();
+    VALUE ruby_hash = rb_hash_new_capa((long) rbs_hash->length);
 
-    for (rbs_hash_node_t *n = rbs_hash->head; n != NULL; n = n->next) {
-        VALUE key = rbs_struct_to_ruby_value(ctx, n->key);
-        VALUE value = rbs_struct_to_ruby_value(ctx, n->value);
+    for (size_t i = 0; i < rbs_hash->length; i++) {
+        VALUE key = rbs_struct_to_ruby_value(ctx, rbs_hash->entries[i].key);
+        VALUE value = rbs_struct_to_ruby_value(ctx, rbs_hash->entries[i].value);
         rb_hash_aset(ruby_hash, key, value);
     }
 
@@ -77,13 +122,8 @@ VALUE rbs_location_range_list_to_ruby_array(rbs_translation_context_t ctx, rbs_l
 
 VALUE rbs_attr_ivar_name_to_ruby(rbs_translation_context_t ctx, rbs_attr_ivar_name_t ivar_name) {
     switch (ivar_name.tag) {
-    case RBS_ATTR_IVAR_NAME_TAG_NAME: {
-        rbs_constant_t *constant = rbs_constant_pool_id_to_constant(ctx.constant_pool, ivar_name.name);
-        assert(constant != NULL && "constant is NULL");
-        assert(constant->start != NULL && "constant->start is NULL");
-
-        return ID2SYM(rb_intern3((const char *) constant->start, constant->length, ctx.encoding));
-    }
+    case RBS_ATTR_IVAR_NAME_TAG_NAME:
+        return rbs_constant_to_ruby_symbol(ctx, ivar_name.name);
     case RBS_ATTR_IVAR_NAME_TAG_UNSPECIFIED:
         return Qnil;
     case RBS_ATTR_IVAR_NAME_TAG_EMPTY:
@@ -926,6 +966,10 @@ VALUE rbs_struct_to_ruby_value(rbs_translation_context_t ctx, rbs_node_t *instan
         VALUE arg_overloading = node->overloading ? Qtrue : Qfalse;
         VALUE arg_visibility = rbs_method_definition_visibility_to_ruby(node->visibility); // method_definition_visibility
 
+        // The overloads skipped with the `lazy_overloads` option are given as one `LazyOverloads`, instead of an array.
+        if (node->overloads->length == 1 && node->overloads->items[0]->type == RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS) {
+            arg_overloads = rb_ary_entry(arg_overloads, 0);
+        }
         // Claim the shared kwargs hash, clear it, fill it, and hand it to `.new`.
         // Must not recurse between `rb_hash_clear()` and `CLASS_NEW_INSTANCE()`.
         VALUE h = ctx.reusable_kwargs_hash;
@@ -940,6 +984,25 @@ VALUE rbs_struct_to_ruby_value(rbs_translation_context_t ctx, rbs_node_t *instan
         rb_hash_aset(h, ID2SYM(rb_intern("visibility")), arg_visibility);
         return CLASS_NEW_INSTANCE(RBS_AST_Members_MethodDefinition, 1, &h);
     }
+    case RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS: {
+        rbs_ast_members_method_definition_lazy_overloads_t *node = (rbs_ast_members_method_definition_lazy_overloads_t *) instance;
+
+        // Compute child VALUEs into locals variables first, before any recursion into `rbs_struct_to_ruby_value()`.
+        VALUE arg_location = rbs_location_range_to_ruby_location(ctx, node->base.location);
+        VALUE arg_variables = rbs_node_list_to_ruby_array(ctx, node->variables);
+        VALUE arg_classish_allowed = node->classish_allowed ? Qtrue : Qfalse;
+
+        // Claim the shared kwargs hash, clear it, fill it, and hand it to `.new`.
+        // Must not recurse between `rb_hash_clear()` and `CLASS_NEW_INSTANCE()`.
+        VALUE h = ctx.reusable_kwargs_hash;
+        rb_hash_clear(h);
+        rb_hash_aset(h, ID2SYM(rb_intern("location")), arg_location);
+        rb_hash_aset(h, ID2SYM(rb_intern("variables")), arg_variables);
+        rb_hash_aset(h, ID2SYM(rb_intern("classish_allowed")), arg_classish_allowed);
+        // The location has the character positions only, and parsing the text needs the bytes.
+        rb_hash_aset(h, ID2SYM(rb_intern("byte_range")), rb_range_new(INT2FIX(node->base.location.start_byte), INT2FIX(node->base.location.end_byte), 1));
+        return CLASS_NEW_INSTANCE(RBS_AST_Members_MethodDefinition_LazyOverloads, 1, &h);
+    }
     case RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD: {
         rbs_ast_members_method_definition_overload_t *node = (rbs_ast_members_method_definition_overload_t *) instance;
 
@@ -1857,13 +1920,8 @@ VALUE rbs_struct_to_ruby_value(rbs_translation_context_t ctx, rbs_node_t *instan
         rb_hash_aset(h, ID2SYM(rb_intern("name")), arg_name);
         return CLASS_NEW_INSTANCE(RBS_Types_Variable, 1, &h);
     }
-    case RBS_AST_SYMBOL: {
-        rbs_constant_t *constant = rbs_constant_pool_id_to_constant(ctx.constant_pool, ((rbs_ast_symbol_t *) instance)->constant_id);
-        assert(constant != NULL && "constant is NULL");
-        assert(constant->start != NULL && "constant->start is NULL");
-
-        return ID2SYM(rb_intern3((const char *) constant->start, constant->length, ctx.encoding));
-    }
+    case RBS_AST_SYMBOL:
+        return rbs_constant_to_ruby_symbol(ctx, ((rbs_ast_symbol_t *) instance)->constant_id);
     }
 
     rb_raise(rb_eRuntimeError, "Unknown node type: %d", instance->type);
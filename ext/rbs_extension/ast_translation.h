@@ -29,6 +29,8 @@ typedef struct rbs_translation_context {
     VALUE reusable_kwargs_hash;
 } rbs_translation_context_t;
 
+void rbs__init_ast_translation(void);
+
 rbs_translation_context_t rbs_translation_context_create(rbs_constant_pool_t *, VALUE buffer_string, rb_encoding *ruby_encoding);
 
 VALUE rbs_node_list_to_ruby_array(rbs_translation_context_t, rbs_node_list_t *list);
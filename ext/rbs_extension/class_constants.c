@@ -43,6 +43,7 @@ VALUE RBS_AST_Members_Extend;
 VALUE RBS_AST_Members_Include;
 VALUE RBS_AST_Members_InstanceVariable;
 VALUE RBS_AST_Members_MethodDefinition;
+VALUE RBS_AST_Members_MethodDefinition_LazyOverloads;
 VALUE RBS_AST_Members_MethodDefinition_Overload;
 VALUE RBS_AST_Members_Prepend;
 VALUE RBS_AST_Members_Private;
@@ -138,6 +139,7 @@ void rbs__init_constants(void) {
     IMPORT_CONSTANT(RBS_AST_Members_Include, RBS_AST_Members, "Include");
     IMPORT_CONSTANT(RBS_AST_Members_InstanceVariable, RBS_AST_Members, "InstanceVariable");
     IMPORT_CONSTANT(RBS_AST_Members_MethodDefinition, RBS_AST_Members, "MethodDefinition");
+    IMPORT_CONSTANT(RBS_AST_Members_MethodDefinition_LazyOverloads, RBS_AST_Members_MethodDefinition, "LazyOverloads");
     IMPORT_CONSTANT(RBS_AST_Members_MethodDefinition_Overload, RBS_AST_Members_MethodDefinition, "Overload");
     IMPORT_CONSTANT(RBS_AST_Members_Prepend, RBS_AST_Members, "Prepend");
     IMPORT_CONSTANT(RBS_AST_Members_Private, RBS_AST_Members, "Private");
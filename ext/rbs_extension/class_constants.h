@@ -51,6 +51,7 @@ extern VALUE RBS_AST_Members_Extend;
 extern VALUE RBS_AST_Members_Include;
 extern VALUE RBS_AST_Members_InstanceVariable;
 extern VALUE RBS_AST_Members_MethodDefinition;
+extern VALUE RBS_AST_Members_MethodDefinition_LazyOverloads;
 extern VALUE RBS_AST_Members_MethodDefinition_Overload;
 extern VALUE RBS_AST_Members_Prepend;
 extern VALUE RBS_AST_Members_Private;
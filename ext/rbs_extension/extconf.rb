@@ -29,6 +29,8 @@ if ENV["TEST_NO_C23"]
   $CFLAGS << " -Werror -Wc2x-extensions"
 end
 
+have_header('pthread.h')
+
 create_makefile 'rbs_extension'
 
 # Only generate compile_commands.json when compiling through Rake tasks
@@ -3,11 +3,17 @@
 #include "rbs/util/rbs_allocator.h"
 #include "rbs/util/rbs_constant_pool.h"
 #include "rbs/serialize.h"
+#include "rbs/deserialize.h"
 #include "ast_translation.h"
 #include "legacy_location.h"
 #include "rbs_string_bridging.h"
 
 #include "ruby/vm.h"
+#include "ruby/thread.h"
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 
 /**
  * Raises `RBS::ParsingError` or `RuntimeError` on `tok` with message constructed with given `fmt`.
@@ -16,17 +22,16 @@
  * foo.rbs:11:21...11:25: Syntax error: {message}, token=`{tok source}` ({tok type})
  * ```
  * */
-static NORETURN(void) raise_error(rbs_error_t *error, VALUE buffer) {
-    RBS_ASSERT(error != NULL, "raise_error() called with NULL error");
-
-    if (!error->syntax_error) {
-        rb_raise(rb_eRuntimeError, "Unexpected error");
-    }
+static NORETURN(void) raise_error(rbs_error_t *error, VALUE buffer);
 
+/**
+ * Builds `RBS::ParsingError` for `error`, even if it's not a syntax error.
+ * */
+static VALUE build_parsing_error(rbs_error_t *error, VALUE buffer) {
     VALUE location = rbs_new_location(buffer, error->token.range);
     VALUE type = rb_str_new_cstr(rbs_token_type_str(error->token.type));
 
-    VALUE rb_error = rb_funcall(
+    return rb_funcall(
         RBS_ParsingError,
         rb_intern("new"),
         3,
@@ -34,8 +39,25 @@ static NORETURN(void) raise_error(rbs_error_t *error, VALUE buffer) {
         rb_str_new_cstr(error->message),
         type
     );
+}
+
+/**
+ * Builds `RBS::ParsingError` (or `RuntimeError` for non-syntax errors) for `error` without raising it.
+ * */
+static VALUE build_error(rbs_error_t *error, VALUE buffer) {
+    RBS_ASSERT(error != NULL, "build_error() called with NULL error");
+
+    if (!error->syntax_error) {
+        return rb_exc_new_cstr(rb_eRuntimeError, "Unexpected error");
+    }
 
-    rb_exc_raise(rb_error);
+    return build_parsing_error(error, buffer);
+}
+
+static NORETURN(void) raise_error(rbs_error_t *error, VALUE buffer) {
+    RBS_ASSERT(error != NULL, "raise_error() called with NULL error");
+
+    rb_exc_raise(build_error(error, buffer));
 }
 
 void raise_error_if_any(rbs_parser_t *parser, VALUE buffer) {
@@ -44,6 +66,100 @@ void raise_error_if_any(rbs_parser_t *parser, VALUE buffer) {
     }
 }
 
+// The initial capacity of the constant pool that the parsers of a batch share (see `rbsparser_parse_signatures`).
+#define SHARED_CONSTANT_POOL_CAPACITY 4096
+
+// The arena of the parsers is kept in a fiber local variable between parses, so that a loop of short parses
+// (`RBS::Parser.parse_type` from `RBS::Test`, for example) reuses the same pages instead of going back to `malloc` every time.
+// The arena is taken out of the variable while a parser uses it, so that a nested parse gets an arena of its own.
+static ID id_parser_arena;
+
+// The symbols of the token types, indexed by `enum RBSTokenType`, so that the packed tokens of `_lex_packed` are read
+// without interning a name per token.
+static VALUE TOKEN_TYPES;
+
+// Pages kept in the arena after a parse. Larger parses give the rest back to `malloc`.
+#define PARSER_ARENA_RETAIN_SIZE (256 * 1024)
+
+// A parse allocates 4 to 7 times the size of its input in the arena for most of the files in `core/` (5.1 on average),
+// so the arena reserves the lower end of it upfront, and grows for the rest.
+#define PARSER_ARENA_SIZE_HINT(start_pos, end_pos) ((size_t) ((end_pos) - (start_pos)) * 4)
+
+struct parser_arena {
+    // NULL while a parser is using it.
+    rbs_allocator_t *allocator;
+
+    // The stats of the arena right before the last reset, for `RBS::Parser._last_parse_stats`.
+    rbs_allocator_stats_t last_stats;
+    bool has_last_stats;
+};
+
+static void parser_arena_free(void *ptr) {
+    struct parser_arena *arena = (struct parser_arena *) ptr;
+
+    if (arena->allocator) {
+        rbs_allocator_free(arena->allocator);
+    }
+    xfree(arena);
+}
+
+static const rb_data_type_t parser_arena_type = {
+    "RBS::Parser::Arena",
+    { 0, parser_arena_free, 0 },
+    0,
+    0,
+    RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+static struct parser_arena *current_parser_arena(bool create) {
+    VALUE thread = rb_thread_current();
+    VALUE holder = rb_thread_local_aref(thread, id_parser_arena);
+
+    // The fiber local can be overwritten from Ruby, so anything but an arena is taken as no arena.
+    if (!rb_typeddata_is_kind_of(holder, &parser_arena_type)) {
+        if (!create) return NULL;
+
+        struct parser_arena *arena;
+        holder = TypedData_Make_Struct(0, struct parser_arena, &parser_arena_type, arena);
+        rb_thread_local_aset(thread, id_parser_arena, holder);
+    }
+
+    return (struct parser_arena *) RTYPEDDATA_DATA(holder);
+}
+
+static rbs_allocator_t *take_parser_arena(void) {
+    struct parser_arena *arena = current_parser_arena(false);
+
+    if (arena && arena->allocator) {
+        rbs_allocator_t *allocator = arena->allocator;
+        arena->allocator = NULL;
+        return allocator;
+    }
+
+    return rbs_allocator_init();
+}
+
+static void return_parser_arena(rbs_allocator_t *allocator) {
+    struct parser_arena *arena = current_parser_arena(true);
+
+    arena->last_stats = rbs_allocator_stats(allocator);
+    arena->has_last_stats = true;
+
+    if (arena->allocator == NULL) {
+        rbs_allocator_reset(allocator, PARSER_ARENA_RETAIN_SIZE);
+        arena->allocator = allocator;
+    } else {
+        // A nested parse has returned its arena already.
+        rbs_allocator_free(allocator);
+    }
+}
+
+static void free_parser(rbs_parser_t *parser) {
+    rbs_allocator_t *allocator = parser->allocator;
+    rbs_parser_free(parser);
+    return_parser_arena(allocator);
+}
+
 /**
  * Inserts the given array of type variables names into the parser's type variable table.
  * @param parser
@@ -53,7 +169,7 @@ static void declare_type_variables(rbs_parser_t *parser, VALUE variables, VALUE
     if (NIL_P(variables)) return; // Nothing to do.
 
     if (!RB_TYPE_P(variables, T_ARRAY)) {
-        rbs_parser_free(parser);
+        free_parser(parser);
         rb_raise(rb_eTypeError, "wrong argument type %" PRIsVALUE " (must be an Array of Symbols or nil)", rb_obj_class(variables));
     }
 
@@ -63,7 +179,7 @@ static void declare_type_variables(rbs_parser_t *parser, VALUE variables, VALUE
         VALUE symbol = rb_ary_entry(variables, i);
 
         if (!RB_TYPE_P(symbol, T_SYMBOL)) {
-            rbs_parser_free(parser);
+            free_parser(parser);
             rb_raise(rb_eTypeError, "Type variables Array contains invalid value %" PRIsVALUE " of type %" PRIsVALUE " (must be an Array of Symbols or nil)", rb_inspect(symbol), rb_obj_class(symbol));
         }
 
@@ -78,7 +194,9 @@ static void declare_type_variables(rbs_parser_t *parser, VALUE variables, VALUE
         );
 
         if (!rbs_parser_insert_typevar(parser, id)) {
-            raise_error(parser->error, buffer);
+            VALUE error = build_error(parser->error, buffer);
+            free_parser(parser);
+            rb_exc_raise(error);
         }
     }
 }
@@ -108,7 +226,7 @@ struct parse_signature_arg {
 };
 
 static VALUE ensure_free_parser(VALUE parser) {
-    rbs_parser_free((rbs_parser_t *) parser);
+    free_parser((rbs_parser_t *) parser);
     return Qnil;
 }
 
@@ -165,9 +283,9 @@ static void validate_position_range(VALUE string, int start_pos, int end_pos) {
     }
 }
 
+// Takes the ownership of `allocator`, which has to be an arena from `take_parser_arena()`, when it raises.
+// The position range has to be validated beforehand.
 static rbs_lexer_t *alloc_lexer_from_buffer(rbs_allocator_t *allocator, VALUE string, rb_encoding *encoding, int start_pos, int end_pos) {
-    validate_position_range(string, start_pos, end_pos);
-
     const char *encoding_name = rb_enc_name(encoding);
 
     rbs_lexer_t *lexer = rbs_lexer_new(
@@ -179,6 +297,7 @@ static rbs_lexer_t *alloc_lexer_from_buffer(rbs_allocator_t *allocator, VALUE st
     );
 
     if (lexer == NULL) {
+        return_parser_arena(allocator);
         rb_raise(rb_eArgError, "position range starts inside a character: %d...%d", start_pos, end_pos);
     }
 
@@ -194,16 +313,17 @@ static rbs_parser_options_t parser_options(VALUE enable_forwarding_params) {
     };
 }
 
-static rbs_parser_t *alloc_parser_from_buffer_with_options(VALUE buffer, int start_pos, int end_pos, rbs_parser_options_t options) {
-    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
-    StringValue(string);
-
-    validate_position_range(string, start_pos, end_pos);
-
+// Sets up a parser for the content of a buffer, with an arena of `arena_size` bytes reserved.
+// The position range has to be validated beforehand.
+static rbs_parser_t *alloc_parser_from_string(VALUE string, int start_pos, int end_pos, size_t arena_size, rbs_parser_options_t options) {
     rb_encoding *encoding = rb_enc_get(string);
     const char *encoding_name = rb_enc_name(encoding);
 
-    rbs_parser_t *parser = rbs_parser_new_with_options(
+    rbs_allocator_t *allocator = take_parser_arena();
+    rbs_allocator_reserve(allocator, arena_size);
+
+    rbs_parser_t *parser = rbs_parser_new_with_allocator(
+        allocator,
         rbs_string_from_ruby_string(string),
         rbs_encoding_find((const uint8_t *) encoding_name, (const uint8_t *) (encoding_name + strlen(encoding_name))),
         start_pos,
@@ -212,12 +332,44 @@ static rbs_parser_t *alloc_parser_from_buffer_with_options(VALUE buffer, int sta
     );
 
     if (parser == NULL) {
+        return_parser_arena(allocator);
         rb_raise(rb_eArgError, "position range starts inside a character: %d...%d", start_pos, end_pos);
     }
 
     return parser;
 }
 
+static rbs_parser_t *alloc_parser_from_buffer_with_options(VALUE buffer, int start_pos, int end_pos, rbs_parser_options_t options) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+
+    validate_position_range(string, start_pos, end_pos);
+
+    return alloc_parser_from_string(string, start_pos, end_pos, PARSER_ARENA_SIZE_HINT(start_pos, end_pos), options);
+}
+
+// Sets up a parser like `alloc_parser_from_buffer`, when the caller knows the character position of `start_pos`.
+// The lexer moves there directly, instead of counting the characters from the beginning of the buffer, and the text
+// before `start_pos` is not read at all.
+static rbs_parser_t *alloc_parser_from_buffer_at(VALUE buffer, int start_pos, int start_char, int end_pos) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+
+    validate_position_range(string, start_pos, end_pos);
+
+    rbs_parser_t *parser = alloc_parser_from_string(string, 0, 0, PARSER_ARENA_SIZE_HINT(start_pos, end_pos), (rbs_parser_options_t) { 0 });
+    rbs_parser_seek(
+        parser,
+        (rbs_lexer_checkpoint_t) {
+            .position = { .byte_pos = start_pos, .char_pos = start_char },
+            .first_token_of_line = false,
+        },
+        end_pos
+    );
+
+    return parser;
+}
+
 static rbs_parser_t *alloc_parser_from_buffer(VALUE buffer, int start_pos, int end_pos) {
     return alloc_parser_from_buffer_with_options(buffer, start_pos, end_pos, (rbs_parser_options_t) { 0 });
 }
@@ -289,6 +441,56 @@ static VALUE rbsparser_parse_method_type(VALUE self, VALUE buffer, VALUE start_p
     return result;
 }
 
+struct parse_method_overloads_arg {
+    VALUE buffer;
+    rb_encoding *encoding;
+    rbs_parser_t *parser;
+    VALUE classish_allowed;
+};
+
+static VALUE parse_method_overloads_try(VALUE a) {
+    struct parse_method_overloads_arg *arg = (struct parse_method_overloads_arg *) a;
+    rbs_parser_t *parser = arg->parser;
+
+    rbs_node_list_t *overloads = NULL;
+    rbs_parse_method_overloads(parser, RB_TEST(arg->classish_allowed), &overloads);
+
+    raise_error_if_any(parser, arg->buffer);
+
+    rbs_translation_context_t ctx = rbs_translation_context_create(
+        &parser->constant_pool,
+        arg->buffer,
+        arg->encoding
+    );
+
+    return rbs_node_list_to_ruby_array(ctx, overloads);
+}
+
+/**
+ * Parses the overloads that the `lazy_overloads` and `skeleton` options give as text, from the location of a
+ * `RBS::AST::Members::MethodDefinition::LazyOverloads`, with its `variables`.
+ * */
+static VALUE rbsparser_parse_method_overloads(VALUE self, VALUE buffer, VALUE start_pos, VALUE end_pos, VALUE start_char, VALUE variables, VALUE classish_allowed) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    rb_encoding *encoding = rb_enc_get(string);
+
+    rbs_parser_t *parser = alloc_parser_from_buffer_at(buffer, FIX2INT(start_pos), FIX2INT(start_char), FIX2INT(end_pos));
+    declare_type_variables(parser, variables, buffer);
+    struct parse_method_overloads_arg arg = {
+        .buffer = buffer,
+        .encoding = encoding,
+        .parser = parser,
+        .classish_allowed = classish_allowed
+    };
+
+    VALUE result = rb_ensure(parse_method_overloads_try, (VALUE) &arg, ensure_free_parser, (VALUE) parser);
+
+    RB_GC_GUARD(string);
+
+    return result;
+}
+
 static VALUE parse_signature_try(VALUE a) {
     struct parse_signature_arg *arg = (struct parse_signature_arg *) a;
     rbs_parser_t *parser = arg->parser;
@@ -327,13 +529,380 @@ static VALUE rbsparser_parse_signature(VALUE self, VALUE buffer, VALUE start_pos
     return result;
 }
 
+static VALUE parse_signature_skeleton_try(VALUE a) {
+    struct parse_signature_arg *arg = (struct parse_signature_arg *) a;
+    rbs_parser_t *parser = arg->parser;
+
+    rbs_signature_t *signature = NULL;
+    rbs_parse_signature_skeleton(parser, &signature);
+
+    raise_error_if_any(parser, arg->buffer);
+
+    rbs_translation_context_t ctx = rbs_translation_context_create(
+        &parser->constant_pool,
+        arg->buffer,
+        arg->encoding
+    );
+
+    return rbs_struct_to_ruby_value(ctx, (rbs_node_t *) signature);
+}
+
+static VALUE rbsparser_parse_signature_skeleton(VALUE self, VALUE buffer, VALUE start_pos, VALUE end_pos) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    rb_encoding *encoding = rb_enc_get(string);
+
+    rbs_parser_t *parser = alloc_parser_from_buffer(buffer, FIX2INT(start_pos), FIX2INT(end_pos));
+    struct parse_signature_arg arg = {
+        .buffer = buffer,
+        .encoding = encoding,
+        .parser = parser,
+        .require_eof = false
+    };
+
+    VALUE result = rb_ensure(parse_signature_skeleton_try, (VALUE) &arg, ensure_free_parser, (VALUE) parser);
+
+    RB_GC_GUARD(string);
+
+    return result;
+}
+
+static VALUE parse_signature_with_errors_try(VALUE a) {
+    struct parse_signature_arg *arg = (struct parse_signature_arg *) a;
+    rbs_parser_t *parser = arg->parser;
+
+    // With `recover_errors`, the parser records every error in `errors`, and gives the signature of the rest.
+    rbs_signature_t *signature = NULL;
+    bool parsed = rbs_parse_signature(parser, &signature);
+    rbs_assert_impl(parsed, "rbs_parse_signature() failed with recover_errors");
+
+    rbs_translation_context_t ctx = rbs_translation_context_create(
+        &parser->constant_pool,
+        arg->buffer,
+        arg->encoding
+    );
+
+    VALUE result = rbs_struct_to_ruby_value(ctx, (rbs_node_t *) signature);
+
+    VALUE errors = rb_ary_new();
+    for (rbs_error_t *error = parser->errors; error != NULL; error = error->next) {
+        rb_ary_push(errors, build_parsing_error(error, arg->buffer));
+    }
+
+    return rb_ary_new3(3, rb_ary_entry(result, 0), rb_ary_entry(result, 1), errors);
+}
+
+// Parses the signature recovering from syntax errors, and returns the syntax errors without raising them.
+static VALUE rbsparser_parse_signature_with_errors(VALUE self, VALUE buffer, VALUE start_pos, VALUE end_pos, VALUE enable_forwarding_params) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    rb_encoding *encoding = rb_enc_get(string);
+
+    rbs_parser_options_t options = parser_options(enable_forwarding_params);
+    options.recover_errors = true;
+
+    rbs_parser_t *parser = alloc_parser_from_buffer_with_options(buffer, FIX2INT(start_pos), FIX2INT(end_pos), options);
+    struct parse_signature_arg arg = {
+        .buffer = buffer,
+        .encoding = encoding,
+        .parser = parser,
+        .require_eof = false
+    };
+
+    VALUE result = rb_ensure(parse_signature_with_errors_try, (VALUE) &arg, ensure_free_parser, (VALUE) parser);
+
+    RB_GC_GUARD(string);
+
+    return result;
+}
+
+/**
+ * One entry of a `_parse_signatures` batch.
+ *
+ * The source is copied out of the Ruby string so that the parser can run without the GVL,
+ * while other Ruby threads may run GC (and compaction) or even mutate the buffer.
+ * */
+struct parse_signatures_job {
+    VALUE buffer;
+    rb_encoding *encoding;
+    char *source;
+    rbs_parser_t *parser;
+    rbs_signature_t *signature;
+};
+
+struct parse_signatures_arg {
+    VALUE buffers;
+    VALUE start_positions;
+    VALUE end_positions;
+    rbs_parser_options_t options;
+    rbs_global_constant_pool_t *constant_pool;
+    struct parse_signatures_job *jobs;
+    long capacity;
+    long count;
+    long threads;
+    long next;
+    // Set by `parse_signatures_unblock` to stop handing out jobs, so that an interrupt is served without waiting for the whole batch.
+    volatile bool cancelled;
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_t lock;
+#endif
+};
+
+static struct parse_signatures_job *parse_signatures_take_job(struct parse_signatures_arg *arg) {
+    struct parse_signatures_job *job = NULL;
+
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_lock(&arg->lock);
+#endif
+    if (!arg->cancelled && arg->next < arg->count) {
+        job = &arg->jobs[arg->next++];
+    }
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_unlock(&arg->lock);
+#endif
+
+    return job;
+}
+
+// The unblocking function of `parse_signatures_nogvl`: the jobs already running finish, and no new job is started.
+static void parse_signatures_unblock(void *a) {
+    struct parse_signatures_arg *arg = (struct parse_signatures_arg *) a;
+
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_lock(&arg->lock);
+#endif
+    arg->cancelled = true;
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_unlock(&arg->lock);
+#endif
+}
+
+// Runs without the GVL: only touches the copied sources and the parsers' own arenas.
+static void *parse_signatures_worker(void *a) {
+    struct parse_signatures_arg *arg = (struct parse_signatures_arg *) a;
+
+    struct parse_signatures_job *job;
+    while ((job = parse_signatures_take_job(arg)) != NULL) {
+        rbs_parse_signature(job->parser, &job->signature);
+    }
+
+    return NULL;
+}
+
+static void *parse_signatures_nogvl(void *a) {
+    struct parse_signatures_arg *arg = (struct parse_signatures_arg *) a;
+
+#ifdef HAVE_PTHREAD_H
+    long spawned = 0;
+    pthread_t *workers = NULL;
+
+    if (arg->threads > 1) {
+        workers = (pthread_t *) malloc(sizeof(pthread_t) * (size_t) (arg->threads - 1));
+    }
+
+    if (workers != NULL) {
+        for (; spawned < arg->threads - 1; spawned++) {
+            if (pthread_create(&workers[spawned], NULL, parse_signatures_worker, arg) != 0) {
+                // Failing to spawn is not fatal: the remaining jobs are picked up by the threads we have.
+                break;
+            }
+        }
+    }
+
+    parse_signatures_worker(arg);
+
+    for (long i = 0; i < spawned; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    free(workers);
+#else
+    parse_signatures_worker(arg);
+#endif
+
+    return NULL;
+}
+
+// Copies the sources and sets up one parser per buffer.
+// `arg->count` only covers the jobs set up so far, so that the ensure clause can release them if this raises halfway.
+static void parse_signatures_prepare(struct parse_signatures_arg *arg) {
+    for (long i = 0; i < arg->capacity; i++) {
+        VALUE buffer = rb_ary_entry(arg->buffers, i);
+        VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+        StringValue(string);
+
+        int start_pos = FIX2INT(rb_ary_entry(arg->start_positions, i));
+        int end_pos = FIX2INT(rb_ary_entry(arg->end_positions, i));
+        validate_position_range(string, start_pos, end_pos);
+
+        rb_encoding *encoding = rb_enc_get(string);
+        const char *encoding_name = rb_enc_name(encoding);
+
+        long length = RSTRING_LEN(string);
+        char *source = (char *) malloc((size_t) length + 1);
+        if (source == NULL) {
+            rb_raise(rb_eNoMemError, "failed to allocate %ld bytes", length + 1);
+        }
+        memcpy(source, RSTRING_PTR(string), (size_t) length);
+        source[length] = '\0';
+
+        struct parse_signatures_job *job = &arg->jobs[arg->count++];
+        job->buffer = buffer;
+        job->encoding = encoding;
+        job->source = source;
+        job->parser = rbs_parser_new_with_options(
+            rbs_string_new(source, source + length),
+            rbs_encoding_find((const uint8_t *) encoding_name, (const uint8_t *) (encoding_name + strlen(encoding_name))),
+            start_pos,
+            end_pos,
+            arg->options
+        );
+
+        if (job->parser == NULL) {
+            rb_raise(rb_eArgError, "position range starts inside a character: %d...%d", start_pos, end_pos);
+        }
+
+        rbs_parser_use_global_constant_pool(job->parser, arg->constant_pool);
+        rbs_allocator_reserve(job->parser->allocator, PARSER_ARENA_SIZE_HINT(start_pos, end_pos));
+
+        RB_GC_GUARD(string);
+    }
+}
+
+static VALUE parse_signatures_try(VALUE a) {
+    struct parse_signatures_arg *arg = (struct parse_signatures_arg *) a;
+
+    // The parsers of the batch share a constant pool, so that the translation interns each name into a Ruby symbol once
+    // per batch instead of once per file. The pool lives as long as the batch, so a long-running process doesn't keep
+    // the names of everything it has parsed.
+    arg->constant_pool = rbs_global_constant_pool_new(SHARED_CONSTANT_POOL_CAPACITY);
+    if (arg->constant_pool == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate the constant pool");
+    }
+
+    parse_signatures_prepare(arg);
+
+    if (arg->threads > arg->count) arg->threads = arg->count;
+    if (arg->threads < 1) arg->threads = 1;
+
+    // An interrupt stops the workers between jobs. Pending interrupts are then served with the GVL held: an exception
+    // (Ctrl-C, `Thread#raise`, `Thread#kill`) propagates and the ensure clause frees the batch, while a signal handler
+    // that returns lets the remaining jobs run.
+    while (arg->next < arg->count) {
+        arg->cancelled = false;
+        rb_thread_call_without_gvl(parse_signatures_nogvl, arg, parse_signatures_unblock, arg);
+        rb_thread_check_ints();
+    }
+
+    VALUE results = rb_ary_new_capa(arg->count);
+
+    for (long i = 0; i < arg->count; i++) {
+        struct parse_signatures_job *job = &arg->jobs[i];
+
+        if (job->parser->error != NULL) {
+            rb_ary_push(results, build_error(job->parser->error, job->buffer));
+            continue;
+        }
+
+        rbs_translation_context_t ctx = rbs_translation_context_create(
+            &job->parser->constant_pool,
+            job->buffer,
+            job->encoding
+        );
+
+        rb_ary_push(results, rbs_struct_to_ruby_value(ctx, (rbs_node_t *) job->signature));
+    }
+
+    return results;
+}
+
+static VALUE ensure_free_parse_signatures(VALUE a) {
+    struct parse_signatures_arg *arg = (struct parse_signatures_arg *) a;
+
+    for (long i = 0; i < arg->count; i++) {
+        if (arg->jobs[i].parser != NULL) {
+            rbs_parser_free(arg->jobs[i].parser);
+        }
+        free(arg->jobs[i].source);
+    }
+
+    free(arg->jobs);
+
+    if (arg->constant_pool != NULL) {
+        rbs_global_constant_pool_free(arg->constant_pool);
+    }
+
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_destroy(&arg->lock);
+#endif
+
+    return Qnil;
+}
+
+/**
+ * Parses a batch of signature buffers, using up to `threads` native threads with the GVL released.
+ *
+ * Returns an Array with one entry per buffer, in order: `[directives, declarations]` on success,
+ * or the `RBS::ParsingError` object (not raised) when the buffer has a syntax error.
+ * Only the translation to Ruby objects runs with the GVL held.
+ * With `lazy_overloads`, the overloads of method definitions are given as their text (see `rbs_parser_options_t`).
+ * */
+static VALUE rbsparser_parse_signatures(VALUE self, VALUE buffers, VALUE start_positions, VALUE end_positions, VALUE enable_forwarding_params, VALUE lazy_overloads, VALUE threads) {
+    Check_Type(buffers, T_ARRAY);
+    Check_Type(start_positions, T_ARRAY);
+    Check_Type(end_positions, T_ARRAY);
+
+    long count = RARRAY_LEN(buffers);
+    if (RARRAY_LEN(start_positions) != count || RARRAY_LEN(end_positions) != count) {
+        rb_raise(rb_eArgError, "buffers and positions must have the same length");
+    }
+
+    long thread_count = NUM2LONG(threads);
+
+    rbs_parser_options_t options = parser_options(enable_forwarding_params);
+    options.lazy_overloads = RB_TEST(lazy_overloads);
+
+    struct parse_signatures_arg arg = {
+        .buffers = buffers,
+        .start_positions = start_positions,
+        .end_positions = end_positions,
+        .options = options,
+        .constant_pool = NULL,
+        .jobs = (struct parse_signatures_job *) calloc((size_t) (count > 0 ? count : 1), sizeof(struct parse_signatures_job)),
+        .capacity = count,
+        .count = 0,
+        .threads = thread_count,
+        .next = 0,
+        .cancelled = false,
+    };
+
+    if (arg.jobs == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate %ld parser jobs", count);
+    }
+
+#ifdef HAVE_PTHREAD_H
+    pthread_mutex_init(&arg.lock, NULL);
+#endif
+
+    VALUE result = rb_ensure(parse_signatures_try, (VALUE) &arg, ensure_free_parse_signatures, (VALUE) &arg);
+
+    RB_GC_GUARD(buffers);
+
+    return result;
+}
+
 // Serialize a parsed node into a binary Ruby string using the same encoder the
 // WebAssembly build uses. These `_*_to_bytes` entry points exist so the
 // round-trip (parse -> serialize -> deserialize) can be exercised on CRuby,
 // where it can be compared against the direct C -> Ruby translation.
 static VALUE serialized_node_to_string(rbs_parser_t *parser, rbs_node_t *node) {
-    rbs_string_t bytes = rbs_serialize_node(parser->allocator, &parser->constant_pool, node);
-    return rb_str_new(bytes.start, (long) rbs_string_len(bytes));
+    rbs_serializer_t serializer;
+    rbs_serializer_init(&serializer, parser->allocator, &parser->constant_pool);
+
+    size_t size = rbs_serializer_measure_node(&serializer, node);
+    VALUE string = rb_str_new(NULL, (long) size);
+    rbs_serializer_write_node(&serializer, node, RSTRING_PTR(string));
+    return string;
 }
 
 static VALUE parse_type_to_bytes_try(VALUE a) {
@@ -453,6 +1022,343 @@ static VALUE rbsparser_parse_signature_to_bytes(VALUE self, VALUE buffer, VALUE
     return result;
 }
 
+// The initial capacity of the constant pool of an `RBS::Parser::IncrementalSignature`.
+#define INCREMENTAL_CONSTANT_POOL_CAPACITY 1024
+
+// An incremental parse leaves the nodes it replaced in the arena, so once the arena has grown this many times the size
+// of the last full parse, the next edit parses the whole input again into a fresh arena.
+#define INCREMENTAL_ARENA_GROWTH_LIMIT 4
+
+/**
+ * The state of an `RBS::Parser::IncrementalSignature`: the last signature it parsed, kept in its own arena, so that the
+ * next edit parses the declarations around the edit only.
+ *
+ * The reused declarations may point into the text of the inputs they were parsed from, so the arena keeps a copy of
+ * every input since the last full parse, and the names are interned into a constant pool that all the parses share.
+ * */
+struct incremental_signature {
+    rbs_allocator_t *allocator;
+    rbs_global_constant_pool_t *constant_pool;
+    rbs_parser_options_t options;
+
+    // The copy of the last input, or NULL before the first parse.
+    const char *source;
+    int length;
+
+    // The signature of the last input, or NULL if it has a syntax error.
+    rbs_signature_t *signature;
+
+    // The arena bytes of the last full parse.
+    size_t full_parse_bytes;
+
+    // Set while a parse runs, since the translation to Ruby objects may switch threads.
+    bool busy;
+};
+
+static void incremental_signature_free(void *ptr) {
+    struct incremental_signature *state = (struct incremental_signature *) ptr;
+
+    if (state->allocator) {
+        rbs_allocator_free(state->allocator);
+    }
+    if (state->constant_pool) {
+        rbs_global_constant_pool_free(state->constant_pool);
+    }
+    xfree(state);
+}
+
+static size_t incremental_signature_memsize(const void *ptr) {
+    const struct incremental_signature *state = (const struct incremental_signature *) ptr;
+
+    size_t size = sizeof(struct incremental_signature);
+    if (state->allocator) {
+        size += rbs_allocator_stats(state->allocator).capacity_bytes;
+    }
+    return size;
+}
+
+static const rb_data_type_t incremental_signature_type = {
+    "RBS::Parser::IncrementalSignature",
+    { 0, incremental_signature_free, incremental_signature_memsize },
+    0,
+    0,
+    RUBY_TYPED_FREE_IMMEDIATELY
+};
+
+static VALUE incremental_signature_allocate(VALUE klass) {
+    struct incremental_signature *state;
+    return TypedData_Make_Struct(klass, struct incremental_signature, &incremental_signature_type, state);
+}
+
+static struct incremental_signature *incremental_signature_get(VALUE self) {
+    struct incremental_signature *state;
+    TypedData_Get_Struct(self, struct incremental_signature, &incremental_signature_type, state);
+    return state;
+}
+
+static VALUE incremental_signature_initialize(VALUE self, VALUE enable_forwarding_params) {
+    struct incremental_signature *state = incremental_signature_get(self);
+    state->options = parser_options(enable_forwarding_params);
+    return self;
+}
+
+struct incremental_signature_arg {
+    struct incremental_signature *state;
+    VALUE buffer;
+    VALUE string;
+    bool incremental;
+    rbs_lexer_edit_t edit;
+    rbs_parser_t *parser;
+};
+
+static VALUE incremental_signature_parse_try(VALUE a) {
+    struct incremental_signature_arg *arg = (struct incremental_signature_arg *) a;
+    struct incremental_signature *state = arg->state;
+
+    if (state->allocator == NULL) {
+        state->allocator = rbs_allocator_init();
+    }
+
+    if (!arg->incremental) {
+        // Nothing of the previous parses is used anymore: start over with an empty arena and constant pool.
+        state->signature = NULL;
+        state->source = NULL;
+        rbs_allocator_reset(state->allocator, SIZE_MAX);
+
+        if (state->constant_pool) {
+            rbs_global_constant_pool_free(state->constant_pool);
+        }
+        state->constant_pool = rbs_global_constant_pool_new(INCREMENTAL_CONSTANT_POOL_CAPACITY);
+        if (state->constant_pool == NULL) {
+            rb_raise(rb_eNoMemError, "failed to allocate the constant pool");
+        }
+    }
+
+    int length = (int) RSTRING_LEN(arg->string);
+    char *source = rbs_allocator_alloc_many(state->allocator, (size_t) length + 1, char);
+    memcpy(source, RSTRING_PTR(arg->string), (size_t) length);
+    source[length] = '\0';
+
+    rb_encoding *encoding = rb_enc_get(arg->string);
+    const char *encoding_name = rb_enc_name(encoding);
+
+    arg->parser = rbs_parser_new_with_allocator(
+        state->allocator,
+        rbs_string_new(source, source + length),
+        rbs_encoding_find((const uint8_t *) encoding_name, (const uint8_t *) (encoding_name + strlen(encoding_name))),
+        0,
+        length,
+        state->options
+    );
+    if (arg->parser == NULL) {
+        rb_raise(rb_eArgError, "position range starts inside a character: 0...%d", length);
+    }
+    rbs_parser_use_global_constant_pool(arg->parser, state->constant_pool);
+
+    rbs_signature_t *signature = NULL;
+    bool parsed;
+    if (arg->incremental) {
+        parsed = rbs_parse_signature_incremental(arg->parser, state->signature, arg->edit, &signature);
+    } else {
+        parsed = rbs_parse_signature(arg->parser, &signature);
+    }
+
+    // An incremental parse updates the declarations of the previous signature in place, so the previous signature is
+    // gone either way. The next edit is an edit of this input, and parses all of it again if it has a syntax error.
+    state->source = source;
+    state->length = length;
+    state->signature = parsed && arg->parser->error == NULL ? signature : NULL;
+    if (!arg->incremental) {
+        state->full_parse_bytes = state->allocator->requested_bytes;
+    }
+
+    raise_error_if_any(arg->parser, arg->buffer);
+
+    rbs_translation_context_t ctx = rbs_translation_context_create(
+        &arg->parser->constant_pool,
+        arg->buffer,
+        encoding
+    );
+
+    return rbs_struct_to_ruby_value(ctx, (rbs_node_t *) signature);
+}
+
+static VALUE ensure_free_incremental_signature_parse(VALUE a) {
+    struct incremental_signature_arg *arg = (struct incremental_signature_arg *) a;
+
+    if (arg->parser) {
+        rbs_parser_free(arg->parser);
+    }
+    arg->state->busy = false;
+
+    return Qnil;
+}
+
+static VALUE incremental_signature_parse_buffer(VALUE self, VALUE buffer, bool incremental, rbs_lexer_edit_t edit) {
+    struct incremental_signature *state = incremental_signature_get(self);
+    if (state->busy) {
+        rb_raise(rb_eRuntimeError, "RBS::Parser::IncrementalSignature is parsing on another thread");
+    }
+
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    if (RSTRING_LEN(string) > INT_MAX) {
+        rb_raise(rb_eArgError, "buffer is too large: %ld bytes", RSTRING_LEN(string));
+    }
+
+    if (incremental) {
+        if (state->source == NULL) {
+            rb_raise(rb_eArgError, "no input has been parsed to edit");
+        }
+
+        long suffix = (long) state->length - edit.old_end_byte;
+        if (
+            edit.start_byte < 0 || edit.start_byte > edit.old_end_byte || edit.start_byte > edit.new_end_byte || suffix < 0 ||
+            RSTRING_LEN(string) - edit.new_end_byte != suffix ||
+            memcmp(state->source, RSTRING_PTR(string), (size_t) edit.start_byte) != 0 ||
+            memcmp(state->source + edit.old_end_byte, RSTRING_PTR(string) + edit.new_end_byte, (size_t) suffix) != 0
+        ) {
+            rb_raise(rb_eArgError, "invalid edit: %d...%d replaced with %d...%d", edit.start_byte, edit.old_end_byte, edit.start_byte, edit.new_end_byte);
+        }
+
+        // Parse the whole input if there is no signature to reuse, or if the arena is mostly the nodes that the
+        // previous edits have replaced.
+        if (state->signature == NULL || state->allocator->requested_bytes > state->full_parse_bytes * INCREMENTAL_ARENA_GROWTH_LIMIT) {
+            incremental = false;
+        }
+    }
+
+    struct incremental_signature_arg arg = {
+        .state = state,
+        .buffer = buffer,
+        .string = string,
+        .incremental = incremental,
+        .edit = edit,
+        .parser = NULL,
+    };
+
+    state->busy = true;
+    VALUE result = rb_ensure(incremental_signature_parse_try, (VALUE) &arg, ensure_free_incremental_signature_parse, (VALUE) &arg);
+
+    RB_GC_GUARD(string);
+
+    return result;
+}
+
+// Parses the whole of `buffer`, and keeps the signature for the next `#update`.
+static VALUE incremental_signature_parse(VALUE self, VALUE buffer) {
+    return incremental_signature_parse_buffer(self, buffer, false, (rbs_lexer_edit_t) { 0 });
+}
+
+// Parses `buffer`, which is the last input with the bytes from `start_byte` to `old_end_byte` replaced with the bytes
+// from `start_byte` to `new_end_byte`, reusing the declarations of the last signature that the edit does not touch.
+static VALUE incremental_signature_update(VALUE self, VALUE buffer, VALUE start_byte, VALUE old_end_byte, VALUE new_end_byte) {
+    rbs_lexer_edit_t edit = {
+        .start_byte = NUM2INT(start_byte),
+        .old_end_byte = NUM2INT(old_end_byte),
+        .new_end_byte = NUM2INT(new_end_byte),
+    };
+
+    return incremental_signature_parse_buffer(self, buffer, true, edit);
+}
+
+enum deserialize_kind {
+    DESERIALIZE_SIGNATURE,
+    DESERIALIZE_NODE,
+    DESERIALIZE_NODE_LIST,
+};
+
+struct deserialize_arg {
+    VALUE buffer;
+    rb_encoding *encoding;
+    enum deserialize_kind kind;
+    rbs_allocator_t *allocator;
+    rbs_constant_pool_t constant_pool;
+    uint8_t *bytes;
+    size_t length;
+};
+
+static VALUE deserialize_try(VALUE a) {
+    struct deserialize_arg *arg = (struct deserialize_arg *) a;
+
+    rbs_translation_context_t ctx = rbs_translation_context_create(
+        &arg->constant_pool,
+        arg->buffer,
+        arg->encoding
+    );
+
+    if (arg->kind == DESERIALIZE_NODE_LIST) {
+        rbs_node_list_t *list = rbs_deserialize_node_list(arg->allocator, &arg->constant_pool, arg->bytes, arg->length);
+        if (list == NULL) {
+            rb_raise(rb_eArgError, "broken serialized node list");
+        }
+
+        return rbs_node_list_to_ruby_array(ctx, list);
+    }
+
+    rbs_node_t *node = rbs_deserialize_node(arg->allocator, &arg->constant_pool, arg->bytes, arg->length);
+    if (node == NULL || (arg->kind == DESERIALIZE_SIGNATURE && node->type != RBS_SIGNATURE)) {
+        rb_raise(rb_eArgError, arg->kind == DESERIALIZE_SIGNATURE ? "broken serialized signature" : "broken serialized node");
+    }
+
+    return rbs_struct_to_ruby_value(ctx, node);
+}
+
+static VALUE ensure_free_deserialize(VALUE a) {
+    struct deserialize_arg *arg = (struct deserialize_arg *) a;
+
+    rbs_constant_pool_free(&arg->constant_pool);
+    return_parser_arena(arg->allocator);
+    free(arg->bytes);
+
+    return Qnil;
+}
+
+// Rebuilds the Ruby objects of `buffer` from bytes produced by the serializer,
+// through the same translation the `_parse_*` entry points use.
+// The bytes are copied, because the decoded tree points into them while the translation may run GC.
+static VALUE deserialize(VALUE buffer, VALUE bytes, enum deserialize_kind kind) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    StringValue(bytes);
+
+    struct deserialize_arg arg = {
+        .buffer = buffer,
+        .encoding = rb_enc_get(string),
+        .kind = kind,
+        .length = (size_t) RSTRING_LEN(bytes),
+    };
+
+    arg.bytes = (uint8_t *) malloc(arg.length > 0 ? arg.length : 1);
+    if (arg.bytes == NULL) {
+        rb_raise(rb_eNoMemError, "failed to allocate %zu bytes", arg.length);
+    }
+    memcpy(arg.bytes, RSTRING_PTR(bytes), arg.length);
+
+    arg.allocator = take_parser_arena();
+    rbs_constant_pool_init(&arg.constant_pool, 2);
+
+    VALUE result = rb_ensure(deserialize_try, (VALUE) &arg, ensure_free_deserialize, (VALUE) &arg);
+
+    RB_GC_GUARD(string);
+    RB_GC_GUARD(bytes);
+
+    return result;
+}
+
+// The inverse of `_parse_signature_to_bytes`.
+static VALUE rbsparser_deserialize_signature(VALUE self, VALUE buffer, VALUE bytes) {
+    return deserialize(buffer, bytes, DESERIALIZE_SIGNATURE);
+}
+
+static VALUE rbsparser_deserialize_node(VALUE self, VALUE buffer, VALUE bytes) {
+    return deserialize(buffer, bytes, DESERIALIZE_NODE);
+}
+
+static VALUE rbsparser_deserialize_node_list(VALUE self, VALUE buffer, VALUE bytes) {
+    return deserialize(buffer, bytes, DESERIALIZE_NODE_LIST);
+}
+
 struct parse_type_params_arg {
     VALUE buffer;
     rb_encoding *encoding;
@@ -588,50 +1494,216 @@ static VALUE rbsparser_parse_inline_trailing_annotation(VALUE self, VALUE buffer
     return result;
 }
 
+// Returns the arena stats of the last parse on the current fiber as a Hash, or nil if nothing has been parsed yet.
+static VALUE rbsparser_last_parse_stats(VALUE self) {
+    struct parser_arena *arena = current_parser_arena(false);
+    if (arena == NULL || !arena->has_last_stats) return Qnil;
+
+    rbs_allocator_stats_t stats = arena->last_stats;
+
+    VALUE hash = rb_hash_new();
+    rb_hash_aset(hash, ID2SYM(rb_intern("requested_bytes")), SIZET2NUM(stats.requested_bytes));
+    rb_hash_aset(hash, ID2SYM(rb_intern("alignment_bytes")), SIZET2NUM(stats.alignment_bytes));
+    rb_hash_aset(hash, ID2SYM(rb_intern("abandoned_bytes")), SIZET2NUM(stats.abandoned_bytes));
+    rb_hash_aset(hash, ID2SYM(rb_intern("slack_bytes")), SIZET2NUM(stats.slack_bytes));
+    rb_hash_aset(hash, ID2SYM(rb_intern("used_bytes")), SIZET2NUM(stats.used_bytes));
+    rb_hash_aset(hash, ID2SYM(rb_intern("capacity_bytes")), SIZET2NUM(stats.capacity_bytes));
+    rb_hash_aset(hash, ID2SYM(rb_intern("page_count")), SIZET2NUM(stats.page_count));
+    rb_hash_aset(hash, ID2SYM(rb_intern("large_page_count")), SIZET2NUM(stats.large_page_count));
+
+    return hash;
+}
+
+struct lex_arg {
+    VALUE buffer;
+    rbs_allocator_t *allocator;
+    rbs_lexer_t *lexer;
+    // Only for `_relex_packed`.
+    VALUE old_bytes;
+    rbs_lexer_edit_t edit;
+};
+
+static VALUE ensure_free_lexer(VALUE a) {
+    struct lex_arg *arg = (struct lex_arg *) a;
+    return_parser_arena(arg->allocator);
+    return Qnil;
+}
+
+static VALUE lex_try(VALUE a) {
+    struct lex_arg *arg = (struct lex_arg *) a;
+
+    size_t count;
+    rbs_token_t *tokens = rbs_lexer_tokenize_all(arg->lexer, &count);
+
+    VALUE results = rb_ary_new_capa((long) count);
+    for (size_t i = 0; i < count; i++) {
+        VALUE type = ID2SYM(rb_intern(rbs_token_type_str(tokens[i].type)));
+        VALUE location = rbs_new_location(arg->buffer, tokens[i].range);
+        VALUE pair = rb_ary_new3(2, type, location);
+        rb_ary_push(results, pair);
+    }
+
+    return results;
+}
+
 static VALUE rbsparser_lex(VALUE self, VALUE buffer, VALUE end_pos) {
     VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
     StringValue(string);
     rb_encoding *encoding = rb_enc_get(string);
 
-    rbs_allocator_t *allocator = rbs_allocator_init();
-    rbs_lexer_t *lexer = alloc_lexer_from_buffer(allocator, string, encoding, 0, FIX2INT(end_pos));
+    validate_position_range(string, 0, FIX2INT(end_pos));
 
-    VALUE results = rb_ary_new();
-    rbs_token_t token = NullToken;
-    while (token.type != pEOF) {
-        token = rbs_lexer_next_token(lexer);
-        VALUE type = ID2SYM(rb_intern(rbs_token_type_str(token.type)));
-        VALUE location = rbs_new_location(buffer, token.range);
-        VALUE pair = rb_ary_new3(2, type, location);
-        rb_ary_push(results, pair);
-    }
+    rbs_allocator_t *allocator = take_parser_arena();
+    struct lex_arg arg = {
+        .buffer = buffer,
+        .allocator = allocator,
+        .lexer = alloc_lexer_from_buffer(allocator, string, encoding, 0, FIX2INT(end_pos)),
+    };
+
+    VALUE results = rb_ensure(lex_try, (VALUE) &arg, ensure_free_lexer, (VALUE) &arg);
+
+    RB_GC_GUARD(string);
+
+    return results;
+}
+
+static VALUE lex_packed_try(VALUE a) {
+    struct lex_arg *arg = (struct lex_arg *) a;
+
+    size_t count;
+    rbs_token_t *tokens = rbs_lexer_tokenize_all(arg->lexer, &count);
+
+    VALUE results = rb_str_new(NULL, (long) (count * RBS_PACKED_TOKEN_SIZE));
+    rbs_pack_tokens(tokens, count, (uint8_t *) RSTRING_PTR(results));
+
+    return results;
+}
+
+static VALUE rbsparser_lex_packed(VALUE self, VALUE buffer, VALUE end_pos) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    rb_encoding *encoding = rb_enc_get(string);
+
+    validate_position_range(string, 0, FIX2INT(end_pos));
+
+    rbs_allocator_t *allocator = take_parser_arena();
+    struct lex_arg arg = {
+        .buffer = buffer,
+        .allocator = allocator,
+        .lexer = alloc_lexer_from_buffer(allocator, string, encoding, 0, FIX2INT(end_pos)),
+    };
+
+    VALUE results = rb_ensure(lex_packed_try, (VALUE) &arg, ensure_free_lexer, (VALUE) &arg);
 
-    rbs_allocator_free(allocator);
     RB_GC_GUARD(string);
 
     return results;
 }
 
+static VALUE relex_packed_try(VALUE a) {
+    struct lex_arg *arg = (struct lex_arg *) a;
+
+    size_t old_count = (size_t) RSTRING_LEN(arg->old_bytes) / RBS_PACKED_TOKEN_SIZE;
+    rbs_token_t *old_tokens = rbs_allocator_alloc_many(arg->allocator, old_count, rbs_token_t);
+    rbs_unpack_tokens((const uint8_t *) RSTRING_PTR(arg->old_bytes), old_count, old_tokens);
+
+    size_t count, relexed_start, relexed_count;
+    rbs_token_t *tokens = rbs_lexer_relex(arg->lexer, old_tokens, old_count, arg->edit, &count, &relexed_start, &relexed_count);
+
+    VALUE bytes = rb_str_new(NULL, (long) (count * RBS_PACKED_TOKEN_SIZE));
+    rbs_pack_tokens(tokens, count, (uint8_t *) RSTRING_PTR(bytes));
+
+    return rb_ary_new3(3, bytes, SIZET2NUM(relexed_start), SIZET2NUM(relexed_count));
+}
+
+static VALUE rbsparser_relex_packed(VALUE self, VALUE buffer, VALUE end_pos, VALUE old_bytes, VALUE start_byte, VALUE old_end_byte, VALUE new_end_byte) {
+    VALUE string = rb_funcall(buffer, rb_intern("content"), 0);
+    StringValue(string);
+    StringValue(old_bytes);
+    rb_encoding *encoding = rb_enc_get(string);
+
+    validate_position_range(string, 0, FIX2INT(end_pos));
+
+    rbs_lexer_edit_t edit = {
+        .start_byte = FIX2INT(start_byte),
+        .old_end_byte = FIX2INT(old_end_byte),
+        .new_end_byte = FIX2INT(new_end_byte),
+    };
+    if (edit.start_byte < 0 || edit.start_byte > edit.old_end_byte || edit.start_byte > edit.new_end_byte || edit.new_end_byte > FIX2INT(end_pos) || (long) edit.new_end_byte > RSTRING_LEN(string)) {
+        rb_raise(rb_eArgError, "invalid edit: %d...%d replaced with %d...%d", edit.start_byte, edit.old_end_byte, edit.start_byte, edit.new_end_byte);
+    }
+
+    if (!rbs_packed_tokens_valid_p((const uint8_t *) RSTRING_PTR(old_bytes), (size_t) RSTRING_LEN(old_bytes), edit, FIX2INT(end_pos))) {
+        rb_raise(rb_eArgError, "broken packed tokens");
+    }
+
+    rbs_allocator_t *allocator = take_parser_arena();
+    struct lex_arg arg = {
+        .buffer = buffer,
+        .allocator = allocator,
+        .lexer = alloc_lexer_from_buffer(allocator, string, encoding, 0, FIX2INT(end_pos)),
+        .old_bytes = old_bytes,
+        .edit = edit,
+    };
+
+    VALUE result = rb_ensure(relex_packed_try, (VALUE) &arg, ensure_free_lexer, (VALUE) &arg);
+
+    RB_GC_GUARD(string);
+    RB_GC_GUARD(old_bytes);
+
+    return result;
+}
+
+static VALUE rbsparser_token_types(VALUE self) {
+    return TOKEN_TYPES;
+}
+
 void rbs__init_parser(void) {
     RBS_Parser = rb_define_class_under(RBS, "Parser", rb_cObject);
     rb_gc_register_mark_object(RBS_Parser);
 
+    id_parser_arena = rb_intern("__rbs_parser_arena__");
+
     EMPTY_ARRAY = rb_obj_freeze(rb_ary_new());
     rb_gc_register_mark_object(EMPTY_ARRAY);
 
     EMPTY_HASH = rb_obj_freeze(rb_hash_new());
     rb_gc_register_mark_object(EMPTY_HASH);
 
+    TOKEN_TYPES = rb_ary_new_capa(RBS_TOKEN_TYPE_COUNT);
+    for (int type = 0; type < RBS_TOKEN_TYPE_COUNT; type++) {
+        rb_ary_push(TOKEN_TYPES, ID2SYM(rb_intern(rbs_token_type_str((enum RBSTokenType) type))));
+    }
+    rb_obj_freeze(TOKEN_TYPES);
+    rb_gc_register_mark_object(TOKEN_TYPES);
+
     rb_define_singleton_method(RBS_Parser, "_parse_type", rbsparser_parse_type, 8);
     rb_define_singleton_method(RBS_Parser, "_parse_method_type", rbsparser_parse_method_type, 6);
     rb_define_singleton_method(RBS_Parser, "_parse_signature", rbsparser_parse_signature, 4);
+    rb_define_singleton_method(RBS_Parser, "_parse_signature_with_errors", rbsparser_parse_signature_with_errors, 4);
+    rb_define_singleton_method(RBS_Parser, "_parse_signature_skeleton", rbsparser_parse_signature_skeleton, 3);
+    rb_define_singleton_method(RBS_Parser, "_parse_signatures", rbsparser_parse_signatures, 6);
+    rb_define_singleton_method(RBS_Parser, "_parse_method_overloads", rbsparser_parse_method_overloads, 6);
     rb_define_singleton_method(RBS_Parser, "_parse_type_to_bytes", rbsparser_parse_type_to_bytes, 8);
     rb_define_singleton_method(RBS_Parser, "_parse_method_type_to_bytes", rbsparser_parse_method_type_to_bytes, 6);
     rb_define_singleton_method(RBS_Parser, "_parse_signature_to_bytes", rbsparser_parse_signature_to_bytes, 4);
+    rb_define_singleton_method(RBS_Parser, "_deserialize_signature", rbsparser_deserialize_signature, 2);
+    rb_define_singleton_method(RBS_Parser, "_deserialize_node", rbsparser_deserialize_node, 2);
+    rb_define_singleton_method(RBS_Parser, "_deserialize_node_list", rbsparser_deserialize_node_list, 2);
     rb_define_singleton_method(RBS_Parser, "_parse_type_params", rbsparser_parse_type_params, 4);
     rb_define_singleton_method(RBS_Parser, "_parse_inline_leading_annotation", rbsparser_parse_inline_leading_annotation, 4);
     rb_define_singleton_method(RBS_Parser, "_parse_inline_trailing_annotation", rbsparser_parse_inline_trailing_annotation, 4);
     rb_define_singleton_method(RBS_Parser, "_lex", rbsparser_lex, 2);
+    rb_define_singleton_method(RBS_Parser, "_lex_packed", rbsparser_lex_packed, 2);
+    rb_define_singleton_method(RBS_Parser, "_relex_packed", rbsparser_relex_packed, 6);
+    rb_define_singleton_method(RBS_Parser, "_token_types", rbsparser_token_types, 0);
+    rb_define_singleton_method(RBS_Parser, "_last_parse_stats", rbsparser_last_parse_stats, 0);
+
+    VALUE RBS_Parser_IncrementalSignature = rb_define_class_under(RBS_Parser, "IncrementalSignature", rb_cObject);
+    rb_define_alloc_func(RBS_Parser_IncrementalSignature, incremental_signature_allocate);
+    rb_define_private_method(RBS_Parser_IncrementalSignature, "initialize", incremental_signature_initialize, 1);
+    rb_define_method(RBS_Parser_IncrementalSignature, "parse", incremental_signature_parse, 1);
+    rb_define_method(RBS_Parser_IncrementalSignature, "update", incremental_signature_update, 4);
 }
 
 static void Deinit_rbs_extension(ruby_vm_t *_) {
@@ -642,6 +1714,7 @@ void Init_rbs_extension(void) {
     rb_ext_ractor_safe(true);
 #endif
     rbs__init_constants();
+    rbs__init_ast_translation();
     rbs__init_location();
     rbs__init_parser();
 
@@ -87,57 +87,58 @@ enum rbs_node_type {
     RBS_AST_MEMBERS_INCLUDE = 25,
     RBS_AST_MEMBERS_INSTANCE_VARIABLE = 26,
     RBS_AST_MEMBERS_METHOD_DEFINITION = 27,
-    RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD = 28,
-    RBS_AST_MEMBERS_PREPEND = 29,
-    RBS_AST_MEMBERS_PRIVATE = 30,
-    RBS_AST_MEMBERS_PUBLIC = 31,
-    RBS_AST_RUBY_ANNOTATIONS_BLOCK_PARAM_TYPE_ANNOTATION = 32,
-    RBS_AST_RUBY_ANNOTATIONS_CLASS_ALIAS_ANNOTATION = 33,
-    RBS_AST_RUBY_ANNOTATIONS_COLON_METHOD_TYPE_ANNOTATION = 34,
-    RBS_AST_RUBY_ANNOTATIONS_DOUBLE_SPLAT_PARAM_TYPE_ANNOTATION = 35,
-    RBS_AST_RUBY_ANNOTATIONS_INSTANCE_VARIABLE_ANNOTATION = 36,
-    RBS_AST_RUBY_ANNOTATIONS_METHOD_TYPES_ANNOTATION = 37,
-    RBS_AST_RUBY_ANNOTATIONS_MODULE_ALIAS_ANNOTATION = 38,
-    RBS_AST_RUBY_ANNOTATIONS_MODULE_SELF_ANNOTATION = 39,
-    RBS_AST_RUBY_ANNOTATIONS_NODE_TYPE_ASSERTION = 40,
-    RBS_AST_RUBY_ANNOTATIONS_PARAM_TYPE_ANNOTATION = 41,
-    RBS_AST_RUBY_ANNOTATIONS_RETURN_TYPE_ANNOTATION = 42,
-    RBS_AST_RUBY_ANNOTATIONS_SKIP_ANNOTATION = 43,
-    RBS_AST_RUBY_ANNOTATIONS_SPLAT_PARAM_TYPE_ANNOTATION = 44,
-    RBS_AST_RUBY_ANNOTATIONS_TYPE_APPLICATION_ANNOTATION = 45,
-    RBS_AST_STRING = 46,
-    RBS_AST_TYPE_PARAM = 47,
-    RBS_METHOD_TYPE = 48,
-    RBS_NAMESPACE = 49,
-    RBS_SIGNATURE = 50,
-    RBS_TYPE_NAME = 51,
-    RBS_TYPES_ALIAS = 52,
-    RBS_TYPES_BASES_ANY = 53,
-    RBS_TYPES_BASES_BOOL = 54,
-    RBS_TYPES_BASES_BOTTOM = 55,
-    RBS_TYPES_BASES_CLASS = 56,
-    RBS_TYPES_BASES_INSTANCE = 57,
-    RBS_TYPES_BASES_NIL = 58,
-    RBS_TYPES_BASES_SELF = 59,
-    RBS_TYPES_BASES_TOP = 60,
-    RBS_TYPES_BASES_VOID = 61,
-    RBS_TYPES_BLOCK = 62,
-    RBS_TYPES_CLASS_INSTANCE = 63,
-    RBS_TYPES_CLASS_SINGLETON = 64,
-    RBS_TYPES_FUNCTION = 65,
-    RBS_TYPES_FUNCTION_FORWARDING_PARAM = 66,
-    RBS_TYPES_FUNCTION_PARAM = 67,
-    RBS_TYPES_INTERFACE = 68,
-    RBS_TYPES_INTERSECTION = 69,
-    RBS_TYPES_LITERAL = 70,
-    RBS_TYPES_OPTIONAL = 71,
-    RBS_TYPES_PROC = 72,
-    RBS_TYPES_RECORD = 73,
-    RBS_TYPES_RECORD_FIELD_TYPE = 74,
-    RBS_TYPES_TUPLE = 75,
-    RBS_TYPES_UNION = 76,
-    RBS_TYPES_UNTYPED_FUNCTION = 77,
-    RBS_TYPES_VARIABLE = 78,
+    RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS = 28,
+    RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD = 29,
+    RBS_AST_MEMBERS_PREPEND = 30,
+    RBS_AST_MEMBERS_PRIVATE = 31,
+    RBS_AST_MEMBERS_PUBLIC = 32,
+    RBS_AST_RUBY_ANNOTATIONS_BLOCK_PARAM_TYPE_ANNOTATION = 33,
+    RBS_AST_RUBY_ANNOTATIONS_CLASS_ALIAS_ANNOTATION = 34,
+    RBS_AST_RUBY_ANNOTATIONS_COLON_METHOD_TYPE_ANNOTATION = 35,
+    RBS_AST_RUBY_ANNOTATIONS_DOUBLE_SPLAT_PARAM_TYPE_ANNOTATION = 36,
+    RBS_AST_RUBY_ANNOTATIONS_INSTANCE_VARIABLE_ANNOTATION = 37,
+    RBS_AST_RUBY_ANNOTATIONS_METHOD_TYPES_ANNOTATION = 38,
+    RBS_AST_RUBY_ANNOTATIONS_MODULE_ALIAS_ANNOTATION = 39,
+    RBS_AST_RUBY_ANNOTATIONS_MODULE_SELF_ANNOTATION = 40,
+    RBS_AST_RUBY_ANNOTATIONS_NODE_TYPE_ASSERTION = 41,
+    RBS_AST_RUBY_ANNOTATIONS_PARAM_TYPE_ANNOTATION = 42,
+    RBS_AST_RUBY_ANNOTATIONS_RETURN_TYPE_ANNOTATION = 43,
+    RBS_AST_RUBY_ANNOTATIONS_SKIP_ANNOTATION = 44,
+    RBS_AST_RUBY_ANNOTATIONS_SPLAT_PARAM_TYPE_ANNOTATION = 45,
+    RBS_AST_RUBY_ANNOTATIONS_TYPE_APPLICATION_ANNOTATION = 46,
+    RBS_AST_STRING = 47,
+    RBS_AST_TYPE_PARAM = 48,
+    RBS_METHOD_TYPE = 49,
+    RBS_NAMESPACE = 50,
+    RBS_SIGNATURE = 51,
+    RBS_TYPE_NAME = 52,
+    RBS_TYPES_ALIAS = 53,
+    RBS_TYPES_BASES_ANY = 54,
+    RBS_TYPES_BASES_BOOL = 55,
+    RBS_TYPES_BASES_BOTTOM = 56,
+    RBS_TYPES_BASES_CLASS = 57,
+    RBS_TYPES_BASES_INSTANCE = 58,
+    RBS_TYPES_BASES_NIL = 59,
+    RBS_TYPES_BASES_SELF = 60,
+    RBS_TYPES_BASES_TOP = 61,
+    RBS_TYPES_BASES_VOID = 62,
+    RBS_TYPES_BLOCK = 63,
+    RBS_TYPES_CLASS_INSTANCE = 64,
+    RBS_TYPES_CLASS_SINGLETON = 65,
+    RBS_TYPES_FUNCTION = 66,
+    RBS_TYPES_FUNCTION_FORWARDING_PARAM = 67,
+    RBS_TYPES_FUNCTION_PARAM = 68,
+    RBS_TYPES_INTERFACE = 69,
+    RBS_TYPES_INTERSECTION = 70,
+    RBS_TYPES_LITERAL = 71,
+    RBS_TYPES_OPTIONAL = 72,
+    RBS_TYPES_PROC = 73,
+    RBS_TYPES_RECORD = 74,
+    RBS_TYPES_RECORD_FIELD_TYPE = 75,
+    RBS_TYPES_TUPLE = 76,
+    RBS_TYPES_UNION = 77,
+    RBS_TYPES_UNTYPED_FUNCTION = 78,
+    RBS_TYPES_VARIABLE = 79,
     RBS_AST_SYMBOL,
 };
 
@@ -148,47 +149,83 @@ typedef struct rbs_node {
 
 const char *RBS_NONNULL rbs_node_type_name(rbs_node_t *RBS_NONNULL node);
 
-/* rbs_node_list_node */
-
-typedef struct rbs_node_list_node {
-    rbs_node_t *RBS_NONNULL node;
-    struct rbs_node_list_node *RBS_NULLABLE next;
-} rbs_node_list_node_t;
+/* rbs_node_list */
 
+/**
+ * A list of nodes, in an array in the arena that grows as nodes are appended.
+ *
+ * The nodes are `items[0]` to `items[length - 1]`, and `items` is `NULL` until the first node is appended.
+ * */
 typedef struct rbs_node_list {
-    rbs_allocator_t *RBS_NONNULL allocator;
-    rbs_node_list_node_t *RBS_NULLABLE head;
-    rbs_node_list_node_t *RBS_NULLABLE tail;
+    rbs_allocator_t *RBS_NULLABLE allocator; /* `NULL` for the list returned by `rbs_node_list_empty` */
+    rbs_node_t *RBS_NONNULL *RBS_NULLABLE items;
     size_t length;
+    size_t capacity;
 } rbs_node_list_t;
 
 rbs_node_list_t *RBS_NONNULL rbs_node_list_new(rbs_allocator_t *RBS_NONNULL);
 
+/**
+ * Allocates a list with room for `capacity` nodes, for a list whose length is known beforehand.
+ * */
+rbs_node_list_t *RBS_NONNULL rbs_node_list_new_with_capacity(rbs_allocator_t *RBS_NONNULL, size_t capacity);
+
 void rbs_node_list_append(rbs_node_list_t *RBS_NONNULL list, rbs_node_t *RBS_NONNULL node);
 
+/**
+ * Returns the list without nodes that is shared by all the empty lists in the AST, like the annotations of most members.
+ * It saves the parser from allocating a list for each of them, and it must not be appended to.
+ * */
+rbs_node_list_t *RBS_NONNULL rbs_node_list_empty(void);
+
 /* rbs_hash */
 
 typedef struct rbs_hash_node {
     rbs_node_t *RBS_NONNULL key;
     rbs_node_t *RBS_NONNULL value;
-    struct rbs_hash_node *RBS_NULLABLE next;
 } rbs_hash_node_t;
 
+/**
+ * A map from nodes to nodes that keeps the insertion order, like the keywords of a function or the fields of a record.
+ *
+ * The entries are `entries[0]` to `entries[length - 1]`, and `entries` is `NULL` until the first entry is set. Once the
+ * hash has a few entries, the ones with symbol keys are also in `index`, an open-addressed table of `index_capacity`
+ * slots keyed on the constant id, so that looking a keyword up doesn't compare it with every other keyword.
+ * */
 typedef struct rbs_hash {
-    rbs_allocator_t *RBS_NONNULL allocator;
-    rbs_hash_node_t *RBS_NULLABLE head;
-    rbs_hash_node_t *RBS_NULLABLE tail;
+    rbs_allocator_t *RBS_NULLABLE allocator; /* `NULL` for the hash returned by `rbs_hash_empty` */
+    rbs_hash_node_t *RBS_NULLABLE entries;
     size_t length;
+    size_t capacity;
+    uint32_t *RBS_NULLABLE index; /* The position of an entry in `entries` plus one, or 0 for an empty slot */
+    size_t index_capacity;
 } rbs_hash_t;
 
 rbs_hash_t *RBS_NONNULL rbs_hash_new(rbs_allocator_t *RBS_NONNULL);
 
 void rbs_hash_set(rbs_hash_t *RBS_NONNULL hash, rbs_node_t *RBS_NONNULL key, rbs_node_t *RBS_NONNULL value);
 
+/**
+ * Returns the entry of `key`, which is valid until the next `rbs_hash_set`.
+ * */
 rbs_hash_node_t *RBS_NULLABLE rbs_hash_find(rbs_hash_t *RBS_NONNULL hash, rbs_node_t *RBS_NONNULL key);
 
 rbs_node_t *RBS_NULLABLE rbs_hash_get(rbs_hash_t *RBS_NONNULL hash, rbs_node_t *RBS_NONNULL key);
 
+/**
+ * Returns the hash without entries that is shared by all the empty hashes in the AST, like the keywords of most functions.
+ * It must not be set to.
+ * */
+rbs_hash_t *RBS_NONNULL rbs_hash_empty(void);
+
+/**
+ * Moves every location in the tree under `node` by `char_delta` characters and `byte_delta` bytes.
+ *
+ * Null location ranges are left as they are. The tree is updated in place, so a node has to be reachable through
+ * one path only, which is the case for the trees the parser builds.
+ * */
+void rbs_node_shift_locations(rbs_node_t *RBS_NULLABLE node, int char_delta, int byte_delta);
+
 /* rbs_ast_node */
 
 typedef struct rbs_ast_annotation {
@@ -536,6 +573,13 @@ typedef struct rbs_ast_members_method_definition {
     rbs_location_range visibility_range;  /* Optional */
 } rbs_ast_members_method_definition_t;
 
+typedef struct rbs_ast_members_method_definition_lazy_overloads {
+    rbs_node_t base;
+
+    struct rbs_node_list *RBS_NONNULL variables;
+    bool classish_allowed;
+} rbs_ast_members_method_definition_lazy_overloads_t;
+
 typedef struct rbs_ast_members_method_definition_overload {
     rbs_node_t base;
 
@@ -1000,6 +1044,7 @@ rbs_ast_members_extend_t *RBS_NONNULL rbs_ast_members_extend_new(rbs_allocator_t
 rbs_ast_members_include_t *RBS_NONNULL rbs_ast_members_include_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range keyword_range);
 rbs_ast_members_instance_variable_t *RBS_NONNULL rbs_ast_members_instance_variable_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range colon_range);
 rbs_ast_members_method_definition_t *RBS_NONNULL rbs_ast_members_method_definition_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, enum rbs_method_definition_kind kind, rbs_node_list_t *RBS_NONNULL overloads, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, bool overloading, enum rbs_method_definition_visibility visibility, rbs_location_range keyword_range, rbs_location_range name_range);
+rbs_ast_members_method_definition_lazy_overloads_t *RBS_NONNULL rbs_ast_members_method_definition_lazy_overloads_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL variables, bool classish_allowed);
 rbs_ast_members_method_definition_overload_t *RBS_NONNULL rbs_ast_members_method_definition_overload_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL annotations, rbs_node_t *RBS_NONNULL method_type);
 rbs_ast_members_prepend_t *RBS_NONNULL rbs_ast_members_prepend_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range keyword_range);
 rbs_ast_members_private_t *RBS_NONNULL rbs_ast_members_private_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location);
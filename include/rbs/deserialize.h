@@ -0,0 +1,46 @@
+/*----------------------------------------------------------------------------*/
+/* This file is generated by the templates/template.rb script and should not  */
+/* be modified manually.                                                      */
+/* To change the template see                                                 */
+/* templates/include/rbs/deserialize.h.erb                                    */
+/*----------------------------------------------------------------------------*/
+
+#ifndef RBS__DESERIALIZE_H
+#define RBS__DESERIALIZE_H
+
+#include "rbs/ast.h"
+#include "rbs/util/rbs_allocator.h"
+#include "rbs/util/rbs_constant_pool.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Rebuild an AST node from the binary buffer produced by rbs_serialize_node.
+ *
+ * This is the C counterpart of RBS::WASM::Deserializer: the nodes are allocated
+ * from `allocator` and the symbols are interned into `constant_pool`, so the
+ * result can be handed to anything that consumes a parsed tree (e.g. the C
+ * extension's translation to Ruby objects).
+ *
+ * Symbol names and string fields point into `bytes` instead of being copied,
+ * so `bytes` must outlive the returned tree.
+ *
+ * The format only carries character positions, so the byte positions of the
+ * decoded location ranges are -1. Nodes the format encodes without a location
+ * (symbols, type names, namespaces, ...) get RBS_LOCATION_NULL_RANGE.
+ *
+ * Returns NULL if the buffer is truncated, has trailing bytes, or does not
+ * describe a well-formed tree.
+ *
+ * See `docs/wasm_serialization.md` for the wire format.
+ */
+rbs_node_t *rbs_deserialize_node(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, const uint8_t *bytes, size_t length);
+
+/**
+ * Like rbs_deserialize_node, but for a bare node list (the result of
+ * rbs_serialize_node_list).
+ */
+rbs_node_list_t *rbs_deserialize_node_list(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, const uint8_t *bytes, size_t length);
+
+#endif
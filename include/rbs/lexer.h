@@ -102,16 +102,19 @@ enum RBSTokenType {
 };
 
 /**
- * The `byte_pos` (or `char_pos`) is the primary data.
- * The rest are cache.
+ * The number of token types, which are numbered from `NullType` to `tANNOTATION`.
+ * */
+#define RBS_TOKEN_TYPE_COUNT (tANNOTATION + 1)
+
+/**
+ * The `byte_pos` is the primary data, and the `char_pos` is a cache.
  *
- * They can be computed from `byte_pos` (or `char_pos`), but it needs full scan from the beginning of the string (depending on the encoding).
+ * The `char_pos` can be computed from `byte_pos`, but it needs full scan from the beginning of the string (depending on the encoding).
+ * The line of a position is looked up in the lines of the lexer with `rbs_lexer_line`.
  * */
 typedef struct {
     int byte_pos;
     int char_pos;
-    int line;
-    int column;
 } rbs_position_t;
 
 typedef struct {
@@ -122,8 +125,14 @@ typedef struct {
 typedef struct {
     enum RBSTokenType type;
     rbs_range_t range;
+    uint32_t hash; /* `rbs_constant_pool_hash` of the token for identifiers (see `RBS_TOKEN_HASHED_P`), 0 otherwise */
 } rbs_token_t;
 
+/**
+ * The identifier tokens, which the lexer hashes so that the parser interns them without reading them again.
+ * */
+#define RBS_TOKEN_HASHED_P(type) ((type) >= tLIDENT && (type) <= tEQIDENT)
+
 /**
  * The lexer state is the curren token.
  *
@@ -147,10 +156,44 @@ typedef struct {
     size_t current_character_bytes;  /* Current character byte length (0 or 1~4) */
 
     bool first_token_of_line; /* This flag is used for tLINECOMMENT */
+    bool ascii_only;          /* The input is all ASCII, so the lexer reads a byte as a character */
 
     const rbs_encoding_t *encoding;
+
+    rbs_allocator_t *allocator; /* The allocator of the lexer, which the line table is allocated from */
+    int *line_starts;           /* The byte positions where the lines of the input start, or `NULL` until a line is asked for */
+    int line_count;             /* The number of lines of the input, which starts with `line_starts[0] == 0` */
 } rbs_lexer_t;
 
+/**
+ * The part of the lexer state that reading a character changes.
+ *
+ * The lexer saves it with `rbs_lexer_save` before it reads past a token it may have to back up to, and restores it
+ * with `rbs_lexer_restore`, instead of copying the whole `rbs_lexer_t`.
+ * */
+typedef struct {
+    rbs_position_t current;
+    unsigned int current_code_point;
+    size_t current_character_bytes;
+    bool first_token_of_line;
+} rbs_lexer_cursor_t;
+
+static inline rbs_lexer_cursor_t rbs_lexer_save(const rbs_lexer_t *lexer) {
+    rbs_lexer_cursor_t cursor;
+    cursor.current = lexer->current;
+    cursor.current_code_point = lexer->current_code_point;
+    cursor.current_character_bytes = lexer->current_character_bytes;
+    cursor.first_token_of_line = lexer->first_token_of_line;
+    return cursor;
+}
+
+static inline void rbs_lexer_restore(rbs_lexer_t *lexer, rbs_lexer_cursor_t cursor) {
+    lexer->current = cursor.current;
+    lexer->current_code_point = cursor.current_code_point;
+    lexer->current_character_bytes = cursor.current_character_bytes;
+    lexer->first_token_of_line = cursor.first_token_of_line;
+}
+
 extern const rbs_token_t NullToken;
 extern const rbs_position_t NullPosition;
 extern const rbs_range_t NULL_RANGE;
@@ -184,6 +227,14 @@ void rbs_skip(rbs_lexer_t *lexer);
  * */
 bool rbs_next_char(rbs_lexer_t *lexer, unsigned int *codepoint, size_t *bytes);
 
+/**
+ * Returns the line, starting from 1, of the given byte position.
+ *
+ * The lexer does not count lines as it reads the input. The first call indexes the lines of the input up to `end_pos`,
+ * and the rest look the position up in the index.
+ * */
+int rbs_lexer_line(rbs_lexer_t *lexer, int byte_pos);
+
 /**
  * Skip n characters.
  * */
@@ -199,8 +250,118 @@ rbs_token_t rbs_next_token(rbs_lexer_t *lexer, enum RBSTokenType type);
  * */
 rbs_token_t rbs_next_eof_token(rbs_lexer_t *lexer);
 
+/**
+ * Reads the tokens that make up most of a signature file without the generated lexer: spaces, new lines, comments, and
+ * identifiers and keywords made of ASCII characters. The runs of spaces, comments and identifier characters are scanned
+ * in bulk (see `rbs_scan.h`).
+ *
+ * Returns `true` and stores the token if the next token is one of them, or `false` without moving the lexer otherwise.
+ * */
+bool rbs_lexer_scan_token(rbs_lexer_t *lexer, rbs_token_t *token);
+
+/**
+ * `rbs_lexer_scan_token` for the lexer of an input that is all ASCII, which reads a byte as a character.
+ * */
+bool rbs_lexer_scan_token_ascii(rbs_lexer_t *lexer, rbs_token_t *token);
+
+/**
+ * Returns the next token.
+ *
+ * Runs `rbs_lexer_next_token_ascii` if the input is all ASCII, or `rbs_lexer_next_token_generic` otherwise.
+ * */
 rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer);
 
+/**
+ * The lexer generated from `lexer.re`, which reads the input in any ASCII compatible encoding.
+ * */
+rbs_token_t rbs_lexer_next_token_generic(rbs_lexer_t *lexer);
+
+/**
+ * The lexer generated from `lexer.re`, compiled again for the input that is all ASCII (see `lexer_ascii.c`).
+ * */
+rbs_token_t rbs_lexer_next_token_ascii(rbs_lexer_t *lexer);
+
+/**
+ * Lexes the rest of the input into an array of tokens, which ends with the pEOF token.
+ *
+ * The array is allocated from the allocator of the lexer, and `count` is set to the number of the tokens in it.
+ * */
+rbs_token_t *rbs_lexer_tokenize_all(rbs_lexer_t *lexer, size_t *count);
+
+/**
+ * A point between two tokens, which `rbs_lexer_resume` lexes again from.
+ * */
+typedef struct {
+    rbs_position_t position;  /* The start position of the next token */
+    bool first_token_of_line; /* The tokens since the last newline are all trivia */
+} rbs_lexer_checkpoint_t;
+
+/**
+ * Returns the point between the last token and the next token of the lexer.
+ * */
+rbs_lexer_checkpoint_t rbs_lexer_checkpoint(const rbs_lexer_t *lexer);
+
+/**
+ * Moves the lexer to `checkpoint`, so that the next token is lexed from there.
+ *
+ * The checkpoint may come from another lexer, of an earlier version of the input: the character at the position is read
+ * again from the input of this lexer. The position has to be a character boundary of the input, and lexing from it
+ * gives the same tokens as lexing the input from the start does only if the same tokens end there.
+ * */
+void rbs_lexer_resume(rbs_lexer_t *lexer, rbs_lexer_checkpoint_t checkpoint);
+
+/**
+ * An edit of the input: the bytes from `start_byte` to `old_end_byte` are replaced with the bytes from `start_byte` to
+ * `new_end_byte` of the new input.
+ * */
+typedef struct {
+    int start_byte;
+    int old_end_byte;
+    int new_end_byte;
+} rbs_lexer_edit_t;
+
+/**
+ * Lexes the input of the lexer, which is the input of `old_tokens` with `edit` applied, into an array of tokens.
+ *
+ * Only the lines around the edit are lexed again. Lexing starts at the start of the line of `edit.start_byte`, and stops
+ * at the first line after the edit that starts at a token of `old_tokens`: the rest of the tokens are the same as the
+ * old ones from there, moved by the length of the edit. `old_tokens` are the tokens of `rbs_lexer_tokenize_all` for the
+ * whole of the old input, ending with the pEOF token.
+ *
+ * The array is allocated from the allocator of the lexer, and `count` is set to the number of the tokens in it.
+ * `relexed_start` and `relexed_count` are set to the range of the tokens that were lexed again.
+ * */
+rbs_token_t *rbs_lexer_relex(rbs_lexer_t *lexer, const rbs_token_t *old_tokens, size_t old_count, rbs_lexer_edit_t edit, size_t *count, size_t *relexed_start, size_t *relexed_count);
+
+/**
+ * The size of a token packed by `rbs_pack_tokens`.
+ * */
+#define RBS_PACKED_TOKEN_SIZE 17
+
+/**
+ * Writes the tokens to `out`, which has room for `count * RBS_PACKED_TOKEN_SIZE` bytes.
+ *
+ * A packed token is the type as a u8, and the start and end character positions and the start and end byte positions of
+ * the token as little endian u32s. This is the format of `RBS::Parser._lex_packed`, which reads the tokens without
+ * allocating an object for each.
+ * */
+void rbs_pack_tokens(const rbs_token_t *tokens, size_t count, uint8_t *out);
+
+/**
+ * Reads `count` tokens packed by `rbs_pack_tokens` from `in`. The `hash` of the tokens is not packed, and is read as 0.
+ * */
+void rbs_unpack_tokens(const uint8_t *in, size_t count, rbs_token_t *tokens);
+
+/**
+ * Whether the `size` bytes at `in` can be the packed tokens that `rbs_lexer_relex` takes with `edit`, for a new input of
+ * `end_pos` bytes: every token has a type, their character and byte ranges are in order and within the old input, the
+ * last token is pEOF, and the edit is within the tokens.
+ *
+ * `rbs_lexer_relex` reads the input at the positions of the old tokens, so the tokens a caller passes in have to be
+ * checked first.
+ * */
+bool rbs_packed_tokens_valid_p(const uint8_t *in, size_t size, rbs_lexer_edit_t edit, int end_pos);
+
 void rbs_print_token(rbs_token_t tok);
 
 void rbs_print_lexer(rbs_lexer_t *lexer);
@@ -26,6 +26,7 @@
 typedef struct rbs_comment_t {
     rbs_position_t start;
     rbs_position_t end;
+    int end_line; /* The line of `end` */
 
     size_t line_tokens_capacity;
     size_t line_tokens_count;
@@ -38,6 +39,7 @@ typedef struct rbs_error_t {
     char *message;
     rbs_token_t token;
     bool syntax_error;
+    struct rbs_error_t *next; /* The next error the parser recovered from (see `recover_errors`) */
 } rbs_error_t;
 
 /**
@@ -53,6 +55,35 @@ typedef struct {
      * The syntax is experimental and disabled by default.
      * */
     bool enable_forwarding_params;
+
+    /**
+     * Keep parsing a signature after a syntax error.
+     *
+     * `rbs_parse_signature` skips to the next line that starts a member or a declaration, and parses on from there.
+     * It returns the signature of the rest, with the errors in `errors` of the parser, and the first of them in
+     * `error`. The first error is the one that the parser reports without the option. Internal errors, which are
+     * not syntax errors, are recorded in the list too.
+     * */
+    bool recover_errors;
+
+    /**
+     * Give the method types of `def` members as their text, instead of as nodes.
+     *
+     * The overloads of a method definition are parsed, so that `rbs_parse_signature` reports syntax errors in them,
+     * but given as one `rbs_ast_members_method_definition_lazy_overloads_t` node, whose location is the text of the
+     * overloads. `rbs_parse_method_overloads` parses the text again when the overloads are used.
+     * */
+    bool lazy_overloads;
+
+    /**
+     * Skip the types of declarations and members, for indexing the names only.
+     *
+     * The overloads of `def` members are scanned only for the end of them, and given as with `lazy_overloads`. The
+     * types of constants, globals, type aliases, attributes and variables are scanned the same way, and given as
+     * `untyped` at the location of their text. Syntax errors inside the skipped types are not reported. The names,
+     * type parameters, super classes and mixins are parsed as usual.
+     * */
+    bool skeleton;
 } rbs_parser_options_t;
 
 /**
@@ -71,7 +102,10 @@ typedef struct {
 
     rbs_constant_pool_t constant_pool;
     rbs_allocator_t *allocator;
+    bool owns_allocator; /* `rbs_parser_free` frees the allocator too */
     rbs_error_t *error;
+    rbs_error_t *errors;     /* The errors recovered from, linked by `next` */
+    rbs_error_t *last_error; /* The last of `errors` */
 
     rbs_parser_options_t options;
 } rbs_parser_t;
@@ -134,6 +168,34 @@ RBS_NODISCARD rbs_parser_t *rbs_parser_new(rbs_string_t string, const rbs_encodi
  * Returns `NULL` for a `start_pos` that `rbs_lexer_new` rejects.
  * */
 RBS_NODISCARD rbs_parser_t *rbs_parser_new_with_options(rbs_string_t string, const rbs_encoding_t *encoding, int start_pos, int end_pos, rbs_parser_options_t options);
+
+/**
+ * Allocate new rbs_parser_t object in an allocator owned by the caller.
+ *
+ * The parser and the AST it builds live in `allocator`, which `rbs_parser_free` leaves alone.
+ * The caller can `rbs_allocator_reset` the allocator after freeing the parser, and use it for the next parser,
+ * so that a sequence of short parses doesn't allocate and free the same pages over and over.
+ *
+ * ```
+ * rbs_allocator_t *allocator = rbs_allocator_init();
+ * rbs_parser_t *parser = rbs_parser_new_with_allocator(allocator, string, encoding, 0, 10, options);
+ * ...
+ * rbs_parser_free(parser);
+ * rbs_allocator_reset(allocator, SIZE_MAX);
+ * ```
+ *
+ * Returns `NULL` for a `start_pos` that `rbs_lexer_new` rejects.
+ * */
+RBS_NODISCARD rbs_parser_t *rbs_parser_new_with_allocator(rbs_allocator_t *allocator, rbs_string_t string, const rbs_encoding_t *encoding, int start_pos, int end_pos, rbs_parser_options_t options);
+
+/**
+ * Make the parser intern the constants it finds into a global constant pool, instead of a pool of its own.
+ *
+ * The constant ids of the AST the parser builds are then the ids in the global pool, which are stable across parses and
+ * threads. Call it right after creating the parser, before parsing anything.
+ * */
+void rbs_parser_use_global_constant_pool(rbs_parser_t *parser, rbs_global_constant_pool_t *global);
+
 void rbs_parser_free(rbs_parser_t *parser);
 
 /**
@@ -141,6 +203,22 @@ void rbs_parser_free(rbs_parser_t *parser);
  * */
 void rbs_parser_advance(rbs_parser_t *parser);
 
+/**
+ * Moves the parser to `checkpoint` of the input, and reads the lookahead tokens from there.
+ *
+ * The comments read so far are dropped. This is how to start parsing in the middle of the input at a known position,
+ * without the lexer counting the characters up to it.
+ * */
+void rbs_parser_resume(rbs_parser_t *parser, rbs_lexer_checkpoint_t checkpoint);
+
+/**
+ * Moves the parser to read the input from `start` up to `end_pos`, like `rbs_parser_resume`.
+ *
+ * A parser created for the empty range at the beginning of the input reads nothing before this, so it starts parsing at
+ * `start` without lexing or scanning the text before it.
+ * */
+void rbs_parser_seek(rbs_parser_t *parser, rbs_lexer_checkpoint_t start, int end_pos);
+
 void rbs_parser_print(rbs_parser_t *parser);
 
 /**
@@ -164,8 +242,38 @@ bool rbs_parse_type(rbs_parser_t *parser, rbs_node_t **type, bool void_allowed,
 bool rbs_parse_method_type(rbs_parser_t *parser, rbs_method_type_t **method_type, bool require_eof, bool classish_allowed);
 bool rbs_parse_signature(rbs_parser_t *parser, rbs_signature_t **signature);
 
+/**
+ * Parses a signature with the `skeleton` option turned on: the declarations and the members with their names, but not
+ * their types.
+ * */
+bool rbs_parse_signature_skeleton(rbs_parser_t *parser, rbs_signature_t **signature);
+
+/**
+ * Parses the input of the parser, which is the input of `previous` with `edit` applied, reusing the declarations of
+ * `previous` that the edit does not touch.
+ *
+ * The declarations before the edit are reused as they are, and parsing starts after them. Once a new declaration past
+ * the edit ends where an old one did, the rest of the old declarations are moved by the size of the edit and reused.
+ * The result is the same as `rbs_parse_signature` on the new input.
+ *
+ * `previous` has to be allocated by the allocator of the parser, and its names interned into the same global constant
+ * pool (see `rbs_parser_use_global_constant_pool`). The declarations after the edit are updated in place, so `previous`
+ * cannot be used afterwards, and the reused declarations may point into the text of the previous input, which has to
+ * outlive the result.
+ * */
+bool rbs_parse_signature_incremental(rbs_parser_t *parser, rbs_signature_t *previous, rbs_lexer_edit_t edit, rbs_signature_t **signature);
+
 bool rbs_parse_type_params(rbs_parser_t *parser, bool module_type_params, rbs_node_list_t **params);
 
+/**
+ * Parses the overloads of a method definition, the method types separated by `|`, up to the end of the input.
+ *
+ * This is the second half of the `lazy_overloads` option: the input is the location of a
+ * `rbs_ast_members_method_definition_lazy_overloads_t`, and the type variables of the node have to be inserted into the
+ * parser beforehand.
+ * */
+bool rbs_parse_method_overloads(rbs_parser_t *parser, bool classish_allowed, rbs_node_list_t **overloads);
+
 /**
  * Parse an inline leading annotation from a string.
  *
@@ -36,4 +36,48 @@ rbs_string_t rbs_serialize_node(rbs_allocator_t *allocator, rbs_constant_pool_t
  */
 rbs_string_t rbs_serialize_node_list(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, rbs_node_list_t *list);
 
+/**
+ * The state of a serialization, kept between its two passes over the tree.
+ *
+ * rbs_serializer_measure_node walks the tree without writing anything: it counts
+ * the bytes and collects the constants the tree refers to, in the order of their
+ * first reference. rbs_serializer_write_node then writes the constant table and
+ * the tree straight into a buffer of that size, like a Ruby string or the
+ * WebAssembly result buffer, so nothing is grown or copied afterwards.
+ *
+ * The tables are allocated from `allocator`.
+ */
+typedef struct {
+    rbs_allocator_t *allocator;
+    rbs_constant_pool_t *constant_pool;
+
+    rbs_constant_id_t *constants; /* The constant table, in the order of the first reference */
+    uint32_t constants_count;
+    uint32_t constants_capacity;
+    uint32_t *index; /* The position of a constant in `constants` plus one, or 0 for an empty slot */
+    uint32_t index_capacity;
+
+    char *output; /* NULL while measuring */
+    size_t size;
+} rbs_serializer_t;
+
+void rbs_serializer_init(rbs_serializer_t *serializer, rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool);
+
+/**
+ * Returns the number of bytes that rbs_serializer_write_node writes for `node`.
+ */
+size_t rbs_serializer_measure_node(rbs_serializer_t *serializer, rbs_node_t *node);
+
+/**
+ * Writes the serialization of `node`, which must be the node just measured, into
+ * `output`, which must have room for the measured number of bytes.
+ */
+void rbs_serializer_write_node(rbs_serializer_t *serializer, rbs_node_t *node, char *output);
+
+/**
+ * Like rbs_serializer_measure_node and rbs_serializer_write_node, but for a bare node list.
+ */
+size_t rbs_serializer_measure_node_list(rbs_serializer_t *serializer, rbs_node_list_t *list);
+void rbs_serializer_write_node_list(rbs_serializer_t *serializer, rbs_node_list_t *list, char *output);
+
 #endif
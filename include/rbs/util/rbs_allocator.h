@@ -35,17 +35,72 @@ typedef struct rbs_allocator {
     // The head of a linked list of pages, starting with the most recently allocated page.
     struct rbs_allocator_page *page;
 
+    // Small pages kept by `rbs_allocator_reset()`, which are used before allocating new ones.
+    struct rbs_allocator_page *free_pages;
+
+    // The payload size of the first small page, which is the system page size minus the page header.
     size_t default_page_payload_size;
+
+    // The payload size of the next small page, which grows up to `max_page_payload_size`.
+    size_t page_payload_size;
+    size_t max_page_payload_size;
+
+    // Counters for `rbs_allocator_stats()`, since the allocator was created or reset.
+    size_t requested_bytes;
+    size_t alignment_bytes;
+    size_t abandoned_bytes;
 } rbs_allocator_t;
 
+typedef struct rbs_allocator_stats {
+    size_t requested_bytes;  // The bytes the allocations asked for.
+    size_t alignment_bytes;  // The padding inserted to align the allocations.
+    size_t abandoned_bytes;  // The bytes left behind by reallocations that had to move.
+    size_t slack_bytes;      // The unused bytes at the end of the small pages before the head page.
+    size_t used_bytes;       // The bytes allocated from the pages, including the alignment padding.
+    size_t capacity_bytes;   // The total payload size of the pages, which is the high-water mark of the arena.
+    size_t page_count;       // The number of pages in use, including large allocation pages.
+    size_t large_page_count; // The number of large allocation pages.
+} rbs_allocator_stats_t;
+
 rbs_allocator_t *rbs_allocator_init(void);
 void rbs_allocator_free(rbs_allocator_t *);
+
+/**
+ * Discards every allocation in the arena, so that it can be used again without going back to `malloc`.
+ *
+ * Small pages are kept, up to `retain` bytes of payload in total, and the rest of the pages are freed.
+ * Pass `0` to keep only one system page, or `SIZE_MAX` to keep every small page.
+ * */
+void rbs_allocator_reset(rbs_allocator_t *, size_t retain);
+
+/**
+ * Makes sure that the next `size` bytes of allocations fit in one page.
+ *
+ * Callers that know roughly how much they will allocate -- a parser sized by its input, for example --
+ * can use this to get one large page upfront, instead of growing into it a page at a time.
+ * */
+void rbs_allocator_reserve(rbs_allocator_t *, size_t size);
+
+/**
+ * Returns how much memory the allocations since the creation or the last reset of the arena take, and how much of it is wasted.
+ *
+ * The counters are updated on every allocation, and the page counts are collected by walking the pages,
+ * so this is cheap enough to call after every parse, but not in a loop of allocations.
+ * */
+rbs_allocator_stats_t rbs_allocator_stats(const rbs_allocator_t *);
 void *rbs_allocator_malloc_impl(rbs_allocator_t *, /*    1    */ size_t size, size_t alignment);
 void *rbs_allocator_malloc_many_impl(rbs_allocator_t *, size_t count, size_t size, size_t alignment);
 void *rbs_allocator_calloc_impl(rbs_allocator_t *, size_t count, size_t size, size_t alignment);
 
 void *rbs_allocator_realloc_impl(rbs_allocator_t *, void *ptr, size_t old_size, size_t new_size, size_t alignment);
 
+/**
+ * Returns the size the allocation of `size` bytes at `ptr` can be reallocated to without moving.
+ *
+ * That's the rest of the head page if `ptr` is the last allocation in it, or `size` otherwise.
+ * */
+size_t rbs_allocator_tail_capacity(const rbs_allocator_t *, const void *ptr, size_t size);
+
 // Use this when allocating memory for a single instance of a type.
 #define rbs_allocator_alloc(allocator, type) ((type *) rbs_allocator_malloc_impl((allocator), sizeof(type), rbs_alignof(type)))
 // Use this when allocating memory that will be immediately written to in full.
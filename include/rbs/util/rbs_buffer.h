@@ -72,6 +72,17 @@ void rbs_buffer_append_cstr(rbs_allocator_t *, rbs_buffer_t *buffer, const char
  */
 void rbs_buffer_append_string(rbs_allocator_t *, rbs_buffer_t *buffer, const char *value, size_t length);
 
+/**
+ * Give the unused capacity of the buffer back to the allocator.
+ *
+ * This only frees memory when the buffer is the last allocation of the allocator,
+ * which is the case right after building a string in it.
+ *
+ * @param allocator The allocator to use.
+ * @param buffer The buffer to shrink.
+ */
+void rbs_buffer_shrink_to_fit(rbs_allocator_t *, rbs_buffer_t *buffer);
+
 /**
  * Convert the buffer to a rbs_string_t.
  *
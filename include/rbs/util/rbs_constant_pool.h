@@ -66,7 +66,18 @@ typedef struct {
     size_t length;
 } rbs_constant_t;
 
-/** The overall constant pool, which stores constants found while parsing. */
+/**
+ * A constant pool that many constant pools, of parsers running on different
+ * threads, can share. See `rbs_constant_pool_init_global`.
+ */
+typedef struct rbs_global_constant_pool rbs_global_constant_pool_t;
+
+/**
+ * The overall constant pool, which stores constants found while parsing.
+ *
+ * Every pool starts with the seeded constants of `rbs_constant_pool_seeds.h`,
+ * which have the same ids in every pool and are never stored in the buckets.
+ */
 typedef struct {
     /** The buckets in the hash map. */
     rbs_constant_pool_bucket_t *buckets;
@@ -79,8 +90,23 @@ typedef struct {
 
     /** The number of buckets that have been allocated in the hash map. */
     uint32_t capacity;
+
+    /**
+     * The global pool that this pool forwards every operation to, or NULL if
+     * this pool keeps its constants by itself.
+     */
+    rbs_global_constant_pool_t *global;
 } rbs_constant_pool_t;
 
+/**
+ * The hash function of constant pools.
+ *
+ * @param start A pointer to the start of the string.
+ * @param length The length of the string.
+ * @return The hash of the string.
+ */
+uint32_t rbs_constant_pool_hash(const uint8_t *start, size_t length);
+
 /**
  * Initialize a new constant pool with a given capacity.
  *
@@ -90,6 +116,19 @@ typedef struct {
  */
 bool rbs_constant_pool_init(rbs_constant_pool_t *pool, uint32_t capacity);
 
+/**
+ * Initialize a constant pool that forwards every operation to a global pool.
+ *
+ * The ids of the constants are the ids in the global pool, so they are the same
+ * across all the pools that share the global pool. The strings inserted are
+ * copied into the global pool, whichever `insert` function inserts them, since
+ * the global pool outlives the sources.
+ *
+ * @param pool The pool to initialize.
+ * @param global The global pool to forward to.
+ */
+void rbs_constant_pool_init_global(rbs_constant_pool_t *pool, rbs_global_constant_pool_t *global);
+
 /**
  * Return a pointer to the constant indicated by the given constant id.
  *
@@ -110,6 +149,18 @@ rbs_constant_t *rbs_constant_pool_id_to_constant(const rbs_constant_pool_t *pool
  */
 rbs_constant_id_t rbs_constant_pool_find(const rbs_constant_pool_t *pool, const uint8_t *start, size_t length);
 
+/**
+ * Find a constant in a constant pool, with the hash of the constant computed by
+ * the caller with `rbs_constant_pool_hash`.
+ *
+ * @param pool The pool to find the constant in.
+ * @param start A pointer to the start of the constant.
+ * @param length The length of the constant.
+ * @param hash The hash of the constant.
+ * @return The id of the constant, or 0 if the constant is not found.
+ */
+rbs_constant_id_t rbs_constant_pool_find_with_hash(const rbs_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash);
+
 /**
  * Insert a constant into a constant pool that is a slice of a source string.
  * Returns the id of the constant, or 0 if any potential calls to resize fail.
@@ -122,6 +173,19 @@ rbs_constant_id_t rbs_constant_pool_find(const rbs_constant_pool_t *pool, const
 rbs_constant_id_t rbs_constant_pool_insert_shared(rbs_constant_pool_t *pool, const uint8_t *start, size_t length);
 rbs_constant_id_t rbs_constant_pool_insert_shared_with_encoding(rbs_constant_pool_t *pool, const uint8_t *start, size_t length, const rbs_encoding_t *encoding);
 
+/**
+ * Insert a constant into a constant pool, with the hash of the constant computed
+ * by the caller with `rbs_constant_pool_hash`. The lexer computes the hash of
+ * identifier tokens, so interning them doesn't read them again.
+ *
+ * @param pool The pool to insert the constant into.
+ * @param start A pointer to the start of the constant.
+ * @param length The length of the constant.
+ * @param hash The hash of the constant.
+ * @return The id of the constant.
+ */
+rbs_constant_id_t rbs_constant_pool_insert_shared_with_hash(rbs_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash);
+
 /**
  * Insert a constant into a constant pool from memory that is now owned by the
  * constant pool. Returns the id of the constant, or 0 if any potential calls to
@@ -152,4 +216,100 @@ rbs_constant_id_t rbs_constant_pool_insert_constant(rbs_constant_pool_t *pool, c
  */
 void rbs_constant_pool_free(rbs_constant_pool_t *pool);
 
+/**
+ * Allocate a new global constant pool.
+ *
+ * A global pool is safe to use from many threads at once: finding a constant
+ * doesn't take a lock, and only inserting a new constant does. The ids of the
+ * constants never change, and the constants are never moved, so a constant
+ * returned by `rbs_global_constant_pool_id_to_constant` stays valid until the
+ * pool is freed.
+ *
+ * @param capacity The initial capacity of the pool.
+ * @return The new pool, or NULL if the allocation fails.
+ */
+rbs_global_constant_pool_t *rbs_global_constant_pool_new(uint32_t capacity);
+
+/**
+ * Return the id of a constant in a global pool, or 0 if it's not found.
+ *
+ * @param pool The pool to find the constant in.
+ * @param start A pointer to the start of the constant.
+ * @param length The length of the constant.
+ * @return The id of the constant.
+ */
+rbs_constant_id_t rbs_global_constant_pool_find(const rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length);
+
+/**
+ * `rbs_global_constant_pool_find` with the hash of the constant computed by the
+ * caller with `rbs_constant_pool_hash`.
+ */
+rbs_constant_id_t rbs_global_constant_pool_find_with_hash(const rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash);
+
+/**
+ * Insert a copy of a string into a global pool, and return its id, or 0 if
+ * the allocation fails.
+ *
+ * @param pool The pool to insert the constant into.
+ * @param start A pointer to the start of the constant.
+ * @param length The length of the constant.
+ * @return The id of the constant.
+ */
+rbs_constant_id_t rbs_global_constant_pool_insert(rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length);
+
+/**
+ * `rbs_global_constant_pool_insert` with the hash of the constant computed by
+ * the caller with `rbs_constant_pool_hash`.
+ */
+rbs_constant_id_t rbs_global_constant_pool_insert_with_hash(rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash);
+
+/**
+ * Return a pointer to the constant indicated by the given constant id.
+ *
+ * @param pool The pool to get the constant from.
+ * @param constant_id The id of the constant to get.
+ * @return A pointer to the constant.
+ */
+rbs_constant_t *rbs_global_constant_pool_id_to_constant(const rbs_global_constant_pool_t *pool, rbs_constant_id_t constant_id);
+
+/**
+ * Return the number of constants in a global pool.
+ *
+ * @param pool The pool.
+ * @return The number of constants, which is also the largest id.
+ */
+uint32_t rbs_global_constant_pool_size(const rbs_global_constant_pool_t *pool);
+
+/**
+ * Return the value attached to a constant of a global pool by
+ * `rbs_global_constant_pool_set_data`, or 0 if nothing is attached.
+ *
+ * Users of a global pool can cache a value derived from a constant here -- the
+ * C extension caches the Ruby ID of the constant, for example.
+ *
+ * @param pool The pool.
+ * @param constant_id The id of the constant.
+ * @return The value attached to the constant.
+ */
+uintptr_t rbs_global_constant_pool_get_data(const rbs_global_constant_pool_t *pool, rbs_constant_id_t constant_id);
+
+/**
+ * Attach a value to a constant of a global pool.
+ *
+ * Setting a value concurrently from many threads is safe, but which one wins
+ * is unspecified, so it should be the same value computed from the constant.
+ *
+ * @param pool The pool.
+ * @param constant_id The id of the constant.
+ * @param data The value to attach.
+ */
+void rbs_global_constant_pool_set_data(rbs_global_constant_pool_t *pool, rbs_constant_id_t constant_id, uintptr_t data);
+
+/**
+ * Free a global constant pool. No other thread can use it anymore.
+ *
+ * @param pool The pool to free.
+ */
+void rbs_global_constant_pool_free(rbs_global_constant_pool_t *pool);
+
 #endif
@@ -0,0 +1,48 @@
+/*----------------------------------------------------------------------------*/
+/* This file is generated by the templates/template.rb script and should not  */
+/* be modified manually.                                                      */
+/* To change the template see                                                 */
+/* templates/include/rbs/util/rbs_constant_pool_seeds.h.erb                   */
+/*----------------------------------------------------------------------------*/
+
+#ifndef RBS_CONSTANT_POOL_SEEDS_H
+#define RBS_CONSTANT_POOL_SEEDS_H
+
+#include "rbs/util/rbs_constant_pool.h"
+
+/**
+ * The number of seeded constants, the names that every constant pool starts
+ * with (`constants:` in config.yml). The seeded constants have the fixed ids
+ * `1..RBS_CONSTANT_POOL_SEED_COUNT` in every pool, and the ids of the other
+ * constants start after them.
+ */
+#define RBS_CONSTANT_POOL_SEED_COUNT 146
+
+/** The number of slots in the perfect hash table of the seeded constants. */
+#define RBS_CONSTANT_POOL_SEED_SLOTS 2048
+
+/** The seeded constants, indexed by `id - 1`. */
+extern const rbs_constant_t rbs_constant_pool_seeds[RBS_CONSTANT_POOL_SEED_COUNT];
+
+/** The id of the seeded constant in each slot of the perfect hash table, or 0. */
+extern const uint8_t rbs_constant_pool_seed_slots[RBS_CONSTANT_POOL_SEED_SLOTS];
+
+/**
+ * Return the id of a seeded constant, or 0 if the string is not seeded.
+ *
+ * @param start A pointer to the start of the string.
+ * @param length The length of the string.
+ * @return The id of the seeded constant.
+ */
+static inline rbs_constant_id_t rbs_constant_pool_seed_find(const uint8_t *start, size_t length) {
+    if (length == 0 || length > 15) return RBS_CONSTANT_ID_UNSET;
+
+    uint32_t key = (uint32_t) length | ((uint32_t) start[0] << 8) | ((uint32_t) start[length / 2] << 16) | ((uint32_t) start[length - 1] << 24);
+    rbs_constant_id_t id = rbs_constant_pool_seed_slots[(uint32_t) (key * 3668339987u) >> 21];
+    if (id == RBS_CONSTANT_ID_UNSET) return RBS_CONSTANT_ID_UNSET;
+
+    const rbs_constant_t *seed = &rbs_constant_pool_seeds[id - 1];
+    return (seed->length == length && memcmp(seed->start, start, length) == 0) ? id : RBS_CONSTANT_ID_UNSET;
+}
+
+#endif
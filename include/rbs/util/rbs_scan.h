@@ -0,0 +1,38 @@
+#ifndef RBS_RBS_SCAN_H
+#define RBS_RBS_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Scans of the byte runs the lexer skips in bulk.
+ *
+ * Each function returns the length of the longest prefix of `[start, end)` made of the bytes it accepts. They read 16
+ * (or 32 with AVX2) bytes at a time with SSE2, AVX2 or NEON when the compiler targets one of them, and a byte at a time
+ * otherwise, and never read at or past `end`.
+ *
+ * None of them accepts a byte outside ASCII, so a scan that starts at a character boundary stops at the next character
+ * boundary in any ASCII compatible encoding.
+ * */
+
+/**
+ * Accepts every ASCII byte, so that the input is all ASCII if the whole of it is accepted.
+ * */
+size_t rbs_scan_ascii(const uint8_t *start, const uint8_t *end);
+
+/**
+ * Accepts spaces and tabs, the bytes of a `[ \t]+` trivia token.
+ * */
+size_t rbs_scan_spaces(const uint8_t *start, const uint8_t *end);
+
+/**
+ * Accepts the ASCII bytes that continue a comment: everything except `\n` and `\0`.
+ * */
+size_t rbs_scan_comment(const uint8_t *start, const uint8_t *end);
+
+/**
+ * Accepts `[a-zA-Z0-9_]`, the ASCII bytes that continue an identifier.
+ * */
+size_t rbs_scan_word(const uint8_t *start, const uint8_t *end);
+
+#endif // RBS_RBS_SCAN_H
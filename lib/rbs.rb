@@ -83,6 +83,8 @@ else
 end
 require "rbs/parser_aux"
 require "rbs/location_aux"
+require "rbs/signature_cache"
+require "rbs/environment_image"
 
 module RBS
   class <<self
@@ -43,9 +43,45 @@ module RBS
           end
         end
 
+        class LazyOverloads
+          attr_reader :variables, :classish_allowed, :location, :byte_range
+
+          def initialize(variables:, classish_allowed:, location:, byte_range: nil, block: nil)
+            @variables = variables
+            @classish_allowed = classish_allowed
+            @location = location
+            @byte_range = byte_range
+            @block = block
+          end
+
+          def parse
+            buffer = location.buffer
+            start_char = location._start_pos
+            byte_range = self.byte_range || begin
+              content = buffer.content
+              start_byte = (content[0, start_char] or raise).bytesize
+              start_byte...(start_byte + (content[start_char, location._end_pos - start_char] or raise).bytesize)
+            end
+            overloads = Parser._parse_method_overloads(buffer, byte_range.begin, byte_range.end, start_char, variables, classish_allowed)
+
+            if block = @block
+              overloads.map(&block)
+            else
+              overloads
+            end
+          end
+
+          def map(&block)
+            if inner = @block
+              LazyOverloads.new(variables: variables, classish_allowed: classish_allowed, location: location, byte_range: byte_range, block: ->(overload) { block.call(inner.call(overload)) })
+            else
+              LazyOverloads.new(variables: variables, classish_allowed: classish_allowed, location: location, byte_range: byte_range, block: block)
+            end
+          end
+        end
+
         attr_reader :name
         attr_reader :kind
-        attr_reader :overloads
         attr_reader :annotations
         attr_reader :location
         attr_reader :comment
@@ -63,6 +99,27 @@ module RBS
           @visibility = visibility
         end
 
+        def overloads
+          overloads = @overloads
+
+          if overloads.is_a?(LazyOverloads)
+            overloads = overloads.parse
+            @overloads = overloads unless frozen?
+          end
+
+          overloads
+        end
+
+        def freeze
+          # Parse the overloads before freezing, so that a frozen (or Ractor shareable) definition doesn't parse them on every call.
+          overloads
+          super
+        end
+
+        def map_overloads(&block)
+          @overloads.map(&block)
+        end
+
         def ==(other)
           other.is_a?(MethodDefinition) &&
             other.name == name &&
@@ -90,7 +147,7 @@ module RBS
           overloading
         end
 
-        def update(name: self.name, kind: self.kind, overloads: self.overloads, annotations: self.annotations, location: self.location, comment: self.comment, overloading: self.overloading?, visibility: self.visibility)
+        def update(name: self.name, kind: self.kind, overloads: @overloads, annotations: self.annotations, location: self.location, comment: self.comment, overloading: self.overloading?, visibility: self.visibility)
           self.class.new(
             name: name,
             kind: kind,
@@ -940,7 +940,11 @@ Options:
         RBS.logger.info "Parsing #{buf.name}..."
         case parse_method
         when :parse_signature
-          Parser.parse_signature(buf)
+          _, _, _, errors = Parser.parse_signature_with_errors(buf)
+          errors.each do |error|
+            stdout.print error.detailed_message(highlight: true)
+            syntax_error = true
+          end
         else
           Parser.public_send(parse_method, buf, require_eof: true)
         end
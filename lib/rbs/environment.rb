@@ -872,7 +872,7 @@ module RBS
         AST::Members::MethodDefinition.new(
           name: member.name,
           kind: member.kind,
-          overloads: member.overloads.map do |overload|
+          overloads: member.map_overloads do |overload|
             overload.update(
               method_type: resolve_method_type(resolver, map, overload.method_type, context: context)
             )
@@ -0,0 +1,284 @@
+# frozen_string_literal: true
+
+require "rbs/wasm/deserializer"
+
+module RBS
+  # EnvironmentImage packs the RBS files of an EnvironmentLoader into a single file, so that the declarations can be decoded one by one.
+  #
+  # The image keeps the content of each file, the constant table and the serialized directives and declarations of the file (in the format of
+  # `rbs_serialize_node`, see docs/wasm_serialization.md), and an index from type names to the top-level declarations that declare them.
+  # Loading an image only reads the offset tables; a declaration is decoded when it is first asked for.
+  # The file is read into memory as a whole, and `#load` decodes every declaration, since the entries of `Environment` are not lazy.
+  #
+  # ```ruby
+  # RBS::EnvironmentImage.write(Pathname("core.rbsimage"), RBS::EnvironmentLoader.new)
+  #
+  # image = RBS::EnvironmentImage.load(Pathname("core.rbsimage"))
+  # image.declarations(RBS::TypeName.parse("::String"))    # Decodes `class String` only
+  # image.load(env: RBS::Environment.new)                   # Decodes everything
+  # ```
+  #
+  class EnvironmentImage
+    class InvalidImageError < StandardError
+    end
+
+    MAGIC = "RBSENVIM".b
+    FORMAT_VERSION = 3
+
+    SOURCE_CORE = 0
+    SOURCE_LIBRARY = 1
+    SOURCE_LIBRARY_WITHOUT_VERSION = 2
+    SOURCE_DIR = 3
+
+    class FileEntry < Struct.new(:source, :path, :content_range, :constants_range, :directives_range, :declaration_ranges, keyword_init: true)
+    end
+
+    attr_reader :files
+
+    def self.write(path, loader)
+      path.binwrite(build(loader))
+    end
+
+    def self.load(path)
+      new(path.binread)
+    end
+
+    def self.build(loader)
+      header = +"".b
+      blobs = +"".b
+      names = {} #: Hash[String, Array[[Integer, Integer]]]
+      file_count = 0
+
+      add_blob = ->(bytes) do
+        offset = blobs.bytesize
+        blobs << bytes.b
+        [offset, bytes.bytesize]
+      end
+
+      loader.add_core_dependencies
+      loader.each_buffer do |source, path, buffer|
+        resolved = Parser.magic_comment(buffer)
+        start_pos = resolved ? (resolved.location || raise).end_pos : 0
+        bytes = Parser._parse_signature_to_bytes(buffer, start_pos, buffer.content.bytesize, false)
+        constants, directives, declarations = WASM::Deserializer.split_signature(bytes, buffer)
+
+        write_source(header, source)
+        write_string(header, path.to_s)
+        header << add_blob[buffer.content].pack("L<L<")
+        header << add_blob[constants].pack("L<L<")
+        header << add_blob[directives].pack("L<L<")
+        header << [declarations.size].pack("L<")
+
+        declarations.each_with_index do |(decl_bytes, decl), decl_index|
+          header << add_blob[decl_bytes].pack("L<L<")
+
+          each_declared_name(decl, Namespace.root) do |name|
+            (names[name.to_s] ||= []) << [file_count, decl_index]
+          end
+        end
+
+        file_count += 1
+      end
+
+      header << [names.size].pack("L<")
+      names.each do |name, refs|
+        write_string(header, name)
+        header << [refs.size].pack("L<")
+        refs.each { |ref| header << ref.pack("L<L<") }
+      end
+
+      prefix = +"".b
+      prefix << MAGIC << [FORMAT_VERSION].pack("L<")
+      write_string(prefix, RBS::VERSION)
+      blob_offset = prefix.bytesize + 8 + header.bytesize
+
+      prefix << [blob_offset, file_count].pack("L<L<") << header << blobs
+    end
+
+    def self.write_string(out, string)
+      out << [string.bytesize].pack("L<") << string.b
+    end
+
+    def self.write_source(out, source)
+      case source
+      when :core
+        out << [SOURCE_CORE].pack("C")
+      when EnvironmentLoader::Library
+        if version = source.version
+          out << [SOURCE_LIBRARY].pack("C")
+          write_string(out, source.name)
+          write_string(out, version)
+        else
+          out << [SOURCE_LIBRARY_WITHOUT_VERSION].pack("C")
+          write_string(out, source.name)
+        end
+      when Pathname
+        out << [SOURCE_DIR].pack("C")
+        write_string(out, source.to_s)
+      end
+    end
+
+    # Yields the type names the declaration inserts into an environment, including the ones of nested declarations
+    def self.each_declared_name(decl, namespace, &block)
+      case decl
+      when AST::Declarations::Class, AST::Declarations::Module
+        name = decl.name.with_prefix(namespace)
+        yield name
+        decl.each_decl do |member|
+          each_declared_name(member, name.to_namespace, &block)
+        end
+      when AST::Declarations::Interface, AST::Declarations::TypeAlias, AST::Declarations::Constant
+        yield decl.name.with_prefix(namespace)
+      when AST::Declarations::ClassAlias, AST::Declarations::ModuleAlias
+        yield decl.new_name.with_prefix(namespace)
+      end
+    end
+
+    def initialize(bytes)
+      @bytes = bytes.b
+      @pos = 0
+      @buffers = {}
+      @directives = {}
+      @declarations = {}
+
+      unless @bytes.byteslice(0, MAGIC.bytesize) == MAGIC
+        raise InvalidImageError, "Not an environment image"
+      end
+      @pos = MAGIC.bytesize
+
+      format_version = read_u32
+      rbs_version = read_string
+      unless format_version == FORMAT_VERSION && rbs_version == RBS::VERSION
+        raise InvalidImageError, "The environment image is built by RBS #{rbs_version} (format #{format_version}), rebuild it with RBS #{RBS::VERSION}"
+      end
+
+      @blob_offset = read_u32
+
+      @files = Array.new(read_u32) do
+        FileEntry.new(
+          source: read_source,
+          path: Pathname(read_string.force_encoding(Encoding::UTF_8)),
+          content_range: read_range,
+          constants_range: read_range,
+          directives_range: read_range,
+          declaration_ranges: Array.new(read_u32) { read_range }
+        )
+      end
+
+      @index = {} #: Hash[TypeName, Array[[Integer, Integer]]]
+      read_u32.times do
+        name = TypeName.parse(read_string.force_encoding(Encoding::UTF_8))
+        @index[name] = Array.new(read_u32) { [read_u32, read_u32] }
+      end
+    end
+
+    def type_names
+      @index.keys
+    end
+
+    def type_name?(type_name)
+      @index.key?(type_name)
+    end
+
+    # Returns the top-level declarations that declare the type name, decoding them if they are not decoded yet
+    #
+    # A nested declaration is returned as the outermost declaration that contains it.
+    #
+    def declarations(type_name)
+      refs = @index.fetch(type_name, nil) or return []
+      refs.uniq.map { |file_index, decl_index| declaration(file_index, decl_index) }
+    end
+
+    def buffer(file_index)
+      @buffers[file_index] ||= begin
+        file = files.fetch(file_index)
+        content = blob(file.content_range).force_encoding(Encoding::UTF_8)
+        Buffer.new(name: file.path, content: content)
+      end
+    end
+
+    def directives(file_index)
+      @directives[file_index] ||= begin
+        buffer = buffer(file_index)
+        file = files.fetch(file_index)
+        dirs = Parser._deserialize_node_list(buffer, blob(file.constants_range) + blob(file.directives_range))
+        if resolved = Parser.magic_comment(buffer)
+          dirs.unshift(resolved)
+        end
+        dirs
+      end
+    end
+
+    def declaration(file_index, decl_index)
+      @declarations[[file_index, decl_index]] ||= begin
+        file = files.fetch(file_index)
+        range = file.declaration_ranges.fetch(decl_index)
+        Parser._deserialize_node(buffer(file_index), blob(file.constants_range) + blob(range))
+      end
+    end
+
+    # Decodes all of the files, and adds them to the environment, as `EnvironmentLoader#load` does
+    def load(env:)
+      # @type var loaded: Array[[AST::Declarations::t, Pathname, EnvironmentLoader::source]]
+      loaded = []
+
+      files.each_with_index do |file, file_index|
+        decls = file.declaration_ranges.each_index.map { |decl_index| declaration(file_index, decl_index) }
+        decls.each do |decl|
+          loaded << [decl, file.path, file.source]
+        end
+        env.add_source(Source::RBS.new(buffer(file_index), directives(file_index), decls))
+      end
+
+      loaded
+    end
+
+    private
+
+    def blob(range)
+      offset, length = range
+      bytes = @bytes.byteslice(@blob_offset + offset, length)
+      raise InvalidImageError, "Broken environment image" unless bytes && bytes.bytesize == length
+      bytes
+    end
+
+    def read_u8
+      byte = @bytes.getbyte(@pos) or raise InvalidImageError, "Broken environment image"
+      @pos += 1
+      byte
+    end
+
+    def read_u32
+      value = @bytes.unpack1("L<", offset: @pos) or raise InvalidImageError, "Broken environment image"
+      @pos += 4
+      value
+    end
+
+    def read_range
+      [read_u32, read_u32]
+    end
+
+    def read_string
+      length = read_u32
+      string = @bytes.byteslice(@pos, length)
+      raise InvalidImageError, "Broken environment image" unless string && string.bytesize == length
+      @pos += length
+      string
+    end
+
+    def read_source
+      case read_u8
+      when SOURCE_CORE
+        :core
+      when SOURCE_LIBRARY
+        EnvironmentLoader::Library.new(name: read_string.force_encoding(Encoding::UTF_8), version: read_string.force_encoding(Encoding::UTF_8))
+      when SOURCE_LIBRARY_WITHOUT_VERSION
+        EnvironmentLoader::Library.new(name: read_string.force_encoding(Encoding::UTF_8), version: nil)
+      when SOURCE_DIR
+        Pathname(read_string.force_encoding(Encoding::UTF_8))
+      else
+        raise InvalidImageError, "Broken environment image"
+      end
+    end
+  end
+end
@@ -19,6 +19,8 @@ module RBS
 
     attr_reader :core_root
     attr_reader :repository
+    attr_reader :cache
+    attr_reader :lazy_overloads
 
     attr_reader :libs
     attr_reader :dirs
@@ -37,9 +39,11 @@ module RBS
       nil
     end
 
-    def initialize(core_root: DEFAULT_CORE_ROOT, repository: Repository.new)
+    def initialize(core_root: DEFAULT_CORE_ROOT, repository: Repository.new, cache: nil, lazy_overloads: false)
       @core_root = core_root
       @repository = repository
+      @cache = cache
+      @lazy_overloads = lazy_overloads
 
       @libs = Set.new
       @dirs = []
@@ -107,10 +111,7 @@ module RBS
       # @type var loaded: Array[[AST::Declarations::t, Pathname, source]]
       loaded = []
 
-      # For migrating stringio to stdlib
-      if @core_root && libs.none? { |lib| lib.name == 'stringio' }
-        add(library: 'stringio', version: nil)
-      end
+      add_core_dependencies
 
       each_signature do |source, path, buffer, decls, dirs|
         decls.each do |decl|
@@ -145,7 +146,14 @@ module RBS
       end
     end
 
-    def each_signature
+    def add_core_dependencies
+      # For migrating stringio to stdlib
+      if @core_root && libs.none? { |lib| lib.name == 'stringio' }
+        add(library: 'stringio', version: nil)
+      end
+    end
+
+    def each_buffer
       files = Set[]
 
       each_dir do |source, dir|
@@ -155,12 +163,35 @@ module RBS
           next if files.include?(path)
 
           files << path
-          buffer = Buffer.new(name: path, content: path.read(encoding: "UTF-8"))
+          yield source, path, Buffer.new(name: path, content: path.read(encoding: "UTF-8"))
+        end
+      end
+    end
+
+    def each_signature
+      entries = [] #: Array[[source, Pathname]]
+      buffers = [] #: Array[Buffer]
 
-          _, dirs, decls = Parser.parse_signature(buffer)
+      each_buffer do |source, path, buffer|
+        entries << [source, path]
+        buffers << buffer
+      end
 
+      if cache = self.cache
+        entries.each_with_index do |(source, path), index|
+          buffer, dirs, decls = cache.parse_signature(buffers.fetch(index))
           yield source, path, buffer, decls, dirs
         end
+        return
+      end
+
+      # Parse all of the files in one batch, so that the parser can use multiple native threads
+      index = 0
+      Parser.parse_signatures(buffers, lazy_overloads: lazy_overloads) do |buffer, dirs, decls|
+        source, path = entries.fetch(index)
+        index += 1
+
+        yield source, path, buffer, decls, dirs
       end
     end
   end
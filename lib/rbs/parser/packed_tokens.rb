@@ -0,0 +1,91 @@
+# frozen_string_literal: true
+
+module RBS
+  class Parser
+    # The tokens of `Parser.lex_packed`, which keeps the tokens in a binary string and makes objects only for the tokens
+    # that are asked for.
+    #
+    # Each token is a record of `RECORD_SIZE` bytes: the type as a u8 index to `Parser._token_types`, and the start and
+    # end character positions and the start and end byte positions as little endian u32s.
+    #
+    class PackedTokens
+      include Enumerable
+
+      RECORD_SIZE = 17
+
+      attr_reader :buffer
+      attr_reader :bytes
+
+      # The indexes of the tokens that `Parser.relex` lexed again, or `nil` if the whole buffer is lexed.
+      attr_reader :relexed
+
+      def initialize(buffer:, bytes:, relexed: nil)
+        @buffer = buffer
+        @bytes = bytes
+        @relexed = relexed
+        @token_types = Parser._token_types
+      end
+
+      def size
+        bytes.bytesize / RECORD_SIZE
+      end
+
+      alias length size
+
+      def type(index)
+        @token_types[bytes.getbyte(index * RECORD_SIZE) || raise(IndexError, "index #{index} outside of the tokens")]
+      end
+
+      def start_pos(index)
+        bytes.unpack1("L<", offset: index * RECORD_SIZE + 1)
+      end
+
+      def end_pos(index)
+        bytes.unpack1("L<", offset: index * RECORD_SIZE + 5)
+      end
+
+      def start_byte(index)
+        bytes.unpack1("L<", offset: index * RECORD_SIZE + 9)
+      end
+
+      def end_byte(index)
+        bytes.unpack1("L<", offset: index * RECORD_SIZE + 13)
+      end
+
+      def range(index)
+        start_pos(index)...end_pos(index)
+      end
+
+      def location(index)
+        Location.new(buffer, start_pos(index), end_pos(index))
+      end
+
+      def token(index)
+        Token.new(type: type(index), location: location(index))
+      end
+
+      def [](index)
+        index += size if index < 0
+        return if index < 0 || index >= size
+
+        token(index)
+      end
+
+      def each(&block)
+        if block
+          # Unpacking all the records at once is much faster than a record at a time.
+          bytes.unpack("CL<L<x8" * size).each_slice(3) do |type, start_pos, end_pos|
+            yield Token.new(type: @token_types.fetch(type), location: Location.new(buffer, start_pos, end_pos))
+          end
+        else
+          enum_for(:each) { size }
+        end
+      end
+
+      # The types of the tokens, without making a `Location` for each.
+      def types
+        Array.new(size) { |index| @token_types[bytes.getbyte(index * RECORD_SIZE) || raise] }
+      end
+    end
+  end
+end
@@ -1,7 +1,10 @@
 # frozen_string_literal: true
 
+require "etc"
+
 require_relative "parser/lex_result"
 require_relative "parser/token"
+require_relative "parser/packed_tokens"
 
 module RBS
   class Parser
@@ -38,6 +41,79 @@ module RBS
       [buf, dirs, decls]
     end
 
+    def self.parse_signature_with_errors(source)
+      buf = buffer(source)
+
+      resolved = magic_comment(buf)
+      start_pos =
+        if resolved
+          (resolved.location || raise).end_pos
+        else
+          0
+        end
+      content = buf.content
+      dirs, decls, errors = _parse_signature_with_errors(buf, start_pos, content.bytesize, false)
+
+      if resolved
+        dirs = dirs.dup if dirs.frozen?
+        dirs.unshift(resolved)
+      end
+
+      [buf, dirs, decls, errors]
+    end
+
+    def self.parse_signature_skeleton(source)
+      buf = buffer(source)
+
+      resolved = magic_comment(buf)
+      start_pos =
+        if resolved
+          (resolved.location || raise).end_pos
+        else
+          0
+        end
+      content = buf.content
+      dirs, decls = _parse_signature_skeleton(buf, start_pos, content.bytesize)
+
+      if resolved
+        dirs = dirs.dup if dirs.frozen?
+        dirs.unshift(resolved)
+      end
+
+      [buf, dirs, decls]
+    end
+
+    def self.parse_signatures(sources, threads: nil, lazy_overloads: false)
+      buffers = sources.map { |source| buffer(source) }
+      resolveds = buffers.map { |buf| magic_comment(buf) }
+
+      start_positions = resolveds.map do |resolved|
+        if resolved
+          (resolved.location || raise).end_pos
+        else
+          0
+        end
+      end
+      end_positions = buffers.map { |buf| buf.content.bytesize }
+
+      results = _parse_signatures(buffers, start_positions, end_positions, false, lazy_overloads, threads || Etc.nprocessors)
+
+      buffers.each_with_index.map do |buf, index|
+        result = results[index]
+        raise result if result.is_a?(Exception)
+
+        dirs, decls = result
+        if resolved = resolveds[index]
+          dirs = dirs.dup if dirs.frozen?
+          dirs.unshift(resolved)
+        end
+
+        yield buf, dirs, decls if block_given?
+
+        [buf, dirs, decls]
+      end
+    end
+
     def self.parse_type_params(source, module_type_params: true)
       buf = buffer(source)
       _parse_type_params(buf, 0, buf.content.bytesize, module_type_params)
@@ -69,11 +145,22 @@ module RBS
 
     def self.lex(source)
       buf = buffer(source)
-      list = _lex(buf, buf.content.bytesize)
-      value = list.map do |type, location|
-        Token.new(type: type, location: location)
-      end
-      LexResult.new(buffer: buf, value: value)
+      LexResult.new(buffer: buf, value: lex_packed(buf).to_a)
+    end
+
+    def self.lex_packed(source)
+      buf = buffer(source)
+      PackedTokens.new(buffer: buf, bytes: _lex_packed(buf, buf.content.bytesize))
+    end
+
+    def self.relex(tokens, source, start_byte:, old_end_byte:, new_end_byte:)
+      buf = buffer(source)
+      bytes, relexed_start, relexed_count = _relex_packed(buf, buf.content.bytesize, tokens.bytes, start_byte, old_end_byte, new_end_byte)
+      PackedTokens.new(buffer: buf, bytes: bytes, relexed: relexed_start...relexed_start + relexed_count)
+    end
+
+    def self.last_parse_stats
+      _last_parse_stats
     end
 
     def self.buffer(source)
@@ -0,0 +1,96 @@
+# frozen_string_literal: true
+
+require "digest/sha2"
+require "fileutils"
+require "zlib"
+
+module RBS
+  # SignatureCache stores parsed RBS files on disk, so that loading the same files again skips parsing.
+  #
+  # Each entry is the binary encoding of the `[directives, declarations]` pair produced by `rbs_serialize_node`
+  # (see docs/wasm_serialization.md), and is decoded back with `Parser._deserialize_signature`.
+  # The encoding is preceded by its CRC32, and an entry that doesn't match it is parsed again.
+  # Entries are keyed by the digest of the file content, and live in a directory per RBS version and format version,
+  # so that a cache is never read by a version of RBS that encodes the AST differently.
+  #
+  # ```ruby
+  # cache = RBS::SignatureCache.new(Pathname("tmp/rbs-cache"))
+  # loader = RBS::EnvironmentLoader.new(cache: cache)
+  # ```
+  #
+  class SignatureCache
+    FORMAT_VERSION = 4
+
+    attr_reader :dir
+
+    def initialize(dir)
+      @dir = Pathname(dir) + "#{RBS::VERSION}-#{FORMAT_VERSION}"
+    end
+
+    def parse_signature(buffer)
+      resolved = Parser.magic_comment(buffer)
+      start_pos =
+        if resolved
+          (resolved.location || raise).end_pos
+        else
+          0
+        end
+
+      path = entry_path(buffer, start_pos)
+
+      dirs, decls = load_entry(path, buffer) || begin
+        bytes = Parser._parse_signature_to_bytes(buffer, start_pos, buffer.content.bytesize, false)
+        store_entry(path, bytes)
+        Parser._deserialize_signature(buffer, bytes)
+      end
+
+      if resolved
+        dirs = dirs.dup if dirs.frozen?
+        dirs.unshift(resolved)
+      end
+
+      [buffer, dirs, decls]
+    end
+
+    def entry_path(buffer, start_pos)
+      content = buffer.content
+      digest = Digest::SHA256.new
+      digest << content.encoding.name << "\0" << start_pos.to_s << "\0" << content
+      hex = digest.hexdigest
+
+      dir + hex[0, 2] + hex[2..]
+    end
+
+    private
+
+    def load_entry(path, buffer)
+      bytes = path.binread
+      checksum = bytes.unpack1("V")
+      payload = bytes.byteslice(4..) || ""
+
+      unless checksum && Zlib.crc32(payload) == checksum
+        raise ArgumentError, "checksum mismatch"
+      end
+
+      Parser._deserialize_signature(buffer, payload)
+    rescue Errno::ENOENT
+      nil
+    rescue ArgumentError, EncodingError => exn
+      # A broken entry (e.g. truncated by a crash of another process) is ignored and overwritten.
+      RBS.logger.info { "Ignoring broken signature cache entry #{path}: #{exn.message}" }
+      nil
+    end
+
+    def store_entry(path, bytes)
+      FileUtils.mkdir_p(path.dirname)
+
+      # Write to a temporary file and rename it, so that readers never see a partially written entry.
+      tmp = path.sub_ext(".#{Process.pid}.#{Thread.current.object_id}.tmp")
+      tmp.binwrite([Zlib.crc32(bytes)].pack("V") + bytes)
+      File.rename(tmp, path)
+    rescue SystemCallError => exn
+      RBS.logger.info { "Failed to write signature cache entry #{path}: #{exn.message}" }
+      FileUtils.rm_f(tmp.to_s) if tmp
+    end
+  end
+end
@@ -16,13 +16,29 @@ module RBS
       # Deserialize a buffer produced for a whole signature, returning
       # `[directives, declarations]` to match RBS::Parser._parse_signature.
       def self.deserialize(bytes, buffer)
-        new(bytes, buffer).read_node
+        deserializer = new(bytes, buffer)
+        deserializer.read_constants
+        deserializer.read_node
       end
 
       # Deserialize a bare node list (rbs_serialize_node_list), e.g. the result
       # of RBS::Parser._parse_type_params.
       def self.deserialize_node_list(bytes, buffer)
-        new(bytes, buffer).read_node_list
+        deserializer = new(bytes, buffer)
+        deserializer.read_constants
+        deserializer.read_node_list
+      end
+
+      # Split a buffer produced for a whole signature into the encoding of its
+      # constant table, the encoding of its directive list, and the encoding of
+      # each declaration, along with the decoded declaration, so that they can
+      # be stored and decoded one by one (see RBS::EnvironmentImage).
+      #
+      # The constant table followed by the encoding of the directive list or of
+      # a declaration is a buffer for rbs_deserialize_node_list or
+      # rbs_deserialize_node.
+      def self.split_signature(bytes, buffer)
+        new(bytes, buffer).split_signature
       end
 
       # Deserialize the token stream produced by rbs_wasm_lex into the
@@ -39,13 +55,20 @@ module RBS
         # nodes are always UTF-8 (see read_node).
         @encoding = buffer.content.encoding
         @pos = 0
+        @symbols = [] #: Array[Symbol]
         @class_cache = {} #: Hash[String, untyped]
       end
 
+      # Reads the constant table at the start of a buffer, the names of the
+      # symbols the rest of the buffer refers to by index.
+      def read_constants
+        @symbols = Array.new(read_count) { read_string(@encoding).to_sym }
+      end
+
       def read_node
         tag = read_u8
         return nil if tag == 0
-        return read_string(@encoding).to_sym if tag == SerializationSchema::SYMBOL_TAG
+        return read_symbol if tag == SerializationSchema::SYMBOL_TAG
 
         entry = SerializationSchema::SCHEMA[tag] or raise "Unknown node tag: #{tag}"
 
@@ -66,6 +89,27 @@ module RBS
         Array.new(read_count) { read_node }
       end
 
+      def split_signature
+        read_constants
+        constants = @bytes.byteslice(0, @pos) or raise
+
+        tag = read_u8
+        entry = SerializationSchema::SCHEMA[tag]
+        raise "Not a signature: tag #{tag}" unless entry && entry[0] == :signature
+
+        start = @pos
+        read_node_list
+        directives = @bytes.byteslice(start, @pos - start) or raise
+
+        declarations = Array.new(read_count) do
+          start = @pos
+          decl = read_node
+          [@bytes.byteslice(start, @pos - start) || raise, decl]
+        end
+
+        [constants, directives, declarations]
+      end
+
       # The lex stream has no leading count: read records until the buffer is
       # exhausted. Each is a token type name followed by its character range.
       def read_tokens
@@ -93,6 +137,14 @@ module RBS
 
         RBS::AST::TypeParam.resolve_variables(kwargs[:type_params]) if resolve_type_params
 
+        # The overloads that a skeleton parse skipped come as one `LazyOverloads`, as in ast_translation.c.
+        if class_name == "RBS::AST::Members::MethodDefinition"
+          overloads = kwargs[:overloads]
+          if overloads.size == 1 && overloads[0].is_a?(RBS::AST::Members::MethodDefinition::LazyOverloads)
+            kwargs[:overloads] = overloads[0]
+          end
+        end
+
         klass = class_for(class_name)
         if expose_location
           klass.new(location: location, **kwargs)
@@ -167,10 +219,15 @@ module RBS
         case read_u8
         when 0 then nil   # inferred instance variable
         when 1 then false # no instance variable
-        else read_string(@encoding).to_sym
+        else read_symbol
         end
       end
 
+      def read_symbol
+        index = read_u32
+        @symbols[index] or raise "Corrupt buffer: constant #{index} is not in the table of #{@symbols.size} constants"
+      end
+
       # Reads a presence byte and, when present, the start/end character positions.
       def read_range
         return nil if read_u8 == 0
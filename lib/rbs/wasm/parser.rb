@@ -13,13 +13,60 @@ module RBS
   class Parser
     class << self
       def _parse_signature(buffer, start_pos, end_pos, enable_forwarding_params)
+        bytes = _parse_signature_to_bytes(buffer, start_pos, end_pos, enable_forwarding_params)
+        WASM::Deserializer.deserialize(bytes, buffer)
+      end
+
+      def _parse_signature_skeleton(buffer, start_pos, end_pos)
+        validate_position_range(buffer, start_pos, end_pos)
+        encoding = buffer.content.encoding.name
+        status, bytes = WASM::Runtime.instance.parse_signature_skeleton(buffer.content, encoding, start_pos, end_pos)
+        raise_parse_failure(buffer, status, bytes, start_pos, end_pos) unless status == WASM::Runtime::OK
+
+        WASM::Deserializer.deserialize(bytes, buffer)
+      end
+
+      # The WebAssembly runtime is single threaded, so the batch is parsed sequentially.
+      # `lazy_overloads` is ignored, and the overloads are always parsed.
+      def _parse_signatures(buffers, start_positions, end_positions, enable_forwarding_params, lazy_overloads, threads)
+        unless buffers.size == start_positions.size && buffers.size == end_positions.size
+          raise ArgumentError, "buffers and positions must have the same length"
+        end
+
+        buffers.each_with_index.map do |buffer, index|
+          _parse_signature(buffer, start_positions[index], end_positions[index], enable_forwarding_params)
+        rescue ParsingError => error
+          error
+        end
+      end
+
+      # The runtime already returns the serialized bytes, so this is `_parse_signature` without the decoding.
+      def _parse_signature_to_bytes(buffer, start_pos, end_pos, enable_forwarding_params)
         validate_position_range(buffer, start_pos, end_pos)
         validate_parser_options(enable_forwarding_params)
         encoding = buffer.content.encoding.name
         status, bytes = WASM::Runtime.instance.parse_signature(buffer.content, encoding, start_pos, end_pos)
         raise_parse_failure(buffer, status, bytes, start_pos, end_pos) unless status == WASM::Runtime::OK
 
+        bytes
+      end
+
+      def _deserialize_signature(buffer, bytes)
         WASM::Deserializer.deserialize(bytes, buffer)
+      rescue StandardError => exn
+        raise ArgumentError, "broken serialized signature: #{exn.message}"
+      end
+
+      def _deserialize_node(buffer, bytes)
+        WASM::Deserializer.deserialize(bytes, buffer)
+      rescue StandardError => exn
+        raise ArgumentError, "broken serialized node: #{exn.message}"
+      end
+
+      def _deserialize_node_list(buffer, bytes)
+        WASM::Deserializer.deserialize_node_list(bytes, buffer)
+      rescue StandardError => exn
+        raise ArgumentError, "broken serialized node list: #{exn.message}"
       end
 
       def _parse_type(buffer, start_pos, end_pos, variables, require_eof, void_allowed, self_allowed, classish_allowed)
@@ -43,6 +90,16 @@ module RBS
         deserialize_or_nil(bytes, buffer)
       end
 
+      def _parse_method_overloads(buffer, start_pos, end_pos, start_char, variables, classish_allowed)
+        validate_position_range(buffer, start_pos, end_pos)
+        validate_variables(variables)
+        encoding = buffer.content.encoding.name
+        status, bytes = WASM::Runtime.instance.parse_method_overloads(buffer.content, encoding, start_pos, end_pos, start_char, variables, classish_allowed)
+        raise_parse_failure(buffer, status, bytes, start_pos, end_pos) unless status == WASM::Runtime::OK
+
+        WASM::Deserializer.deserialize_node_list(bytes, buffer)
+      end
+
       def _parse_type_params(buffer, start_pos, end_pos, module_type_params)
         validate_position_range(buffer, start_pos, end_pos)
         encoding = buffer.content.encoding.name
@@ -59,6 +116,34 @@ module RBS
         WASM::Deserializer.deserialize_tokens(bytes, buffer)
       end
 
+      def _lex_packed(buffer, end_pos)
+        encoding = buffer.content.encoding.name
+        _status, bytes = WASM::Runtime.instance.lex_packed(buffer.content, encoding, end_pos)
+        bytes
+      end
+
+      def _relex_packed(buffer, end_pos, old_bytes, start_byte, old_end_byte, new_end_byte)
+        encoding = buffer.content.encoding.name
+        status, bytes = WASM::Runtime.instance.relex_packed(buffer.content, encoding, end_pos, old_bytes, start_byte, old_end_byte, new_end_byte)
+        raise ArgumentError, "invalid edit: #{start_byte}...#{old_end_byte} replaced with #{start_byte}...#{new_end_byte}" unless status == WASM::Runtime::OK
+
+        relexed_start, relexed_count = bytes.unpack("L<L<")
+        [bytes.byteslice(8..) || raise, relexed_start, relexed_count]
+      end
+
+      def _token_types
+        @token_types ||= WASM::Runtime.instance.token_types.each_line(chomp: true).map(&:to_sym).freeze
+      end
+
+      # The runtime is shared by the threads, so this is the stats of the last parse of any thread.
+      def _last_parse_stats
+        status, bytes = WASM::Runtime.instance.last_parse_stats
+        return unless status == WASM::Runtime::OK
+
+        keys = [:requested_bytes, :alignment_bytes, :abandoned_bytes, :slack_bytes, :used_bytes, :capacity_bytes, :page_count, :large_page_count]
+        keys.zip(bytes.unpack("L<*")).to_h
+      end
+
       def _parse_inline_leading_annotation(buffer, start_pos, end_pos, variables)
         validate_position_range(buffer, start_pos, end_pos)
         validate_variables(variables)
@@ -47,12 +47,18 @@ module RBS
         @result_ptr = @wasm.export("rbs_wasm_result_ptr")
         @result_len = @wasm.export("rbs_wasm_result_len")
         @parse_signature = @wasm.export("rbs_wasm_parse_signature")
+        @parse_signature_skeleton = @wasm.export("rbs_wasm_parse_signature_skeleton")
         @parse_type = @wasm.export("rbs_wasm_parse_type")
         @parse_method_type = @wasm.export("rbs_wasm_parse_method_type")
+        @parse_method_overloads = @wasm.export("rbs_wasm_parse_method_overloads")
         @parse_type_params = @wasm.export("rbs_wasm_parse_type_params")
         @parse_inline_leading_annotation = @wasm.export("rbs_wasm_parse_inline_leading_annotation")
         @parse_inline_trailing_annotation = @wasm.export("rbs_wasm_parse_inline_trailing_annotation")
         @lex = @wasm.export("rbs_wasm_lex")
+        @lex_packed = @wasm.export("rbs_wasm_lex_packed")
+        @relex_packed = @wasm.export("rbs_wasm_relex_packed")
+        @token_types = @wasm.export("rbs_wasm_token_types")
+        @last_parse_stats = @wasm.export("rbs_wasm_last_parse_stats")
       end
 
       # `content` is the whole buffer; `start_pos`/`end_pos` are the character
@@ -64,6 +70,10 @@ module RBS
         run(content, encoding) { |ptr, len, enc_ptr, enc_len| @parse_signature.apply(ptr, len, enc_ptr, enc_len, start_pos, end_pos)[0] }
       end
 
+      def parse_signature_skeleton(content, encoding, start_pos, end_pos)
+        run(content, encoding) { |ptr, len, enc_ptr, enc_len| @parse_signature_skeleton.apply(ptr, len, enc_ptr, enc_len, start_pos, end_pos)[0] }
+      end
+
       def parse_type(content, encoding, start_pos, end_pos, variables, require_eof, void_allowed, self_allowed, classish_allowed)
         with_variables(variables) do |vars_ptr, vars_len|
           run(content, encoding) do |ptr, len, enc_ptr, enc_len|
@@ -80,6 +90,14 @@ module RBS
         end
       end
 
+      def parse_method_overloads(content, encoding, start_pos, end_pos, start_char, variables, classish_allowed)
+        with_variables(variables) do |vars_ptr, vars_len|
+          run(content, encoding) do |ptr, len, enc_ptr, enc_len|
+            @parse_method_overloads.apply(ptr, len, enc_ptr, enc_len, start_pos, end_pos, start_char, vars_ptr, vars_len, bool(classish_allowed))[0]
+          end
+        end
+      end
+
       def parse_type_params(content, encoding, start_pos, end_pos, module_type_params)
         run(content, encoding) do |ptr, len, enc_ptr, enc_len|
           @parse_type_params.apply(ptr, len, enc_ptr, enc_len, start_pos, end_pos, bool(module_type_params))[0]
@@ -108,6 +126,37 @@ module RBS
         end
       end
 
+      def lex_packed(content, encoding, end_pos)
+        run(content, encoding) do |ptr, len, enc_ptr, enc_len|
+          @lex_packed.apply(ptr, len, enc_ptr, enc_len, end_pos)[0]
+        end
+      end
+
+      def relex_packed(content, encoding, end_pos, old_bytes, start_byte, old_end_byte, new_end_byte)
+        with_bytes(old_bytes) do |old_ptr, old_len|
+          run(content, encoding) do |ptr, len, enc_ptr, enc_len|
+            @relex_packed.apply(ptr, len, enc_ptr, enc_len, end_pos, old_ptr, old_len, start_byte, old_end_byte, new_end_byte)[0]
+          end
+        end
+      end
+
+      # Returns the names of the token types, each followed by a newline.
+      def token_types
+        synchronize do
+          @token_types.apply
+          read_result
+        end
+      end
+
+      # Returns [status, bytes], where `bytes` is the eight u32 values of
+      # rbs_wasm_last_parse_stats with OK, and empty with PARSE_ERROR.
+      def last_parse_stats
+        synchronize do
+          status = @last_parse_stats.apply[0]
+          [i32(status), read_result]
+        end
+      end
+
       private
 
       # Copies `source` and its encoding name into linear memory, yields their
@@ -151,7 +200,12 @@ module RBS
           return yield(0, variables.nil? ? -1 : 0)
         end
 
-        bytes = names.b
+        with_bytes(names) { |pointer, length| yield(pointer, length) }
+      end
+
+      # Copies `string` into linear memory and yields its pointer/length.
+      def with_bytes(string)
+        bytes = string.b
         length = bytes.bytesize
         synchronize do
           pointer = @alloc.apply(length)[0]
@@ -11,6 +11,9 @@ module RBS
     # this table; the matching encoder is generated from the same config.yml, so
     # the two stay in sync.
     #
+    # The buffer starts with the constant table, the names of the interned
+    # symbols, each written once; a symbol refers to its name by index.
+    #
     # SCHEMA is indexed by node tag: tag 0 is NULL and SYMBOL_TAG is the
     # interned-symbol tag. Each remaining entry is one of:
     #
@@ -23,7 +26,7 @@ module RBS
     # :bool, :location_range, :location_range_list, :attr_ivar_name, or
     # [:enum, [value_or_nil, ...]].
     module SerializationSchema
-      SYMBOL_TAG = 79
+      SYMBOL_TAG = 80
 
       SCHEMA = [
         nil, # tag 0 is reserved for NULL
@@ -54,6 +57,7 @@ module RBS
         [:node, "RBS::AST::Members::Include", true, [[:name, true], [:keyword, true], [:args, false]], [[:name, :node], [:args, :node_list], [:annotations, :node_list], [:comment, :node]], false],
         [:node, "RBS::AST::Members::InstanceVariable", true, [[:name, true], [:colon, true], [:kind, false]], [[:name, :node], [:type, :node], [:comment, :node]], false],
         [:node, "RBS::AST::Members::MethodDefinition", true, [[:keyword, true], [:name, true], [:kind, false], [:overloading, false], [:visibility, false]], [[:name, :node], [:kind, [:enum, [:instance, :singleton, :singleton_instance]]], [:overloads, :node_list], [:annotations, :node_list], [:comment, :node], [:overloading, :bool], [:visibility, [:enum, [nil, :public, :private]]]], false],
+        [:node, "RBS::AST::Members::MethodDefinition::LazyOverloads", true, nil, [[:variables, :node_list], [:classish_allowed, :bool]], false],
         [:node, "RBS::AST::Members::MethodDefinition::Overload", false, nil, [[:annotations, :node_list], [:method_type, :node]], false],
         [:node, "RBS::AST::Members::Prepend", true, [[:name, true], [:keyword, true], [:args, false]], [[:name, :node], [:args, :node_list], [:annotations, :node_list], [:comment, :node]], false],
         [:node, "RBS::AST::Members::Private", true, nil, nil, false],
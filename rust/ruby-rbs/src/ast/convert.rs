@@ -1244,6 +1244,7 @@ fn node_kind(node: &Node<'_>) -> &'static str {
         Node::Include(_) => "Include",
         Node::InstanceVariable(_) => "InstanceVariable",
         Node::MethodDefinition(_) => "MethodDefinition",
+        Node::MethodDefinitionLazyOverloads(_) => "MethodDefinitionLazyOverloads",
         Node::MethodDefinitionOverload(_) => "MethodDefinitionOverload",
         Node::Prepend(_) => "Prepend",
         Node::Private(_) => "Private",
@@ -104,7 +104,8 @@ impl<'a> NodeList<'a> {
     pub fn iter(&self) -> NodeListIter<'a> {
         NodeListIter {
             parser: self.parser,
-            current: unsafe { (*self.pointer).head },
+            pointer: self.pointer,
+            index: 0,
             marker: PhantomData,
         }
     }
@@ -112,23 +113,29 @@ impl<'a> NodeList<'a> {
 
 pub struct NodeListIter<'a> {
     parser: NonNull<rbs_parser_t>,
-    current: *mut rbs_node_list_node_t,
-    marker: PhantomData<&'a mut rbs_node_list_node_t>,
+    pointer: *mut rbs_node_list_t,
+    index: usize,
+    marker: PhantomData<&'a mut rbs_node_list_t>,
 }
 
 impl<'a> Iterator for NodeListIter<'a> {
     type Item = Node<'a>;
 
     fn next(&mut self) -> Option<Self::Item> {
-        if self.current.is_null() {
+        let list = unsafe { &*self.pointer };
+        if self.index >= list.length {
             None
         } else {
-            let pointer_data = unsafe { *self.current };
-            let node = Node::new(self.parser, pointer_data.node);
-            self.current = pointer_data.next;
+            let node = Node::new(self.parser, unsafe { *list.items.add(self.index) });
+            self.index += 1;
             Some(node)
         }
     }
+
+    fn size_hint(&self) -> (usize, Option<usize>) {
+        let remaining = unsafe { (*self.pointer).length } - self.index;
+        (remaining, Some(remaining))
+    }
 }
 
 pub struct RBSHash<'a> {
@@ -152,7 +159,8 @@ impl<'a> RBSHash<'a> {
     pub fn iter(&self) -> RBSHashIter<'a> {
         RBSHashIter {
             parser: self.parser,
-            current: unsafe { (*self.pointer).head },
+            pointer: self.pointer,
+            index: 0,
             marker: PhantomData,
         }
     }
@@ -160,24 +168,31 @@ impl<'a> RBSHash<'a> {
 
 pub struct RBSHashIter<'a> {
     parser: NonNull<rbs_parser_t>,
-    current: *mut rbs_hash_node_t,
-    marker: PhantomData<&'a mut rbs_hash_node_t>,
+    pointer: *mut rbs_hash,
+    index: usize,
+    marker: PhantomData<&'a mut rbs_hash>,
 }
 
 impl<'a> Iterator for RBSHashIter<'a> {
     type Item = (Node<'a>, Node<'a>);
 
     fn next(&mut self) -> Option<Self::Item> {
-        if self.current.is_null() {
+        let hash = unsafe { &*self.pointer };
+        if self.index >= hash.length {
             None
         } else {
-            let pointer_data = unsafe { *self.current };
-            let key = Node::new(self.parser, pointer_data.key);
-            let value = Node::new(self.parser, pointer_data.value);
-            self.current = pointer_data.next;
+            let entry = unsafe { *hash.entries.add(self.index) };
+            let key = Node::new(self.parser, entry.key);
+            let value = Node::new(self.parser, entry.value);
+            self.index += 1;
             Some((key, value))
         }
     }
+
+    fn size_hint(&self) -> (usize, Option<usize>) {
+        let remaining = unsafe { (*self.pointer).length } - self.index;
+        (remaining, Some(remaining))
+    }
 }
 
 pub struct RBSLocationRange {
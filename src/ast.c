@@ -7,6 +7,7 @@
 
 #line 2 "templates/src/ast.c.erb"
 #include "rbs/ast.h"
+#include "rbs/util/rbs_assert.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -67,6 +68,8 @@ const char *RBS_NONNULL rbs_node_type_name(rbs_node_t *RBS_NONNULL node) {
         return "RBS::AST::Members::InstanceVariable";
     case RBS_AST_MEMBERS_METHOD_DEFINITION:
         return "RBS::AST::Members::MethodDefinition";
+    case RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS:
+        return "RBS::AST::Members::MethodDefinition::LazyOverloads";
     case RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD:
         return "RBS::AST::Members::MethodDefinition::Overload";
     case RBS_AST_MEMBERS_PREPEND:
@@ -179,44 +182,64 @@ const char *RBS_NONNULL rbs_node_type_name(rbs_node_t *RBS_NONNULL node) {
 /* rbs_node_list */
 
 rbs_node_list_t *RBS_NONNULL rbs_node_list_new(rbs_allocator_t *RBS_NONNULL allocator) {
+    return rbs_node_list_new_with_capacity(allocator, 0);
+}
+
+rbs_node_list_t *RBS_NONNULL rbs_node_list_new_with_capacity(rbs_allocator_t *RBS_NONNULL allocator, size_t capacity) {
     rbs_node_list_t *list = rbs_allocator_alloc(allocator, rbs_node_list_t);
     *list = (rbs_node_list_t) {
         .allocator = allocator,
-        .head = NULL,
-        .tail = NULL,
+        .items = capacity > 0 ? rbs_allocator_alloc_many(allocator, capacity, rbs_node_t *) : NULL,
         .length = 0,
+        .capacity = capacity,
     };
 
     return list;
 }
 
 void rbs_node_list_append(rbs_node_list_t *RBS_NONNULL list, rbs_node_t *RBS_NONNULL node) {
-    rbs_node_list_node_t *new_node = rbs_allocator_alloc(list->allocator, rbs_node_list_node_t);
-    *new_node = (rbs_node_list_node_t) {
-        .node = node,
-        .next = NULL,
-    };
-
-    if (list->tail == NULL) {
-        list->head = new_node;
-        list->tail = new_node;
-    } else {
-        list->tail->next = new_node;
-        list->tail = new_node;
+    // Checked in release builds too, since appending to the shared empty list would corrupt every empty list.
+    rbs_assert_impl(list->allocator != NULL, "Cannot append to the shared empty list");
+
+    if (list->length == list->capacity) {
+        // Most lists have one or two nodes, like the annotations or the type arguments, so start small and double.
+        // The array of a list that is the last allocation in the arena grows in place.
+        if (list->items == NULL) {
+            list->capacity = 2;
+            list->items = rbs_allocator_alloc_many(list->allocator, list->capacity, rbs_node_t *);
+        } else {
+            size_t old_size = list->capacity * sizeof(rbs_node_t *);
+            list->capacity *= 2;
+            list->items = rbs_allocator_realloc(list->allocator, list->items, old_size, list->capacity * sizeof(rbs_node_t *), rbs_node_t *);
+        }
     }
 
-    list->length++;
+    list->items[list->length++] = node;
+}
+
+// The parser and the deserializer share these between threads, which is safe because nothing writes to them.
+static rbs_node_list_t rbs_empty_node_list = { .allocator = NULL, .items = NULL, .length = 0, .capacity = 0 };
+static rbs_hash_t rbs_empty_hash = { .allocator = NULL, .entries = NULL, .length = 0, .capacity = 0, .index = NULL, .index_capacity = 0 };
+
+rbs_node_list_t *RBS_NONNULL rbs_node_list_empty(void) {
+    return &rbs_empty_node_list;
 }
 
 /* rbs_hash */
 
+rbs_hash_t *RBS_NONNULL rbs_hash_empty(void) {
+    return &rbs_empty_hash;
+}
+
 rbs_hash_t *RBS_NONNULL rbs_hash_new(rbs_allocator_t *RBS_NONNULL allocator) {
     rbs_hash_t *hash = rbs_allocator_alloc(allocator, rbs_hash_t);
     *hash = (rbs_hash_t) {
         .allocator = allocator,
-        .head = NULL,
-        .tail = NULL,
+        .entries = NULL,
         .length = 0,
+        .capacity = 0,
+        .index = NULL,
+        .index_capacity = 0,
     };
 
     return hash;
@@ -241,37 +264,94 @@ bool rbs_node_equal(rbs_node_t *RBS_NONNULL lhs, rbs_node_t *RBS_NONNULL rhs) {
     }
 }
 
+// A hash with fewer entries than this is searched linearly, which is faster for the one or two keywords most functions
+// have than hashing.
+#define RBS_HASH_INDEX_THRESHOLD 8
+
+static size_t rbs_hash_slot(rbs_constant_id_t id, size_t mask) {
+    // Constant ids are small consecutive numbers, so spread them over the slots by multiplying with an odd constant.
+    return (size_t) (id * 2654435761u) & mask;
+}
+
+static void rbs_hash_index_insert(rbs_hash_t *RBS_NONNULL hash, size_t position) {
+    rbs_node_t *key = hash->entries[position].key;
+    if (key->type != RBS_AST_SYMBOL) return;
+
+    size_t mask = hash->index_capacity - 1;
+    size_t slot = rbs_hash_slot(((rbs_ast_symbol_t *) key)->constant_id, mask);
+    while (hash->index[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    hash->index[slot] = (uint32_t) position + 1;
+}
+
+// Builds the index with room for twice the entries, so that it stays at most half full until the next rebuild.
+static void rbs_hash_reindex(rbs_hash_t *RBS_NONNULL hash) {
+    size_t index_capacity = 16;
+    while (index_capacity < hash->length * 4) {
+        index_capacity *= 2;
+    }
+
+    hash->index = rbs_allocator_calloc(hash->allocator, index_capacity, uint32_t);
+    hash->index_capacity = index_capacity;
+
+    for (size_t i = 0; i < hash->length; i++) {
+        rbs_hash_index_insert(hash, i);
+    }
+}
+
 rbs_hash_node_t *RBS_NULLABLE rbs_hash_find(rbs_hash_t *RBS_NONNULL hash, rbs_node_t *RBS_NONNULL key) {
-    rbs_hash_node_t *current = hash->head;
+    if (hash->index != NULL && key->type == RBS_AST_SYMBOL) {
+        rbs_constant_id_t id = ((rbs_ast_symbol_t *) key)->constant_id;
+        size_t mask = hash->index_capacity - 1;
+
+        for (size_t slot = rbs_hash_slot(id, mask); hash->index[slot] != 0; slot = (slot + 1) & mask) {
+            rbs_hash_node_t *entry = &hash->entries[hash->index[slot] - 1];
+            if (entry->key->type == RBS_AST_SYMBOL && ((rbs_ast_symbol_t *) entry->key)->constant_id == id) {
+                return entry;
+            }
+        }
+
+        return NULL;
+    }
 
-    while (current != NULL) {
-        if (rbs_node_equal(key, current->key)) {
-            return current;
+    for (size_t i = 0; i < hash->length; i++) {
+        if (rbs_node_equal(key, hash->entries[i].key)) {
+            return &hash->entries[i];
         }
-        current = current->next;
     }
 
     return NULL;
 }
 
 void rbs_hash_set(rbs_hash_t *RBS_NONNULL hash, rbs_node_t *RBS_NONNULL key, rbs_node_t *RBS_NONNULL value) {
+    // Checked in release builds too, like `rbs_node_list_append`.
+    rbs_assert_impl(hash->allocator != NULL, "Cannot set to the shared empty hash");
+
     rbs_hash_node_t *existing_node = rbs_hash_find(hash, key);
     if (existing_node != NULL) {
         existing_node->value = value;
         return;
     }
 
-    rbs_hash_node_t *new_node = rbs_allocator_alloc(hash->allocator, rbs_hash_node_t);
-    new_node->key = key;
-    new_node->value = value;
-    new_node->next = NULL;
+    if (hash->length == hash->capacity) {
+        if (hash->entries == NULL) {
+            hash->capacity = 4;
+            hash->entries = rbs_allocator_alloc_many(hash->allocator, hash->capacity, rbs_hash_node_t);
+        } else {
+            size_t old_size = hash->capacity * sizeof(rbs_hash_node_t);
+            hash->capacity *= 2;
+            hash->entries = rbs_allocator_realloc(hash->allocator, hash->entries, old_size, hash->capacity * sizeof(rbs_hash_node_t), rbs_hash_node_t);
+        }
+    }
+
+    size_t position = hash->length++;
+    hash->entries[position] = (rbs_hash_node_t) { .key = key, .value = value };
 
-    if (hash->tail == NULL) {
-        hash->head = new_node;
-        hash->tail = new_node;
-    } else {
-        hash->tail->next = new_node;
-        hash->tail = new_node;
+    if (hash->index != NULL && hash->length * 2 <= hash->index_capacity) {
+        rbs_hash_index_insert(hash, position);
+    } else if (hash->length >= RBS_HASH_INDEX_THRESHOLD) {
+        rbs_hash_reindex(hash);
     }
 }
 
@@ -280,6 +360,867 @@ rbs_node_t *RBS_NULLABLE rbs_hash_get(rbs_hash_t *RBS_NONNULL hash, rbs_node_t *
     return node ? node->value : NULL;
 }
 
+static void rbs_location_range_shift(rbs_location_range *range, int char_delta, int byte_delta) {
+    if (RBS_LOCATION_NULL_RANGE_P(*range)) return;
+
+    range->start_char += char_delta;
+    range->start_byte += byte_delta;
+    range->end_char += char_delta;
+    range->end_byte += byte_delta;
+}
+
+void rbs_node_shift_locations(rbs_node_t *RBS_NULLABLE node, int char_delta, int byte_delta) {
+    if (node == NULL) return;
+
+    rbs_location_range_shift(&node->location, char_delta, byte_delta);
+
+    switch (node->type) {
+    case RBS_AST_ANNOTATION: {
+        return;
+    }
+    case RBS_AST_BOOL: {
+        return;
+    }
+    case RBS_AST_COMMENT: {
+        return;
+    }
+    case RBS_AST_DECLARATIONS_CLASS: {
+        rbs_ast_declarations_class_t *instance = (rbs_ast_declarations_class_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->end_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_params_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->lt_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->type_params != NULL) {
+            for (size_t i = 0; i < instance->type_params->length; i++) {
+                rbs_node_shift_locations(instance->type_params->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->super_class, char_delta, byte_delta);
+        if (instance->members != NULL) {
+            for (size_t i = 0; i < instance->members->length; i++) {
+                rbs_node_shift_locations(instance->members->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_DECLARATIONS_CLASS_SUPER: {
+        rbs_ast_declarations_class_super_t *instance = (rbs_ast_declarations_class_super_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DECLARATIONS_CLASS_ALIAS: {
+        rbs_ast_declarations_class_alias_t *instance = (rbs_ast_declarations_class_alias_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->new_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->eq_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->old_name_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->new_name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->old_name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DECLARATIONS_CONSTANT: {
+        rbs_ast_declarations_constant_t *instance = (rbs_ast_declarations_constant_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DECLARATIONS_GLOBAL: {
+        rbs_ast_declarations_global_t *instance = (rbs_ast_declarations_global_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DECLARATIONS_INTERFACE: {
+        rbs_ast_declarations_interface_t *instance = (rbs_ast_declarations_interface_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->end_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_params_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->type_params != NULL) {
+            for (size_t i = 0; i < instance->type_params->length; i++) {
+                rbs_node_shift_locations(instance->type_params->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->members != NULL) {
+            for (size_t i = 0; i < instance->members->length; i++) {
+                rbs_node_shift_locations(instance->members->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_DECLARATIONS_MODULE: {
+        rbs_ast_declarations_module_t *instance = (rbs_ast_declarations_module_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->end_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_params_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->self_types_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->type_params != NULL) {
+            for (size_t i = 0; i < instance->type_params->length; i++) {
+                rbs_node_shift_locations(instance->type_params->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->self_types != NULL) {
+            for (size_t i = 0; i < instance->self_types->length; i++) {
+                rbs_node_shift_locations(instance->self_types->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->members != NULL) {
+            for (size_t i = 0; i < instance->members->length; i++) {
+                rbs_node_shift_locations(instance->members->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_DECLARATIONS_MODULE_SELF: {
+        rbs_ast_declarations_module_self_t *instance = (rbs_ast_declarations_module_self_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DECLARATIONS_MODULE_ALIAS: {
+        rbs_ast_declarations_module_alias_t *instance = (rbs_ast_declarations_module_alias_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->new_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->eq_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->old_name_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->new_name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->old_name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DECLARATIONS_TYPE_ALIAS: {
+        rbs_ast_declarations_type_alias_t *instance = (rbs_ast_declarations_type_alias_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->eq_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_params_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->type_params != NULL) {
+            for (size_t i = 0; i < instance->type_params->length; i++) {
+                rbs_node_shift_locations(instance->type_params->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_DIRECTIVES_USE: {
+        rbs_ast_directives_use_t *instance = (rbs_ast_directives_use_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        if (instance->clauses != NULL) {
+            for (size_t i = 0; i < instance->clauses->length; i++) {
+                rbs_node_shift_locations(instance->clauses->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_DIRECTIVES_USE_SINGLE_CLAUSE: {
+        rbs_ast_directives_use_single_clause_t *instance = (rbs_ast_directives_use_single_clause_t *) node;
+        rbs_location_range_shift(&instance->type_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->new_name_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type_name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->new_name, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_DIRECTIVES_USE_WILDCARD_CLAUSE: {
+        rbs_ast_directives_use_wildcard_clause_t *instance = (rbs_ast_directives_use_wildcard_clause_t *) node;
+        rbs_location_range_shift(&instance->namespace_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->star_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->rbs_namespace, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_INTEGER: {
+        return;
+    }
+    case RBS_AST_MEMBERS_ALIAS: {
+        rbs_ast_members_alias_t *instance = (rbs_ast_members_alias_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->new_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->old_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->new_kind_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->old_kind_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->new_name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->old_name, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_ATTR_ACCESSOR: {
+        rbs_ast_members_attr_accessor_t *instance = (rbs_ast_members_attr_accessor_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->visibility_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_ATTR_READER: {
+        rbs_ast_members_attr_reader_t *instance = (rbs_ast_members_attr_reader_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->visibility_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_ATTR_WRITER: {
+        rbs_ast_members_attr_writer_t *instance = (rbs_ast_members_attr_writer_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->visibility_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_CLASS_INSTANCE_VARIABLE: {
+        rbs_ast_members_class_instance_variable_t *instance = (rbs_ast_members_class_instance_variable_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_CLASS_VARIABLE: {
+        rbs_ast_members_class_variable_t *instance = (rbs_ast_members_class_variable_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_EXTEND: {
+        rbs_ast_members_extend_t *instance = (rbs_ast_members_extend_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_INCLUDE: {
+        rbs_ast_members_include_t *instance = (rbs_ast_members_include_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_INSTANCE_VARIABLE: {
+        rbs_ast_members_instance_variable_t *instance = (rbs_ast_members_instance_variable_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_METHOD_DEFINITION: {
+        rbs_ast_members_method_definition_t *instance = (rbs_ast_members_method_definition_t *) node;
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->kind_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->overloading_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->visibility_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->overloads != NULL) {
+            for (size_t i = 0; i < instance->overloads->length; i++) {
+                rbs_node_shift_locations(instance->overloads->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS: {
+        rbs_ast_members_method_definition_lazy_overloads_t *instance = (rbs_ast_members_method_definition_lazy_overloads_t *) node;
+        if (instance->variables != NULL) {
+            for (size_t i = 0; i < instance->variables->length; i++) {
+                rbs_node_shift_locations(instance->variables->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD: {
+        rbs_ast_members_method_definition_overload_t *instance = (rbs_ast_members_method_definition_overload_t *) node;
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->method_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_PREPEND: {
+        rbs_ast_members_prepend_t *instance = (rbs_ast_members_prepend_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->comment, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_MEMBERS_PRIVATE: {
+        return;
+    }
+    case RBS_AST_MEMBERS_PUBLIC: {
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_BLOCK_PARAM_TYPE_ANNOTATION: {
+        rbs_ast_ruby_annotations_block_param_type_annotation_t *instance = (rbs_ast_ruby_annotations_block_param_type_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ampersand_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->question_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type_, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_CLASS_ALIAS_ANNOTATION: {
+        rbs_ast_ruby_annotations_class_alias_annotation_t *instance = (rbs_ast_ruby_annotations_class_alias_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type_name, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_name_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_COLON_METHOD_TYPE_ANNOTATION: {
+        rbs_ast_ruby_annotations_colon_method_type_annotation_t *instance = (rbs_ast_ruby_annotations_colon_method_type_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        if (instance->annotations != NULL) {
+            for (size_t i = 0; i < instance->annotations->length; i++) {
+                rbs_node_shift_locations(instance->annotations->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->method_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_DOUBLE_SPLAT_PARAM_TYPE_ANNOTATION: {
+        rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *instance = (rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->star2_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->param_type, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_INSTANCE_VARIABLE_ANNOTATION: {
+        rbs_ast_ruby_annotations_instance_variable_annotation_t *instance = (rbs_ast_ruby_annotations_instance_variable_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->ivar_name, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->ivar_name_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_METHOD_TYPES_ANNOTATION: {
+        rbs_ast_ruby_annotations_method_types_annotation_t *instance = (rbs_ast_ruby_annotations_method_types_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        if (instance->overloads != NULL) {
+            for (size_t i = 0; i < instance->overloads->length; i++) {
+                rbs_node_shift_locations(instance->overloads->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->vertical_bar_locations != NULL) {
+            for (rbs_location_range_list_node_t *n = instance->vertical_bar_locations->head; n != NULL; n = n->next) {
+                rbs_location_range_shift(&n->range, char_delta, byte_delta);
+            }
+        }
+        rbs_location_range_shift(&instance->dot3_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_MODULE_ALIAS_ANNOTATION: {
+        rbs_ast_ruby_annotations_module_alias_annotation_t *instance = (rbs_ast_ruby_annotations_module_alias_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type_name, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_name_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_MODULE_SELF_ANNOTATION: {
+        rbs_ast_ruby_annotations_module_self_annotation_t *instance = (rbs_ast_ruby_annotations_module_self_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->keyword_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_location_range_shift(&instance->open_bracket_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->close_bracket_location, char_delta, byte_delta);
+        if (instance->args_comma_locations != NULL) {
+            for (rbs_location_range_list_node_t *n = instance->args_comma_locations->head; n != NULL; n = n->next) {
+                rbs_location_range_shift(&n->range, char_delta, byte_delta);
+            }
+        }
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_NODE_TYPE_ASSERTION: {
+        rbs_ast_ruby_annotations_node_type_assertion_t *instance = (rbs_ast_ruby_annotations_node_type_assertion_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_PARAM_TYPE_ANNOTATION: {
+        rbs_ast_ruby_annotations_param_type_annotation_t *instance = (rbs_ast_ruby_annotations_param_type_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->param_type, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_RETURN_TYPE_ANNOTATION: {
+        rbs_ast_ruby_annotations_return_type_annotation_t *instance = (rbs_ast_ruby_annotations_return_type_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->return_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->return_type, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_SKIP_ANNOTATION: {
+        rbs_ast_ruby_annotations_skip_annotation_t *instance = (rbs_ast_ruby_annotations_skip_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->skip_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_SPLAT_PARAM_TYPE_ANNOTATION: {
+        rbs_ast_ruby_annotations_splat_param_type_annotation_t *instance = (rbs_ast_ruby_annotations_splat_param_type_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->star_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->name_location, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->colon_location, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->param_type, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->comment_location, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_RUBY_ANNOTATIONS_TYPE_APPLICATION_ANNOTATION: {
+        rbs_ast_ruby_annotations_type_application_annotation_t *instance = (rbs_ast_ruby_annotations_type_application_annotation_t *) node;
+        rbs_location_range_shift(&instance->prefix_location, char_delta, byte_delta);
+        if (instance->type_args != NULL) {
+            for (size_t i = 0; i < instance->type_args->length; i++) {
+                rbs_node_shift_locations(instance->type_args->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_location_range_shift(&instance->close_bracket_location, char_delta, byte_delta);
+        if (instance->comma_locations != NULL) {
+            for (rbs_location_range_list_node_t *n = instance->comma_locations->head; n != NULL; n = n->next) {
+                rbs_location_range_shift(&n->range, char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_AST_STRING: {
+        return;
+    }
+    case RBS_AST_TYPE_PARAM: {
+        rbs_ast_type_param_t *instance = (rbs_ast_type_param_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->variance_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->unchecked_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->upper_bound_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->lower_bound_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->default_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->upper_bound, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->lower_bound, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->default_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_METHOD_TYPE: {
+        rbs_method_type_t *instance = (rbs_method_type_t *) node;
+        rbs_location_range_shift(&instance->type_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->type_params_range, char_delta, byte_delta);
+        if (instance->type_params != NULL) {
+            for (size_t i = 0; i < instance->type_params->length; i++) {
+                rbs_node_shift_locations(instance->type_params->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->block, char_delta, byte_delta);
+        return;
+    }
+    case RBS_NAMESPACE: {
+        rbs_namespace_t *instance = (rbs_namespace_t *) node;
+        if (instance->path != NULL) {
+            for (size_t i = 0; i < instance->path->length; i++) {
+                rbs_node_shift_locations(instance->path->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_SIGNATURE: {
+        rbs_signature_t *instance = (rbs_signature_t *) node;
+        if (instance->directives != NULL) {
+            for (size_t i = 0; i < instance->directives->length; i++) {
+                rbs_node_shift_locations(instance->directives->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->declarations != NULL) {
+            for (size_t i = 0; i < instance->declarations->length; i++) {
+                rbs_node_shift_locations(instance->declarations->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPE_NAME: {
+        rbs_type_name_t *instance = (rbs_type_name_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->rbs_namespace, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_ALIAS: {
+        rbs_types_alias_t *instance = (rbs_types_alias_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_BASES_ANY: {
+        return;
+    }
+    case RBS_TYPES_BASES_BOOL: {
+        return;
+    }
+    case RBS_TYPES_BASES_BOTTOM: {
+        return;
+    }
+    case RBS_TYPES_BASES_CLASS: {
+        return;
+    }
+    case RBS_TYPES_BASES_INSTANCE: {
+        return;
+    }
+    case RBS_TYPES_BASES_NIL: {
+        return;
+    }
+    case RBS_TYPES_BASES_SELF: {
+        return;
+    }
+    case RBS_TYPES_BASES_TOP: {
+        return;
+    }
+    case RBS_TYPES_BASES_VOID: {
+        return;
+    }
+    case RBS_TYPES_BLOCK: {
+        rbs_types_block_t *instance = (rbs_types_block_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->self_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_CLASS_INSTANCE: {
+        rbs_types_class_instance_t *instance = (rbs_types_class_instance_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_CLASS_SINGLETON: {
+        rbs_types_class_singleton_t *instance = (rbs_types_class_singleton_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_FUNCTION: {
+        rbs_types_function_t *instance = (rbs_types_function_t *) node;
+        if (instance->required_positionals != NULL) {
+            for (size_t i = 0; i < instance->required_positionals->length; i++) {
+                rbs_node_shift_locations(instance->required_positionals->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->optional_positionals != NULL) {
+            for (size_t i = 0; i < instance->optional_positionals->length; i++) {
+                rbs_node_shift_locations(instance->optional_positionals->items[i], char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->rest_positionals, char_delta, byte_delta);
+        if (instance->trailing_positionals != NULL) {
+            for (size_t i = 0; i < instance->trailing_positionals->length; i++) {
+                rbs_node_shift_locations(instance->trailing_positionals->items[i], char_delta, byte_delta);
+            }
+        }
+        if (instance->required_keywords != NULL) {
+            for (size_t i = 0; i < instance->required_keywords->length; i++) {
+                rbs_node_shift_locations(instance->required_keywords->entries[i].key, char_delta, byte_delta);
+                rbs_node_shift_locations(instance->required_keywords->entries[i].value, char_delta, byte_delta);
+            }
+        }
+        if (instance->optional_keywords != NULL) {
+            for (size_t i = 0; i < instance->optional_keywords->length; i++) {
+                rbs_node_shift_locations(instance->optional_keywords->entries[i].key, char_delta, byte_delta);
+                rbs_node_shift_locations(instance->optional_keywords->entries[i].value, char_delta, byte_delta);
+            }
+        }
+        rbs_node_shift_locations((rbs_node_t *) instance->rest_keywords, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->forwarding, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->return_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_FUNCTION_FORWARDING_PARAM: {
+        return;
+    }
+    case RBS_TYPES_FUNCTION_PARAM: {
+        rbs_types_function_param_t *instance = (rbs_types_function_param_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_INTERFACE: {
+        rbs_types_interface_t *instance = (rbs_types_interface_t *) node;
+        rbs_location_range_shift(&instance->name_range, char_delta, byte_delta);
+        rbs_location_range_shift(&instance->args_range, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        if (instance->args != NULL) {
+            for (size_t i = 0; i < instance->args->length; i++) {
+                rbs_node_shift_locations(instance->args->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_INTERSECTION: {
+        rbs_types_intersection_t *instance = (rbs_types_intersection_t *) node;
+        if (instance->types != NULL) {
+            for (size_t i = 0; i < instance->types->length; i++) {
+                rbs_node_shift_locations(instance->types->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_LITERAL: {
+        rbs_types_literal_t *instance = (rbs_types_literal_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->literal, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_OPTIONAL: {
+        rbs_types_optional_t *instance = (rbs_types_optional_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_PROC: {
+        rbs_types_proc_t *instance = (rbs_types_proc_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->block, char_delta, byte_delta);
+        rbs_node_shift_locations((rbs_node_t *) instance->self_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_RECORD: {
+        rbs_types_record_t *instance = (rbs_types_record_t *) node;
+        if (instance->all_fields != NULL) {
+            for (size_t i = 0; i < instance->all_fields->length; i++) {
+                rbs_node_shift_locations(instance->all_fields->entries[i].key, char_delta, byte_delta);
+                rbs_node_shift_locations(instance->all_fields->entries[i].value, char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_RECORD_FIELD_TYPE: {
+        rbs_types_record_field_type_t *instance = (rbs_types_record_field_type_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_TUPLE: {
+        rbs_types_tuple_t *instance = (rbs_types_tuple_t *) node;
+        if (instance->types != NULL) {
+            for (size_t i = 0; i < instance->types->length; i++) {
+                rbs_node_shift_locations(instance->types->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_UNION: {
+        rbs_types_union_t *instance = (rbs_types_union_t *) node;
+        if (instance->types != NULL) {
+            for (size_t i = 0; i < instance->types->length; i++) {
+                rbs_node_shift_locations(instance->types->items[i], char_delta, byte_delta);
+            }
+        }
+        return;
+    }
+    case RBS_TYPES_UNTYPED_FUNCTION: {
+        rbs_types_untyped_function_t *instance = (rbs_types_untyped_function_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->return_type, char_delta, byte_delta);
+        return;
+    }
+    case RBS_TYPES_VARIABLE: {
+        rbs_types_variable_t *instance = (rbs_types_variable_t *) node;
+        rbs_node_shift_locations((rbs_node_t *) instance->name, char_delta, byte_delta);
+        return;
+    }
+    case RBS_AST_SYMBOL:
+        return;
+    }
+}
+
 rbs_ast_symbol_t *RBS_NONNULL rbs_ast_symbol_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_constant_pool_t *RBS_NONNULL constant_pool, rbs_constant_id_t constant_id) {
     rbs_ast_symbol_t *instance = rbs_allocator_alloc(allocator, rbs_ast_symbol_t);
 
@@ -294,7 +1235,7 @@ rbs_ast_symbol_t *RBS_NONNULL rbs_ast_symbol_new(rbs_allocator_t *RBS_NONNULL al
     return instance;
 }
 
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_annotation_t *RBS_NONNULL rbs_ast_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_string_t string) {
     rbs_ast_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_annotation_t);
 
@@ -308,7 +1249,7 @@ rbs_ast_annotation_t *RBS_NONNULL rbs_ast_annotation_new(rbs_allocator_t *RBS_NO
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_bool_t *RBS_NONNULL rbs_ast_bool_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, bool value) {
     rbs_ast_bool_t *instance = rbs_allocator_alloc(allocator, rbs_ast_bool_t);
 
@@ -322,7 +1263,7 @@ rbs_ast_bool_t *RBS_NONNULL rbs_ast_bool_new(rbs_allocator_t *RBS_NONNULL alloca
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_comment_t *RBS_NONNULL rbs_ast_comment_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_string_t string) {
     rbs_ast_comment_t *instance = rbs_allocator_alloc(allocator, rbs_ast_comment_t);
 
@@ -336,7 +1277,7 @@ rbs_ast_comment_t *RBS_NONNULL rbs_ast_comment_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_class_t *RBS_NONNULL rbs_ast_declarations_class_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL type_params, rbs_ast_declarations_class_super_t *RBS_NULLABLE super_class, rbs_node_list_t *RBS_NONNULL members, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range end_range) {
     rbs_ast_declarations_class_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_class_t);
 
@@ -360,7 +1301,7 @@ rbs_ast_declarations_class_t *RBS_NONNULL rbs_ast_declarations_class_new(rbs_all
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_class_super_t *RBS_NONNULL rbs_ast_declarations_class_super_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range name_range) {
     rbs_ast_declarations_class_super_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_class_super_t);
 
@@ -377,7 +1318,7 @@ rbs_ast_declarations_class_super_t *RBS_NONNULL rbs_ast_declarations_class_super
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_class_alias_t *RBS_NONNULL rbs_ast_declarations_class_alias_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL new_name, rbs_type_name_t *RBS_NONNULL old_name, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_node_list_t *RBS_NONNULL annotations, rbs_location_range keyword_range, rbs_location_range new_name_range, rbs_location_range eq_range, rbs_location_range old_name_range) {
     rbs_ast_declarations_class_alias_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_class_alias_t);
 
@@ -398,7 +1339,7 @@ rbs_ast_declarations_class_alias_t *RBS_NONNULL rbs_ast_declarations_class_alias
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_constant_t *RBS_NONNULL rbs_ast_declarations_constant_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_node_list_t *RBS_NONNULL annotations, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_declarations_constant_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_constant_t);
 
@@ -417,7 +1358,7 @@ rbs_ast_declarations_constant_t *RBS_NONNULL rbs_ast_declarations_constant_new(r
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_global_t *RBS_NONNULL rbs_ast_declarations_global_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_node_list_t *RBS_NONNULL annotations, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_declarations_global_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_global_t);
 
@@ -436,7 +1377,7 @@ rbs_ast_declarations_global_t *RBS_NONNULL rbs_ast_declarations_global_new(rbs_a
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_interface_t *RBS_NONNULL rbs_ast_declarations_interface_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL type_params, rbs_node_list_t *RBS_NONNULL members, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range end_range) {
     rbs_ast_declarations_interface_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_interface_t);
 
@@ -458,7 +1399,7 @@ rbs_ast_declarations_interface_t *RBS_NONNULL rbs_ast_declarations_interface_new
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_module_t *RBS_NONNULL rbs_ast_declarations_module_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL type_params, rbs_node_list_t *RBS_NONNULL self_types, rbs_node_list_t *RBS_NONNULL members, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range end_range) {
     rbs_ast_declarations_module_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_module_t);
 
@@ -483,7 +1424,7 @@ rbs_ast_declarations_module_t *RBS_NONNULL rbs_ast_declarations_module_new(rbs_a
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_module_self_t *RBS_NONNULL rbs_ast_declarations_module_self_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range name_range) {
     rbs_ast_declarations_module_self_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_module_self_t);
 
@@ -500,7 +1441,7 @@ rbs_ast_declarations_module_self_t *RBS_NONNULL rbs_ast_declarations_module_self
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_module_alias_t *RBS_NONNULL rbs_ast_declarations_module_alias_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL new_name, rbs_type_name_t *RBS_NONNULL old_name, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_node_list_t *RBS_NONNULL annotations, rbs_location_range keyword_range, rbs_location_range new_name_range, rbs_location_range eq_range, rbs_location_range old_name_range) {
     rbs_ast_declarations_module_alias_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_module_alias_t);
 
@@ -521,7 +1462,7 @@ rbs_ast_declarations_module_alias_t *RBS_NONNULL rbs_ast_declarations_module_ali
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_declarations_type_alias_t *RBS_NONNULL rbs_ast_declarations_type_alias_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL type_params, rbs_node_t *RBS_NONNULL type, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range eq_range) {
     rbs_ast_declarations_type_alias_t *instance = rbs_allocator_alloc(allocator, rbs_ast_declarations_type_alias_t);
 
@@ -543,7 +1484,7 @@ rbs_ast_declarations_type_alias_t *RBS_NONNULL rbs_ast_declarations_type_alias_n
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_directives_use_t *RBS_NONNULL rbs_ast_directives_use_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL clauses, rbs_location_range keyword_range) {
     rbs_ast_directives_use_t *instance = rbs_allocator_alloc(allocator, rbs_ast_directives_use_t);
 
@@ -558,7 +1499,7 @@ rbs_ast_directives_use_t *RBS_NONNULL rbs_ast_directives_use_new(rbs_allocator_t
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_directives_use_single_clause_t *RBS_NONNULL rbs_ast_directives_use_single_clause_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL type_name, rbs_ast_symbol_t *RBS_NULLABLE new_name, rbs_location_range type_name_range) {
     rbs_ast_directives_use_single_clause_t *instance = rbs_allocator_alloc(allocator, rbs_ast_directives_use_single_clause_t);
 
@@ -576,7 +1517,7 @@ rbs_ast_directives_use_single_clause_t *RBS_NONNULL rbs_ast_directives_use_singl
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_directives_use_wildcard_clause_t *RBS_NONNULL rbs_ast_directives_use_wildcard_clause_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_namespace_t *RBS_NONNULL rbs_namespace, rbs_location_range namespace_range, rbs_location_range star_range) {
     rbs_ast_directives_use_wildcard_clause_t *instance = rbs_allocator_alloc(allocator, rbs_ast_directives_use_wildcard_clause_t);
 
@@ -592,7 +1533,7 @@ rbs_ast_directives_use_wildcard_clause_t *RBS_NONNULL rbs_ast_directives_use_wil
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_integer_t *RBS_NONNULL rbs_ast_integer_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_string_t string_representation) {
     rbs_ast_integer_t *instance = rbs_allocator_alloc(allocator, rbs_ast_integer_t);
 
@@ -606,7 +1547,7 @@ rbs_ast_integer_t *RBS_NONNULL rbs_ast_integer_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_alias_t *RBS_NONNULL rbs_ast_members_alias_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL new_name, rbs_ast_symbol_t *RBS_NONNULL old_name, enum rbs_alias_kind kind, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range keyword_range, rbs_location_range new_name_range, rbs_location_range old_name_range) {
     rbs_ast_members_alias_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_alias_t);
 
@@ -629,7 +1570,7 @@ rbs_ast_members_alias_t *RBS_NONNULL rbs_ast_members_alias_new(rbs_allocator_t *
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_attr_accessor_t *RBS_NONNULL rbs_ast_members_attr_accessor_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_attr_ivar_name_t ivar_name, enum rbs_attribute_kind kind, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, enum rbs_attribute_visibility visibility, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_members_attr_accessor_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_attr_accessor_t);
 
@@ -656,7 +1597,7 @@ rbs_ast_members_attr_accessor_t *RBS_NONNULL rbs_ast_members_attr_accessor_new(r
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_attr_reader_t *RBS_NONNULL rbs_ast_members_attr_reader_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_attr_ivar_name_t ivar_name, enum rbs_attribute_kind kind, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, enum rbs_attribute_visibility visibility, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_members_attr_reader_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_attr_reader_t);
 
@@ -683,7 +1624,7 @@ rbs_ast_members_attr_reader_t *RBS_NONNULL rbs_ast_members_attr_reader_new(rbs_a
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_attr_writer_t *RBS_NONNULL rbs_ast_members_attr_writer_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_attr_ivar_name_t ivar_name, enum rbs_attribute_kind kind, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, enum rbs_attribute_visibility visibility, rbs_location_range keyword_range, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_members_attr_writer_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_attr_writer_t);
 
@@ -710,7 +1651,7 @@ rbs_ast_members_attr_writer_t *RBS_NONNULL rbs_ast_members_attr_writer_new(rbs_a
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_class_instance_variable_t *RBS_NONNULL rbs_ast_members_class_instance_variable_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_members_class_instance_variable_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_class_instance_variable_t);
 
@@ -729,7 +1670,7 @@ rbs_ast_members_class_instance_variable_t *RBS_NONNULL rbs_ast_members_class_ins
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_class_variable_t *RBS_NONNULL rbs_ast_members_class_variable_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_members_class_variable_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_class_variable_t);
 
@@ -748,7 +1689,7 @@ rbs_ast_members_class_variable_t *RBS_NONNULL rbs_ast_members_class_variable_new
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_extend_t *RBS_NONNULL rbs_ast_members_extend_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range keyword_range) {
     rbs_ast_members_extend_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_extend_t);
 
@@ -768,7 +1709,7 @@ rbs_ast_members_extend_t *RBS_NONNULL rbs_ast_members_extend_new(rbs_allocator_t
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_include_t *RBS_NONNULL rbs_ast_members_include_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range keyword_range) {
     rbs_ast_members_include_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_include_t);
 
@@ -788,7 +1729,7 @@ rbs_ast_members_include_t *RBS_NONNULL rbs_ast_members_include_new(rbs_allocator
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_instance_variable_t *RBS_NONNULL rbs_ast_members_instance_variable_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, rbs_node_t *RBS_NONNULL type, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range colon_range) {
     rbs_ast_members_instance_variable_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_instance_variable_t);
 
@@ -807,7 +1748,7 @@ rbs_ast_members_instance_variable_t *RBS_NONNULL rbs_ast_members_instance_variab
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_method_definition_t *RBS_NONNULL rbs_ast_members_method_definition_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, enum rbs_method_definition_kind kind, rbs_node_list_t *RBS_NONNULL overloads, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, bool overloading, enum rbs_method_definition_visibility visibility, rbs_location_range keyword_range, rbs_location_range name_range) {
     rbs_ast_members_method_definition_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_method_definition_t);
 
@@ -832,7 +1773,22 @@ rbs_ast_members_method_definition_t *RBS_NONNULL rbs_ast_members_method_definiti
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
+rbs_ast_members_method_definition_lazy_overloads_t *RBS_NONNULL rbs_ast_members_method_definition_lazy_overloads_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL variables, bool classish_allowed) {
+    rbs_ast_members_method_definition_lazy_overloads_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_method_definition_lazy_overloads_t);
+
+    *instance = (rbs_ast_members_method_definition_lazy_overloads_t) {
+        .base = (rbs_node_t) {
+            .type = RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS,
+            .location = location,
+        },
+        .variables = variables,
+        .classish_allowed = classish_allowed,
+    };
+
+    return instance;
+}
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_method_definition_overload_t *RBS_NONNULL rbs_ast_members_method_definition_overload_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL annotations, rbs_node_t *RBS_NONNULL method_type) {
     rbs_ast_members_method_definition_overload_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_method_definition_overload_t);
 
@@ -847,7 +1803,7 @@ rbs_ast_members_method_definition_overload_t *RBS_NONNULL rbs_ast_members_method
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_prepend_t *RBS_NONNULL rbs_ast_members_prepend_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_node_list_t *RBS_NONNULL annotations, rbs_ast_comment_t *RBS_NULLABLE comment, rbs_location_range name_range, rbs_location_range keyword_range) {
     rbs_ast_members_prepend_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_prepend_t);
 
@@ -867,7 +1823,7 @@ rbs_ast_members_prepend_t *RBS_NONNULL rbs_ast_members_prepend_new(rbs_allocator
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_private_t *RBS_NONNULL rbs_ast_members_private_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_ast_members_private_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_private_t);
 
@@ -880,7 +1836,7 @@ rbs_ast_members_private_t *RBS_NONNULL rbs_ast_members_private_new(rbs_allocator
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_members_public_t *RBS_NONNULL rbs_ast_members_public_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_ast_members_public_t *instance = rbs_allocator_alloc(allocator, rbs_ast_members_public_t);
 
@@ -893,7 +1849,7 @@ rbs_ast_members_public_t *RBS_NONNULL rbs_ast_members_public_new(rbs_allocator_t
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_block_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_block_param_type_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range ampersand_location, rbs_location_range name_location, rbs_location_range colon_location, rbs_location_range question_location, rbs_location_range type_location, rbs_node_t *RBS_NONNULL type_, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_block_param_type_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_block_param_type_annotation_t);
 
@@ -914,7 +1870,7 @@ rbs_ast_ruby_annotations_block_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_class_alias_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_class_alias_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range keyword_location, rbs_type_name_t *RBS_NULLABLE type_name, rbs_location_range type_name_location) {
     rbs_ast_ruby_annotations_class_alias_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_class_alias_annotation_t);
 
@@ -931,7 +1887,7 @@ rbs_ast_ruby_annotations_class_alias_annotation_t *RBS_NONNULL rbs_ast_ruby_anno
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_colon_method_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_colon_method_type_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_node_list_t *RBS_NONNULL annotations, rbs_node_t *RBS_NONNULL method_type) {
     rbs_ast_ruby_annotations_colon_method_type_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_colon_method_type_annotation_t);
 
@@ -947,7 +1903,7 @@ rbs_ast_ruby_annotations_colon_method_type_annotation_t *RBS_NONNULL rbs_ast_rub
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_double_splat_param_type_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range star2_location, rbs_location_range name_location, rbs_location_range colon_location, rbs_node_t *RBS_NONNULL param_type, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_double_splat_param_type_annotation_t);
 
@@ -966,7 +1922,7 @@ rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *RBS_NONNULL rbs_a
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_instance_variable_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_instance_variable_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_ast_symbol_t *RBS_NONNULL ivar_name, rbs_location_range ivar_name_location, rbs_location_range colon_location, rbs_node_t *RBS_NONNULL type, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_instance_variable_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_instance_variable_annotation_t);
 
@@ -985,7 +1941,7 @@ rbs_ast_ruby_annotations_instance_variable_annotation_t *RBS_NONNULL rbs_ast_rub
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_method_types_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_method_types_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_node_list_t *RBS_NONNULL overloads, rbs_location_range_list_t *RBS_NONNULL vertical_bar_locations, rbs_location_range dot3_location) {
     rbs_ast_ruby_annotations_method_types_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_method_types_annotation_t);
 
@@ -1002,7 +1958,7 @@ rbs_ast_ruby_annotations_method_types_annotation_t *RBS_NONNULL rbs_ast_ruby_ann
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_module_alias_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_module_alias_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range keyword_location, rbs_type_name_t *RBS_NULLABLE type_name, rbs_location_range type_name_location) {
     rbs_ast_ruby_annotations_module_alias_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_module_alias_annotation_t);
 
@@ -1019,7 +1975,7 @@ rbs_ast_ruby_annotations_module_alias_annotation_t *RBS_NONNULL rbs_ast_ruby_ann
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_module_self_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_module_self_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range keyword_location, rbs_location_range colon_location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range open_bracket_location, rbs_location_range close_bracket_location, rbs_location_range_list_t *RBS_NONNULL args_comma_locations, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_module_self_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_module_self_annotation_t);
 
@@ -1041,7 +1997,7 @@ rbs_ast_ruby_annotations_module_self_annotation_t *RBS_NONNULL rbs_ast_ruby_anno
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_node_type_assertion_t *RBS_NONNULL rbs_ast_ruby_annotations_node_type_assertion_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_node_t *RBS_NONNULL type) {
     rbs_ast_ruby_annotations_node_type_assertion_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_node_type_assertion_t);
 
@@ -1056,7 +2012,7 @@ rbs_ast_ruby_annotations_node_type_assertion_t *RBS_NONNULL rbs_ast_ruby_annotat
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_param_type_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range name_location, rbs_location_range colon_location, rbs_node_t *RBS_NONNULL param_type, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_param_type_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_param_type_annotation_t);
 
@@ -1074,7 +2030,7 @@ rbs_ast_ruby_annotations_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annot
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_return_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_return_type_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range return_location, rbs_location_range colon_location, rbs_node_t *RBS_NONNULL return_type, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_return_type_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_return_type_annotation_t);
 
@@ -1092,7 +2048,7 @@ rbs_ast_ruby_annotations_return_type_annotation_t *RBS_NONNULL rbs_ast_ruby_anno
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_skip_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_skip_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range skip_location, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_skip_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_skip_annotation_t);
 
@@ -1108,7 +2064,7 @@ rbs_ast_ruby_annotations_skip_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_splat_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_splat_param_type_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_location_range star_location, rbs_location_range name_location, rbs_location_range colon_location, rbs_node_t *RBS_NONNULL param_type, rbs_location_range comment_location) {
     rbs_ast_ruby_annotations_splat_param_type_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_splat_param_type_annotation_t);
 
@@ -1127,7 +2083,7 @@ rbs_ast_ruby_annotations_splat_param_type_annotation_t *RBS_NONNULL rbs_ast_ruby
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_ruby_annotations_type_application_annotation_t *RBS_NONNULL rbs_ast_ruby_annotations_type_application_annotation_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_location_range prefix_location, rbs_node_list_t *RBS_NONNULL type_args, rbs_location_range close_bracket_location, rbs_location_range_list_t *RBS_NONNULL comma_locations) {
     rbs_ast_ruby_annotations_type_application_annotation_t *instance = rbs_allocator_alloc(allocator, rbs_ast_ruby_annotations_type_application_annotation_t);
 
@@ -1144,7 +2100,7 @@ rbs_ast_ruby_annotations_type_application_annotation_t *RBS_NONNULL rbs_ast_ruby
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_string_t *RBS_NONNULL rbs_ast_string_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_string_t string) {
     rbs_ast_string_t *instance = rbs_allocator_alloc(allocator, rbs_ast_string_t);
 
@@ -1158,7 +2114,7 @@ rbs_ast_string_t *RBS_NONNULL rbs_ast_string_new(rbs_allocator_t *RBS_NONNULL al
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_ast_type_param_t *RBS_NONNULL rbs_ast_type_param_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name, enum rbs_type_param_variance variance, rbs_node_t *RBS_NULLABLE upper_bound, rbs_node_t *RBS_NULLABLE lower_bound, rbs_node_t *RBS_NULLABLE default_type, bool unchecked, rbs_location_range name_range) {
     rbs_ast_type_param_t *instance = rbs_allocator_alloc(allocator, rbs_ast_type_param_t);
 
@@ -1183,7 +2139,7 @@ rbs_ast_type_param_t *RBS_NONNULL rbs_ast_type_param_new(rbs_allocator_t *RBS_NO
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_method_type_t *RBS_NONNULL rbs_method_type_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL type_params, rbs_node_t *RBS_NONNULL type, rbs_types_block_t *RBS_NULLABLE block, rbs_location_range type_range) {
     rbs_method_type_t *instance = rbs_allocator_alloc(allocator, rbs_method_type_t);
 
@@ -1201,7 +2157,7 @@ rbs_method_type_t *RBS_NONNULL rbs_method_type_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_namespace_t *RBS_NONNULL rbs_namespace_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL path, bool absolute) {
     rbs_namespace_t *instance = rbs_allocator_alloc(allocator, rbs_namespace_t);
 
@@ -1216,7 +2172,7 @@ rbs_namespace_t *RBS_NONNULL rbs_namespace_new(rbs_allocator_t *RBS_NONNULL allo
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_signature_t *RBS_NONNULL rbs_signature_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL directives, rbs_node_list_t *RBS_NONNULL declarations) {
     rbs_signature_t *instance = rbs_allocator_alloc(allocator, rbs_signature_t);
 
@@ -1231,7 +2187,7 @@ rbs_signature_t *RBS_NONNULL rbs_signature_new(rbs_allocator_t *RBS_NONNULL allo
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_type_name_t *RBS_NONNULL rbs_type_name_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_namespace_t *RBS_NONNULL rbs_namespace, rbs_ast_symbol_t *RBS_NONNULL name) {
     rbs_type_name_t *instance = rbs_allocator_alloc(allocator, rbs_type_name_t);
 
@@ -1246,7 +2202,7 @@ rbs_type_name_t *RBS_NONNULL rbs_type_name_new(rbs_allocator_t *RBS_NONNULL allo
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_alias_t *RBS_NONNULL rbs_types_alias_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range name_range) {
     rbs_types_alias_t *instance = rbs_allocator_alloc(allocator, rbs_types_alias_t);
 
@@ -1263,7 +2219,7 @@ rbs_types_alias_t *RBS_NONNULL rbs_types_alias_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_any_t *RBS_NONNULL rbs_types_bases_any_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, bool todo) {
     rbs_types_bases_any_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_any_t);
 
@@ -1277,7 +2233,7 @@ rbs_types_bases_any_t *RBS_NONNULL rbs_types_bases_any_new(rbs_allocator_t *RBS_
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_bool_t *RBS_NONNULL rbs_types_bases_bool_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_bool_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_bool_t);
 
@@ -1290,7 +2246,7 @@ rbs_types_bases_bool_t *RBS_NONNULL rbs_types_bases_bool_new(rbs_allocator_t *RB
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_bottom_t *RBS_NONNULL rbs_types_bases_bottom_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_bottom_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_bottom_t);
 
@@ -1303,7 +2259,7 @@ rbs_types_bases_bottom_t *RBS_NONNULL rbs_types_bases_bottom_new(rbs_allocator_t
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_class_t *RBS_NONNULL rbs_types_bases_class_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_class_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_class_t);
 
@@ -1316,7 +2272,7 @@ rbs_types_bases_class_t *RBS_NONNULL rbs_types_bases_class_new(rbs_allocator_t *
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_instance_t *RBS_NONNULL rbs_types_bases_instance_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_instance_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_instance_t);
 
@@ -1329,7 +2285,7 @@ rbs_types_bases_instance_t *RBS_NONNULL rbs_types_bases_instance_new(rbs_allocat
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_nil_t *RBS_NONNULL rbs_types_bases_nil_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_nil_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_nil_t);
 
@@ -1342,7 +2298,7 @@ rbs_types_bases_nil_t *RBS_NONNULL rbs_types_bases_nil_new(rbs_allocator_t *RBS_
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_self_t *RBS_NONNULL rbs_types_bases_self_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_self_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_self_t);
 
@@ -1355,7 +2311,7 @@ rbs_types_bases_self_t *RBS_NONNULL rbs_types_bases_self_new(rbs_allocator_t *RB
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_top_t *RBS_NONNULL rbs_types_bases_top_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_top_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_top_t);
 
@@ -1368,7 +2324,7 @@ rbs_types_bases_top_t *RBS_NONNULL rbs_types_bases_top_new(rbs_allocator_t *RBS_
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_bases_void_t *RBS_NONNULL rbs_types_bases_void_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_bases_void_t *instance = rbs_allocator_alloc(allocator, rbs_types_bases_void_t);
 
@@ -1381,7 +2337,7 @@ rbs_types_bases_void_t *RBS_NONNULL rbs_types_bases_void_new(rbs_allocator_t *RB
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_block_t *RBS_NONNULL rbs_types_block_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL type, bool required, rbs_node_t *RBS_NULLABLE self_type) {
     rbs_types_block_t *instance = rbs_allocator_alloc(allocator, rbs_types_block_t);
 
@@ -1397,7 +2353,7 @@ rbs_types_block_t *RBS_NONNULL rbs_types_block_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_class_instance_t *RBS_NONNULL rbs_types_class_instance_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range name_range) {
     rbs_types_class_instance_t *instance = rbs_allocator_alloc(allocator, rbs_types_class_instance_t);
 
@@ -1414,7 +2370,7 @@ rbs_types_class_instance_t *RBS_NONNULL rbs_types_class_instance_new(rbs_allocat
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_class_singleton_t *RBS_NONNULL rbs_types_class_singleton_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range name_range) {
     rbs_types_class_singleton_t *instance = rbs_allocator_alloc(allocator, rbs_types_class_singleton_t);
 
@@ -1431,7 +2387,7 @@ rbs_types_class_singleton_t *RBS_NONNULL rbs_types_class_singleton_new(rbs_alloc
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_function_t *RBS_NONNULL rbs_types_function_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL required_positionals, rbs_node_list_t *RBS_NONNULL optional_positionals, rbs_node_t *RBS_NULLABLE rest_positionals, rbs_node_list_t *RBS_NONNULL trailing_positionals, rbs_hash_t *RBS_NONNULL required_keywords, rbs_hash_t *RBS_NONNULL optional_keywords, rbs_node_t *RBS_NULLABLE rest_keywords, rbs_node_t *RBS_NULLABLE forwarding, rbs_node_t *RBS_NONNULL return_type) {
     rbs_types_function_t *instance = rbs_allocator_alloc(allocator, rbs_types_function_t);
 
@@ -1453,7 +2409,7 @@ rbs_types_function_t *RBS_NONNULL rbs_types_function_new(rbs_allocator_t *RBS_NO
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_function_forwarding_param_t *RBS_NONNULL rbs_types_function_forwarding_param_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location) {
     rbs_types_function_forwarding_param_t *instance = rbs_allocator_alloc(allocator, rbs_types_function_forwarding_param_t);
 
@@ -1466,7 +2422,7 @@ rbs_types_function_forwarding_param_t *RBS_NONNULL rbs_types_function_forwarding
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_function_param_t *RBS_NONNULL rbs_types_function_param_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL type, rbs_ast_symbol_t *RBS_NULLABLE name) {
     rbs_types_function_param_t *instance = rbs_allocator_alloc(allocator, rbs_types_function_param_t);
 
@@ -1482,7 +2438,7 @@ rbs_types_function_param_t *RBS_NONNULL rbs_types_function_param_new(rbs_allocat
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_interface_t *RBS_NONNULL rbs_types_interface_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_type_name_t *RBS_NONNULL name, rbs_node_list_t *RBS_NONNULL args, rbs_location_range name_range) {
     rbs_types_interface_t *instance = rbs_allocator_alloc(allocator, rbs_types_interface_t);
 
@@ -1499,7 +2455,7 @@ rbs_types_interface_t *RBS_NONNULL rbs_types_interface_new(rbs_allocator_t *RBS_
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_intersection_t *RBS_NONNULL rbs_types_intersection_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL types) {
     rbs_types_intersection_t *instance = rbs_allocator_alloc(allocator, rbs_types_intersection_t);
 
@@ -1513,7 +2469,7 @@ rbs_types_intersection_t *RBS_NONNULL rbs_types_intersection_new(rbs_allocator_t
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_literal_t *RBS_NONNULL rbs_types_literal_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL literal) {
     rbs_types_literal_t *instance = rbs_allocator_alloc(allocator, rbs_types_literal_t);
 
@@ -1527,7 +2483,7 @@ rbs_types_literal_t *RBS_NONNULL rbs_types_literal_new(rbs_allocator_t *RBS_NONN
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_optional_t *RBS_NONNULL rbs_types_optional_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL type) {
     rbs_types_optional_t *instance = rbs_allocator_alloc(allocator, rbs_types_optional_t);
 
@@ -1541,7 +2497,7 @@ rbs_types_optional_t *RBS_NONNULL rbs_types_optional_new(rbs_allocator_t *RBS_NO
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_proc_t *RBS_NONNULL rbs_types_proc_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL type, rbs_types_block_t *RBS_NULLABLE block, rbs_node_t *RBS_NULLABLE self_type) {
     rbs_types_proc_t *instance = rbs_allocator_alloc(allocator, rbs_types_proc_t);
 
@@ -1557,7 +2513,7 @@ rbs_types_proc_t *RBS_NONNULL rbs_types_proc_new(rbs_allocator_t *RBS_NONNULL al
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_record_t *RBS_NONNULL rbs_types_record_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_hash_t *RBS_NONNULL all_fields) {
     rbs_types_record_t *instance = rbs_allocator_alloc(allocator, rbs_types_record_t);
 
@@ -1571,7 +2527,7 @@ rbs_types_record_t *RBS_NONNULL rbs_types_record_new(rbs_allocator_t *RBS_NONNUL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_record_field_type_t *RBS_NONNULL rbs_types_record_field_type_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL type, bool required) {
     rbs_types_record_field_type_t *instance = rbs_allocator_alloc(allocator, rbs_types_record_field_type_t);
 
@@ -1586,7 +2542,7 @@ rbs_types_record_field_type_t *RBS_NONNULL rbs_types_record_field_type_new(rbs_a
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_tuple_t *RBS_NONNULL rbs_types_tuple_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL types) {
     rbs_types_tuple_t *instance = rbs_allocator_alloc(allocator, rbs_types_tuple_t);
 
@@ -1600,7 +2556,7 @@ rbs_types_tuple_t *RBS_NONNULL rbs_types_tuple_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_union_t *RBS_NONNULL rbs_types_union_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_list_t *RBS_NONNULL types) {
     rbs_types_union_t *instance = rbs_allocator_alloc(allocator, rbs_types_union_t);
 
@@ -1614,7 +2570,7 @@ rbs_types_union_t *RBS_NONNULL rbs_types_union_new(rbs_allocator_t *RBS_NONNULL
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_untyped_function_t *RBS_NONNULL rbs_types_untyped_function_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_node_t *RBS_NONNULL return_type) {
     rbs_types_untyped_function_t *instance = rbs_allocator_alloc(allocator, rbs_types_untyped_function_t);
 
@@ -1628,7 +2584,7 @@ rbs_types_untyped_function_t *RBS_NONNULL rbs_types_untyped_function_new(rbs_all
 
     return instance;
 }
-#line 140 "templates/src/ast.c.erb"
+#line 277 "templates/src/ast.c.erb"
 rbs_types_variable_t *RBS_NONNULL rbs_types_variable_new(rbs_allocator_t *RBS_NONNULL allocator, rbs_location_range location, rbs_ast_symbol_t *RBS_NONNULL name) {
     rbs_types_variable_t *instance = rbs_allocator_alloc(allocator, rbs_types_variable_t);
 
@@ -0,0 +1,1430 @@
+/*----------------------------------------------------------------------------*/
+/* This file is generated by the templates/template.rb script and should not  */
+/* be modified manually.                                                      */
+/* To change the template see                                                 */
+/* templates/src/deserialize.c.erb                                            */
+/*----------------------------------------------------------------------------*/
+
+#include "rbs/deserialize.h"
+
+#include "rbs/location.h"
+
+/**
+ * State threaded through the recursive deserializer: the arena the nodes are
+ * allocated in, the constant pool symbols are interned into, the constants of
+ * the buffer's constant table, and the read cursor. `failed` is set on the first
+ * malformed read; after that every read returns zero/NULL and the caller
+ * discards the partial tree.
+ */
+typedef struct {
+    rbs_allocator_t *allocator;
+    rbs_constant_pool_t *constant_pool;
+    rbs_constant_id_t *constants;
+    uint32_t constants_count;
+    const uint8_t *cursor;
+    const uint8_t *end;
+    bool failed;
+} rbs_deserialize_state;
+
+/* All multi-byte integers are read little-endian. */
+
+static const uint8_t *r_bytes(rbs_deserialize_state *state, size_t length) {
+    if (state->failed || (size_t) (state->end - state->cursor) < length) {
+        state->failed = true;
+        return NULL;
+    }
+
+    const uint8_t *bytes = state->cursor;
+    state->cursor += length;
+    return bytes;
+}
+
+static uint8_t r_u8(rbs_deserialize_state *state) {
+    const uint8_t *bytes = r_bytes(state, 1);
+    return bytes == NULL ? 0 : bytes[0];
+}
+
+static uint32_t r_u32(rbs_deserialize_state *state) {
+    const uint8_t *bytes = r_bytes(state, 4);
+    if (bytes == NULL) {
+        return 0;
+    }
+
+    return (uint32_t) bytes[0] | ((uint32_t) bytes[1] << 8) | ((uint32_t) bytes[2] << 16) | ((uint32_t) bytes[3] << 24);
+}
+
+static int32_t r_i32(rbs_deserialize_state *state) {
+    return (int32_t) r_u32(state);
+}
+
+static bool r_bool(rbs_deserialize_state *state) {
+    return r_u8(state) != 0;
+}
+
+static rbs_string_t r_string(rbs_deserialize_state *state) {
+    uint32_t length = r_u32(state);
+    const uint8_t *bytes = r_bytes(state, length);
+    if (bytes == NULL) {
+        return RBS_STRING_NULL;
+    }
+
+    return rbs_string_new((const char *) bytes, (const char *) bytes + length);
+}
+
+// Reads the constant table at the start of the buffer, interning each constant once.
+static void r_constant_table(rbs_deserialize_state *state) {
+    uint32_t count = r_u32(state);
+
+    // Every constant takes at least its 4-byte length, so a larger count cannot be right.
+    if (state->failed || count > (size_t) (state->end - state->cursor) / 4) {
+        state->failed = true;
+        return;
+    }
+
+    state->constants = rbs_allocator_alloc_many(state->allocator, count > 0 ? count : 1, rbs_constant_id_t);
+    state->constants_count = count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t length = r_u32(state);
+        const uint8_t *bytes = r_bytes(state, length);
+        if (bytes == NULL) {
+            return;
+        }
+
+        state->constants[i] = rbs_constant_pool_insert_shared(state->constant_pool, bytes, length);
+    }
+}
+
+static rbs_constant_id_t r_constant(rbs_deserialize_state *state) {
+    uint32_t index = r_u32(state);
+    if (state->failed || index >= state->constants_count) {
+        state->failed = true;
+        return RBS_CONSTANT_ID_UNSET;
+    }
+
+    return state->constants[index];
+}
+
+static rbs_location_range r_loc_range(rbs_deserialize_state *state) {
+    if (!r_bool(state)) {
+        return RBS_LOCATION_NULL_RANGE;
+    }
+
+    int32_t start_char = r_i32(state);
+    int32_t end_char = r_i32(state);
+
+    return (rbs_location_range) {
+        .start_char = start_char,
+        .start_byte = -1,
+        .end_char = end_char,
+        .end_byte = -1,
+    };
+}
+
+static rbs_location_range_list_t *r_loc_range_list(rbs_deserialize_state *state) {
+    uint32_t count = r_u32(state);
+    if (count == 0) {
+        return NULL;
+    }
+
+    rbs_location_range_list_t *list = rbs_location_range_list_new(state->allocator);
+    for (uint32_t i = 0; i < count && !state->failed; i++) {
+        rbs_location_range_list_append(list, r_loc_range(state));
+    }
+
+    return list;
+}
+
+static rbs_attr_ivar_name_t r_attr_ivar_name(rbs_deserialize_state *state) {
+    rbs_attr_ivar_name_t ivar_name = {
+        .tag = (enum rbs_attr_ivar_name_tag) r_u8(state),
+    };
+
+    switch (ivar_name.tag) {
+    case RBS_ATTR_IVAR_NAME_TAG_NAME:
+        ivar_name.name = r_constant(state);
+        break;
+    case RBS_ATTR_IVAR_NAME_TAG_UNSPECIFIED:
+    case RBS_ATTR_IVAR_NAME_TAG_EMPTY:
+        break;
+    default:
+        state->failed = true;
+    }
+
+    return ivar_name;
+}
+
+static uint8_t r_enum(rbs_deserialize_state *state, uint8_t count) {
+    uint8_t value = r_u8(state);
+    if (value >= count) {
+        state->failed = true;
+    }
+
+    return value;
+}
+
+static rbs_node_t *deserialize_node(rbs_deserialize_state *state);
+
+// Reads a node that must be of the given type, or NULL if `optional`.
+// The translation to Ruby trusts the field types, so anything else fails the whole buffer.
+static rbs_node_t *r_typed_node(rbs_deserialize_state *state, enum rbs_node_type type, bool optional) {
+    rbs_node_t *node = deserialize_node(state);
+
+    if (node == NULL ? !optional : node->type != type) {
+        state->failed = true;
+    }
+
+    return node;
+}
+
+static rbs_node_t *r_any_node(rbs_deserialize_state *state, bool optional) {
+    rbs_node_t *node = deserialize_node(state);
+
+    if (node == NULL && !optional) {
+        state->failed = true;
+    }
+
+    return node;
+}
+
+static rbs_node_list_t *r_node_list(rbs_deserialize_state *state) {
+    uint32_t count = r_u32(state);
+    if (count == 0) return rbs_node_list_empty();
+
+    // Every node takes a byte at least, so a count over the bytes left is a broken input, not a list to make room for.
+    size_t remaining = (size_t) (state->end - state->cursor);
+    rbs_node_list_t *list = rbs_node_list_new_with_capacity(state->allocator, count <= remaining ? count : 0);
+
+    for (uint32_t i = 0; i < count && !state->failed; i++) {
+        rbs_node_t *node = r_any_node(state, false);
+        if (node != NULL) {
+            rbs_node_list_append(list, node);
+        }
+    }
+
+    return list;
+}
+
+static rbs_hash_t *r_hash(rbs_deserialize_state *state) {
+    uint32_t count = r_u32(state);
+    if (count == 0) return rbs_hash_empty();
+
+    rbs_hash_t *hash = rbs_hash_new(state->allocator);
+    for (uint32_t i = 0; i < count && !state->failed; i++) {
+        rbs_node_t *key = r_any_node(state, false);
+        rbs_node_t *value = r_any_node(state, false);
+        if (key != NULL && value != NULL) {
+            rbs_hash_set(hash, key, value);
+        }
+    }
+
+    return hash;
+}
+
+// Must match RBS_SERIALIZE_TAG_SYMBOL in src/serialize.c.
+#define RBS_DESERIALIZE_TAG_SYMBOL 80
+
+static rbs_node_t *deserialize_node(rbs_deserialize_state *state) {
+    uint8_t tag = r_u8(state);
+    if (tag == 0 || state->failed) {
+        return NULL;
+    }
+
+    switch (tag) {
+    case 1: {
+        rbs_ast_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_annotation_t);
+        *node = (rbs_ast_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->string = r_string(state);
+        return (rbs_node_t *) node;
+    }
+    case 2: {
+        bool value = r_bool(state);
+        return (rbs_node_t *) rbs_ast_bool_new(state->allocator, RBS_LOCATION_NULL_RANGE, value);
+    }
+    case 3: {
+        rbs_ast_comment_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_comment_t);
+        *node = (rbs_ast_comment_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_COMMENT,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->string = r_string(state);
+        return (rbs_node_t *) node;
+    }
+    case 4: {
+        rbs_ast_declarations_class_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_class_t);
+        *node = (rbs_ast_declarations_class_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_CLASS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->end_range = r_loc_range(state);
+        node->type_params_range = r_loc_range(state);
+        node->lt_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->type_params = r_node_list(state);
+        node->super_class = (rbs_ast_declarations_class_super_t *) r_typed_node(state, RBS_AST_DECLARATIONS_CLASS_SUPER, true);
+        node->members = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 5: {
+        rbs_ast_declarations_class_super_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_class_super_t);
+        *node = (rbs_ast_declarations_class_super_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_CLASS_SUPER,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 6: {
+        rbs_ast_declarations_class_alias_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_class_alias_t);
+        *node = (rbs_ast_declarations_class_alias_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_CLASS_ALIAS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->new_name_range = r_loc_range(state);
+        node->eq_range = r_loc_range(state);
+        node->old_name_range = r_loc_range(state);
+        node->new_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->old_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->annotations = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 7: {
+        rbs_ast_declarations_constant_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_constant_t);
+        *node = (rbs_ast_declarations_constant_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_CONSTANT,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->type = r_any_node(state, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->annotations = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 8: {
+        rbs_ast_declarations_global_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_global_t);
+        *node = (rbs_ast_declarations_global_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_GLOBAL,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->annotations = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 9: {
+        rbs_ast_declarations_interface_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_interface_t);
+        *node = (rbs_ast_declarations_interface_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_INTERFACE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->end_range = r_loc_range(state);
+        node->type_params_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->type_params = r_node_list(state);
+        node->members = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 10: {
+        rbs_ast_declarations_module_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_module_t);
+        *node = (rbs_ast_declarations_module_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_MODULE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->end_range = r_loc_range(state);
+        node->type_params_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->self_types_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->type_params = r_node_list(state);
+        node->self_types = r_node_list(state);
+        node->members = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 11: {
+        rbs_ast_declarations_module_self_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_module_self_t);
+        *node = (rbs_ast_declarations_module_self_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_MODULE_SELF,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 12: {
+        rbs_ast_declarations_module_alias_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_module_alias_t);
+        *node = (rbs_ast_declarations_module_alias_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_MODULE_ALIAS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->new_name_range = r_loc_range(state);
+        node->eq_range = r_loc_range(state);
+        node->old_name_range = r_loc_range(state);
+        node->new_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->old_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->annotations = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 13: {
+        rbs_ast_declarations_type_alias_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_declarations_type_alias_t);
+        *node = (rbs_ast_declarations_type_alias_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DECLARATIONS_TYPE_ALIAS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->eq_range = r_loc_range(state);
+        node->type_params_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->type_params = r_node_list(state);
+        node->type = r_any_node(state, false);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 14: {
+        rbs_ast_directives_use_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_directives_use_t);
+        *node = (rbs_ast_directives_use_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DIRECTIVES_USE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->clauses = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 15: {
+        rbs_ast_directives_use_single_clause_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_directives_use_single_clause_t);
+        *node = (rbs_ast_directives_use_single_clause_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DIRECTIVES_USE_SINGLE_CLAUSE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->type_name_range = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->new_name_range = r_loc_range(state);
+        node->type_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->new_name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, true);
+        return (rbs_node_t *) node;
+    }
+    case 16: {
+        rbs_ast_directives_use_wildcard_clause_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_directives_use_wildcard_clause_t);
+        *node = (rbs_ast_directives_use_wildcard_clause_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_DIRECTIVES_USE_WILDCARD_CLAUSE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->namespace_range = r_loc_range(state);
+        node->star_range = r_loc_range(state);
+        node->rbs_namespace = (rbs_namespace_t *) r_typed_node(state, RBS_NAMESPACE, false);
+        return (rbs_node_t *) node;
+    }
+    case 17: {
+        rbs_string_t string_representation = r_string(state);
+        return (rbs_node_t *) rbs_ast_integer_new(state->allocator, RBS_LOCATION_NULL_RANGE, string_representation);
+    }
+    case 18: {
+        rbs_ast_members_alias_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_alias_t);
+        *node = (rbs_ast_members_alias_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_ALIAS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->new_name_range = r_loc_range(state);
+        node->old_name_range = r_loc_range(state);
+        node->new_kind_range = r_loc_range(state);
+        node->old_kind_range = r_loc_range(state);
+        node->new_name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->old_name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->kind = (enum rbs_alias_kind) r_enum(state, 2);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 19: {
+        rbs_ast_members_attr_accessor_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_attr_accessor_t);
+        *node = (rbs_ast_members_attr_accessor_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_ATTR_ACCESSOR,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->ivar_range = r_loc_range(state);
+        node->ivar_name_range = r_loc_range(state);
+        node->visibility_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->ivar_name = r_attr_ivar_name(state);
+        node->kind = (enum rbs_attribute_kind) r_enum(state, 2);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->visibility = (enum rbs_attribute_visibility) r_enum(state, 3);
+        return (rbs_node_t *) node;
+    }
+    case 20: {
+        rbs_ast_members_attr_reader_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_attr_reader_t);
+        *node = (rbs_ast_members_attr_reader_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_ATTR_READER,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->ivar_range = r_loc_range(state);
+        node->ivar_name_range = r_loc_range(state);
+        node->visibility_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->ivar_name = r_attr_ivar_name(state);
+        node->kind = (enum rbs_attribute_kind) r_enum(state, 2);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->visibility = (enum rbs_attribute_visibility) r_enum(state, 3);
+        return (rbs_node_t *) node;
+    }
+    case 21: {
+        rbs_ast_members_attr_writer_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_attr_writer_t);
+        *node = (rbs_ast_members_attr_writer_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_ATTR_WRITER,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->ivar_range = r_loc_range(state);
+        node->ivar_name_range = r_loc_range(state);
+        node->visibility_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->ivar_name = r_attr_ivar_name(state);
+        node->kind = (enum rbs_attribute_kind) r_enum(state, 2);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->visibility = (enum rbs_attribute_visibility) r_enum(state, 3);
+        return (rbs_node_t *) node;
+    }
+    case 22: {
+        rbs_ast_members_class_instance_variable_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_class_instance_variable_t);
+        *node = (rbs_ast_members_class_instance_variable_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_CLASS_INSTANCE_VARIABLE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 23: {
+        rbs_ast_members_class_variable_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_class_variable_t);
+        *node = (rbs_ast_members_class_variable_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_CLASS_VARIABLE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 24: {
+        rbs_ast_members_extend_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_extend_t);
+        *node = (rbs_ast_members_extend_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_EXTEND,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 25: {
+        rbs_ast_members_include_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_include_t);
+        *node = (rbs_ast_members_include_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_INCLUDE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 26: {
+        rbs_ast_members_instance_variable_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_instance_variable_t);
+        *node = (rbs_ast_members_instance_variable_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_INSTANCE_VARIABLE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->colon_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->type = r_any_node(state, false);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 27: {
+        rbs_ast_members_method_definition_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_method_definition_t);
+        *node = (rbs_ast_members_method_definition_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_METHOD_DEFINITION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->kind_range = r_loc_range(state);
+        node->overloading_range = r_loc_range(state);
+        node->visibility_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->kind = (enum rbs_method_definition_kind) r_enum(state, 3);
+        node->overloads = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        node->overloading = r_bool(state);
+        node->visibility = (enum rbs_method_definition_visibility) r_enum(state, 3);
+        return (rbs_node_t *) node;
+    }
+    case 28: {
+        rbs_ast_members_method_definition_lazy_overloads_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_method_definition_lazy_overloads_t);
+        *node = (rbs_ast_members_method_definition_lazy_overloads_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->variables = r_node_list(state);
+        node->classish_allowed = r_bool(state);
+        return (rbs_node_t *) node;
+    }
+    case 29: {
+        rbs_ast_members_method_definition_overload_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_method_definition_overload_t);
+        *node = (rbs_ast_members_method_definition_overload_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->annotations = r_node_list(state);
+        node->method_type = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 30: {
+        rbs_ast_members_prepend_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_prepend_t);
+        *node = (rbs_ast_members_prepend_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_PREPEND,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->keyword_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        node->annotations = r_node_list(state);
+        node->comment = (rbs_ast_comment_t *) r_typed_node(state, RBS_AST_COMMENT, true);
+        return (rbs_node_t *) node;
+    }
+    case 31: {
+        rbs_ast_members_private_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_private_t);
+        *node = (rbs_ast_members_private_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_PRIVATE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 32: {
+        rbs_ast_members_public_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_members_public_t);
+        *node = (rbs_ast_members_public_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_MEMBERS_PUBLIC,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 33: {
+        rbs_ast_ruby_annotations_block_param_type_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_block_param_type_annotation_t);
+        *node = (rbs_ast_ruby_annotations_block_param_type_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_BLOCK_PARAM_TYPE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->ampersand_location = r_loc_range(state);
+        node->name_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->question_location = r_loc_range(state);
+        node->type_location = r_loc_range(state);
+        node->type_ = r_any_node(state, false);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 34: {
+        rbs_ast_ruby_annotations_class_alias_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_class_alias_annotation_t);
+        *node = (rbs_ast_ruby_annotations_class_alias_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_CLASS_ALIAS_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->keyword_location = r_loc_range(state);
+        node->type_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, true);
+        node->type_name_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 35: {
+        rbs_ast_ruby_annotations_colon_method_type_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_colon_method_type_annotation_t);
+        *node = (rbs_ast_ruby_annotations_colon_method_type_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_COLON_METHOD_TYPE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->annotations = r_node_list(state);
+        node->method_type = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 36: {
+        rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_double_splat_param_type_annotation_t);
+        *node = (rbs_ast_ruby_annotations_double_splat_param_type_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_DOUBLE_SPLAT_PARAM_TYPE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->star2_location = r_loc_range(state);
+        node->name_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->param_type = r_any_node(state, false);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 37: {
+        rbs_ast_ruby_annotations_instance_variable_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_instance_variable_annotation_t);
+        *node = (rbs_ast_ruby_annotations_instance_variable_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_INSTANCE_VARIABLE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->ivar_name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->ivar_name_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->type = r_any_node(state, false);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 38: {
+        rbs_ast_ruby_annotations_method_types_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_method_types_annotation_t);
+        *node = (rbs_ast_ruby_annotations_method_types_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_METHOD_TYPES_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->overloads = r_node_list(state);
+        node->vertical_bar_locations = r_loc_range_list(state);
+        node->dot3_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 39: {
+        rbs_ast_ruby_annotations_module_alias_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_module_alias_annotation_t);
+        *node = (rbs_ast_ruby_annotations_module_alias_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_MODULE_ALIAS_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->keyword_location = r_loc_range(state);
+        node->type_name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, true);
+        node->type_name_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 40: {
+        rbs_ast_ruby_annotations_module_self_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_module_self_annotation_t);
+        *node = (rbs_ast_ruby_annotations_module_self_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_MODULE_SELF_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->keyword_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        node->open_bracket_location = r_loc_range(state);
+        node->close_bracket_location = r_loc_range(state);
+        node->args_comma_locations = r_loc_range_list(state);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 41: {
+        rbs_ast_ruby_annotations_node_type_assertion_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_node_type_assertion_t);
+        *node = (rbs_ast_ruby_annotations_node_type_assertion_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_NODE_TYPE_ASSERTION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->type = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 42: {
+        rbs_ast_ruby_annotations_param_type_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_param_type_annotation_t);
+        *node = (rbs_ast_ruby_annotations_param_type_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_PARAM_TYPE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->name_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->param_type = r_any_node(state, false);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 43: {
+        rbs_ast_ruby_annotations_return_type_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_return_type_annotation_t);
+        *node = (rbs_ast_ruby_annotations_return_type_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_RETURN_TYPE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->return_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->return_type = r_any_node(state, false);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 44: {
+        rbs_ast_ruby_annotations_skip_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_skip_annotation_t);
+        *node = (rbs_ast_ruby_annotations_skip_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_SKIP_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->skip_location = r_loc_range(state);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 45: {
+        rbs_ast_ruby_annotations_splat_param_type_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_splat_param_type_annotation_t);
+        *node = (rbs_ast_ruby_annotations_splat_param_type_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_SPLAT_PARAM_TYPE_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->star_location = r_loc_range(state);
+        node->name_location = r_loc_range(state);
+        node->colon_location = r_loc_range(state);
+        node->param_type = r_any_node(state, false);
+        node->comment_location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 46: {
+        rbs_ast_ruby_annotations_type_application_annotation_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_ruby_annotations_type_application_annotation_t);
+        *node = (rbs_ast_ruby_annotations_type_application_annotation_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_RUBY_ANNOTATIONS_TYPE_APPLICATION_ANNOTATION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->prefix_location = r_loc_range(state);
+        node->type_args = r_node_list(state);
+        node->close_bracket_location = r_loc_range(state);
+        node->comma_locations = r_loc_range_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 47: {
+        rbs_string_t string = r_string(state);
+        return (rbs_node_t *) rbs_ast_string_new(state->allocator, RBS_LOCATION_NULL_RANGE, string);
+    }
+    case 48: {
+        rbs_ast_type_param_t *node = rbs_allocator_alloc(state->allocator, rbs_ast_type_param_t);
+        *node = (rbs_ast_type_param_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_AST_TYPE_PARAM,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->variance_range = r_loc_range(state);
+        node->unchecked_range = r_loc_range(state);
+        node->upper_bound_range = r_loc_range(state);
+        node->lower_bound_range = r_loc_range(state);
+        node->default_range = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        node->variance = (enum rbs_type_param_variance) r_enum(state, 3);
+        node->upper_bound = r_any_node(state, true);
+        node->lower_bound = r_any_node(state, true);
+        node->default_type = r_any_node(state, true);
+        node->unchecked = r_bool(state);
+        return (rbs_node_t *) node;
+    }
+    case 49: {
+        rbs_method_type_t *node = rbs_allocator_alloc(state->allocator, rbs_method_type_t);
+        *node = (rbs_method_type_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_METHOD_TYPE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->type_range = r_loc_range(state);
+        node->type_params_range = r_loc_range(state);
+        node->type_params = r_node_list(state);
+        node->type = r_any_node(state, false);
+        node->block = (rbs_types_block_t *) r_typed_node(state, RBS_TYPES_BLOCK, true);
+        return (rbs_node_t *) node;
+    }
+    case 50: {
+        rbs_node_list_t *path = r_node_list(state);
+        bool absolute = r_bool(state);
+        return (rbs_node_t *) rbs_namespace_new(state->allocator, RBS_LOCATION_NULL_RANGE, path, absolute);
+    }
+    case 51: {
+        rbs_node_list_t *directives = r_node_list(state);
+        rbs_node_list_t *declarations = r_node_list(state);
+        return (rbs_node_t *) rbs_signature_new(state->allocator, RBS_LOCATION_NULL_RANGE, directives, declarations);
+    }
+    case 52: {
+        rbs_namespace_t *rbs_namespace = (rbs_namespace_t *) r_typed_node(state, RBS_NAMESPACE, false);
+        rbs_ast_symbol_t *name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        return (rbs_node_t *) rbs_type_name_new(state->allocator, RBS_LOCATION_NULL_RANGE, rbs_namespace, name);
+    }
+    case 53: {
+        rbs_types_alias_t *node = rbs_allocator_alloc(state->allocator, rbs_types_alias_t);
+        *node = (rbs_types_alias_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_ALIAS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 54: {
+        rbs_types_bases_any_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_any_t);
+        *node = (rbs_types_bases_any_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_ANY,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->todo = r_bool(state);
+        return (rbs_node_t *) node;
+    }
+    case 55: {
+        rbs_types_bases_bool_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_bool_t);
+        *node = (rbs_types_bases_bool_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_BOOL,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 56: {
+        rbs_types_bases_bottom_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_bottom_t);
+        *node = (rbs_types_bases_bottom_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_BOTTOM,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 57: {
+        rbs_types_bases_class_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_class_t);
+        *node = (rbs_types_bases_class_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_CLASS,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 58: {
+        rbs_types_bases_instance_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_instance_t);
+        *node = (rbs_types_bases_instance_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_INSTANCE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 59: {
+        rbs_types_bases_nil_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_nil_t);
+        *node = (rbs_types_bases_nil_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_NIL,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 60: {
+        rbs_types_bases_self_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_self_t);
+        *node = (rbs_types_bases_self_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_SELF,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 61: {
+        rbs_types_bases_top_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_top_t);
+        *node = (rbs_types_bases_top_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_TOP,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 62: {
+        rbs_types_bases_void_t *node = rbs_allocator_alloc(state->allocator, rbs_types_bases_void_t);
+        *node = (rbs_types_bases_void_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BASES_VOID,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 63: {
+        rbs_types_block_t *node = rbs_allocator_alloc(state->allocator, rbs_types_block_t);
+        *node = (rbs_types_block_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_BLOCK,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->type = r_any_node(state, false);
+        node->required = r_bool(state);
+        node->self_type = r_any_node(state, true);
+        return (rbs_node_t *) node;
+    }
+    case 64: {
+        rbs_types_class_instance_t *node = rbs_allocator_alloc(state->allocator, rbs_types_class_instance_t);
+        *node = (rbs_types_class_instance_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_CLASS_INSTANCE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 65: {
+        rbs_types_class_singleton_t *node = rbs_allocator_alloc(state->allocator, rbs_types_class_singleton_t);
+        *node = (rbs_types_class_singleton_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_CLASS_SINGLETON,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 66: {
+        rbs_types_function_t *node = rbs_allocator_alloc(state->allocator, rbs_types_function_t);
+        *node = (rbs_types_function_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_FUNCTION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->required_positionals = r_node_list(state);
+        node->optional_positionals = r_node_list(state);
+        node->rest_positionals = r_any_node(state, true);
+        node->trailing_positionals = r_node_list(state);
+        node->required_keywords = r_hash(state);
+        node->optional_keywords = r_hash(state);
+        node->rest_keywords = r_any_node(state, true);
+        node->forwarding = r_any_node(state, true);
+        node->return_type = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 67: {
+        rbs_types_function_forwarding_param_t *node = rbs_allocator_alloc(state->allocator, rbs_types_function_forwarding_param_t);
+        *node = (rbs_types_function_forwarding_param_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_FUNCTION_FORWARDING_PARAM,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        return (rbs_node_t *) node;
+    }
+    case 68: {
+        rbs_types_function_param_t *node = rbs_allocator_alloc(state->allocator, rbs_types_function_param_t);
+        *node = (rbs_types_function_param_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_FUNCTION_PARAM,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->type = r_any_node(state, false);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, true);
+        return (rbs_node_t *) node;
+    }
+    case 69: {
+        rbs_types_interface_t *node = rbs_allocator_alloc(state->allocator, rbs_types_interface_t);
+        *node = (rbs_types_interface_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_INTERFACE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name_range = r_loc_range(state);
+        node->args_range = r_loc_range(state);
+        node->name = (rbs_type_name_t *) r_typed_node(state, RBS_TYPE_NAME, false);
+        node->args = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 70: {
+        rbs_types_intersection_t *node = rbs_allocator_alloc(state->allocator, rbs_types_intersection_t);
+        *node = (rbs_types_intersection_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_INTERSECTION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->types = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 71: {
+        rbs_types_literal_t *node = rbs_allocator_alloc(state->allocator, rbs_types_literal_t);
+        *node = (rbs_types_literal_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_LITERAL,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->literal = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 72: {
+        rbs_types_optional_t *node = rbs_allocator_alloc(state->allocator, rbs_types_optional_t);
+        *node = (rbs_types_optional_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_OPTIONAL,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->type = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 73: {
+        rbs_types_proc_t *node = rbs_allocator_alloc(state->allocator, rbs_types_proc_t);
+        *node = (rbs_types_proc_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_PROC,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->type = r_any_node(state, false);
+        node->block = (rbs_types_block_t *) r_typed_node(state, RBS_TYPES_BLOCK, true);
+        node->self_type = r_any_node(state, true);
+        return (rbs_node_t *) node;
+    }
+    case 74: {
+        rbs_types_record_t *node = rbs_allocator_alloc(state->allocator, rbs_types_record_t);
+        *node = (rbs_types_record_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_RECORD,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->all_fields = r_hash(state);
+        return (rbs_node_t *) node;
+    }
+    case 75: {
+        rbs_node_t *type = r_any_node(state, false);
+        bool required = r_bool(state);
+        return (rbs_node_t *) rbs_types_record_field_type_new(state->allocator, RBS_LOCATION_NULL_RANGE, type, required);
+    }
+    case 76: {
+        rbs_types_tuple_t *node = rbs_allocator_alloc(state->allocator, rbs_types_tuple_t);
+        *node = (rbs_types_tuple_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_TUPLE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->types = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 77: {
+        rbs_types_union_t *node = rbs_allocator_alloc(state->allocator, rbs_types_union_t);
+        *node = (rbs_types_union_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_UNION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->types = r_node_list(state);
+        return (rbs_node_t *) node;
+    }
+    case 78: {
+        rbs_types_untyped_function_t *node = rbs_allocator_alloc(state->allocator, rbs_types_untyped_function_t);
+        *node = (rbs_types_untyped_function_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_UNTYPED_FUNCTION,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->return_type = r_any_node(state, false);
+        return (rbs_node_t *) node;
+    }
+    case 79: {
+        rbs_types_variable_t *node = rbs_allocator_alloc(state->allocator, rbs_types_variable_t);
+        *node = (rbs_types_variable_t) {
+            .base = (rbs_node_t) {
+                .type = RBS_TYPES_VARIABLE,
+                .location = RBS_LOCATION_NULL_RANGE,
+            },
+        };
+        node->base.location = r_loc_range(state);
+        node->name = (rbs_ast_symbol_t *) r_typed_node(state, RBS_AST_SYMBOL, false);
+        return (rbs_node_t *) node;
+    }
+    case RBS_DESERIALIZE_TAG_SYMBOL: {
+        rbs_constant_id_t constant_id = r_constant(state);
+        return (rbs_node_t *) rbs_ast_symbol_new(state->allocator, RBS_LOCATION_NULL_RANGE, state->constant_pool, constant_id);
+    }
+    }
+
+    state->failed = true;
+    return NULL;
+}
+
+rbs_node_t *rbs_deserialize_node(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, const uint8_t *bytes, size_t length) {
+    rbs_deserialize_state state = {
+        .allocator = allocator,
+        .constant_pool = constant_pool,
+        .constants = NULL,
+        .constants_count = 0,
+        .cursor = bytes,
+        .end = bytes + length,
+        .failed = false,
+    };
+
+    r_constant_table(&state);
+    rbs_node_t *node = deserialize_node(&state);
+
+    if (state.failed || state.cursor != state.end) {
+        return NULL;
+    }
+
+    return node;
+}
+
+rbs_node_list_t *rbs_deserialize_node_list(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, const uint8_t *bytes, size_t length) {
+    rbs_deserialize_state state = {
+        .allocator = allocator,
+        .constant_pool = constant_pool,
+        .constants = NULL,
+        .constants_count = 0,
+        .cursor = bytes,
+        .end = bytes + length,
+        .failed = false,
+    };
+
+    r_constant_table(&state);
+    rbs_node_list_t *list = r_node_list(&state);
+
+    if (state.failed || state.cursor != state.end) {
+        return NULL;
+    }
+
+    return list;
+}
@@ -2,10 +2,10 @@
 #line 1 "src/lexer.re"
 #include "rbs/lexer.h"
 
-rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
-    rbs_lexer_t backup;
-
-    backup = *lexer;
+rbs_token_t rbs_lexer_next_token_generic(rbs_lexer_t *lexer) {
+    rbs_token_t token;
+    if (rbs_lexer_scan_token(lexer, &token)) return token;
+    rbs_lexer_cursor_t backup = rbs_lexer_save(lexer);
 
 #line 12 "src/lexer.c"
     {
@@ -129,7 +129,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         }
     yy1:
         rbs_skip(lexer);
-#line 184 "src/lexer.re"
+#line 183 "src/lexer.re"
         {
             return rbs_next_eof_token(lexer);
         }
@@ -137,7 +137,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy2:
         rbs_skip(lexer);
     yy3:
-#line 185 "src/lexer.re"
+#line 184 "src/lexer.re"
     {
         return rbs_next_token(lexer, ErrorToken);
     }
@@ -148,7 +148,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         if (yych == '\t') goto yy4;
         if (yych == ' ') goto yy4;
     yy5:
-#line 183 "src/lexer.re"
+#line 182 "src/lexer.re"
     {
         return rbs_next_token(lexer, tTRIVIA);
     }
@@ -170,7 +170,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy9:
         yyaccept = 0;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= 0x00000000) goto yy3;
         goto yy71;
@@ -190,7 +190,6 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         if (rbs_peek(lexer) == '\n' && lexer->string.start[lexer->current.byte_pos - 1] == '\r') {
             lexer->current.byte_pos -= 1;
             lexer->current.char_pos -= 1;
-            lexer->current.column -= 1;
             lexer->current_code_point = '\r';
             lexer->current_character_bytes = 1;
         }
@@ -200,7 +199,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             lexer->first_token_of_line ? tLINECOMMENT : tCOMMENT
         );
     }
-#line 197 "src/lexer.c"
+#line 196 "src/lexer.c"
     yy12:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -250,7 +249,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy13:
         yyaccept = 1;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych == 'a') goto yy78;
         goto yy8;
@@ -260,11 +259,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pAMP);
         }
-#line 255 "src/lexer.c"
+#line 254 "src/lexer.c"
     yy15:
         yyaccept = 0;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= 0x00000000) goto yy3;
         goto yy80;
@@ -274,14 +273,14 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pLPAREN);
         }
-#line 267 "src/lexer.c"
+#line 266 "src/lexer.c"
     yy17:
         rbs_skip(lexer);
 #line 37 "src/lexer.re"
         {
             return rbs_next_token(lexer, pRPAREN);
         }
-#line 272 "src/lexer.c"
+#line 271 "src/lexer.c"
     yy18:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -290,7 +289,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pSTAR);
         }
-#line 279 "src/lexer.c"
+#line 278 "src/lexer.c"
     yy19:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -304,7 +303,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pCOMMA);
         }
-#line 291 "src/lexer.c"
+#line 290 "src/lexer.c"
     yy21:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -332,7 +331,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy22:
         yyaccept = 2;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych == '.') goto yy87;
     yy23:
@@ -340,7 +339,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, pDOT);
     }
-#line 320 "src/lexer.c"
+#line 319 "src/lexer.c"
     yy24:
         rbs_skip(lexer);
         goto yy8;
@@ -355,11 +354,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, tINTEGER);
     }
-#line 333 "src/lexer.c"
+#line 332 "src/lexer.c"
     yy27:
         yyaccept = 3;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= '<') {
             if (yych <= '*') {
@@ -427,7 +426,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, pCOLON);
     }
-#line 403 "src/lexer.c"
+#line 402 "src/lexer.c"
     yy29:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -439,7 +438,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, pLT);
     }
-#line 413 "src/lexer.c"
+#line 412 "src/lexer.c"
     yy31:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -455,7 +454,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, pEQ);
     }
-#line 427 "src/lexer.c"
+#line 426 "src/lexer.c"
     yy33:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -466,18 +465,18 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, pGT);
     }
-#line 436 "src/lexer.c"
+#line 435 "src/lexer.c"
     yy35:
         rbs_skip(lexer);
 #line 46 "src/lexer.re"
         {
             return rbs_next_token(lexer, pQUESTION);
         }
-#line 441 "src/lexer.c"
+#line 440 "src/lexer.c"
     yy36:
         yyaccept = 0;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= '`') {
             if (yych <= 'Z') {
@@ -519,11 +518,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy38:
-#line 155 "src/lexer.re"
+#line 154 "src/lexer.re"
     {
         return rbs_next_token(lexer, tUIDENT);
     }
-#line 489 "src/lexer.c"
+#line 488 "src/lexer.c"
     yy39:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -532,21 +531,21 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pLBRACKET);
         }
-#line 496 "src/lexer.c"
+#line 495 "src/lexer.c"
     yy40:
         rbs_skip(lexer);
 #line 39 "src/lexer.re"
         {
             return rbs_next_token(lexer, pRBRACKET);
         }
-#line 501 "src/lexer.c"
+#line 500 "src/lexer.c"
     yy41:
         rbs_skip(lexer);
 #line 44 "src/lexer.re"
         {
             return rbs_next_token(lexer, pHAT);
         }
-#line 506 "src/lexer.c"
+#line 505 "src/lexer.c"
     yy42:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -568,15 +567,15 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy43:
-#line 158 "src/lexer.re"
+#line 157 "src/lexer.re"
     {
         return rbs_next_token(lexer, tULLIDENT);
     }
-#line 530 "src/lexer.c"
+#line 529 "src/lexer.c"
     yy44:
         yyaccept = 4;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= ' ') {
             if (yych <= 0x00000000) goto yy45;
@@ -589,7 +588,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     {
         return rbs_next_token(lexer, tOPERATOR);
     }
-#line 545 "src/lexer.c"
+#line 544 "src/lexer.c"
     yy46:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -602,11 +601,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             goto yy54;
         }
     yy47:
-#line 154 "src/lexer.re"
+#line 153 "src/lexer.re"
     {
         return rbs_next_token(lexer, tLIDENT);
     }
-#line 560 "src/lexer.c"
+#line 559 "src/lexer.c"
     yy48:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -728,21 +727,21 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pLBRACE);
         }
-#line 680 "src/lexer.c"
+#line 679 "src/lexer.c"
     yy66:
         rbs_skip(lexer);
 #line 43 "src/lexer.re"
         {
             return rbs_next_token(lexer, pBAR);
         }
-#line 685 "src/lexer.c"
+#line 684 "src/lexer.c"
     yy67:
         rbs_skip(lexer);
 #line 41 "src/lexer.re"
         {
             return rbs_next_token(lexer, pRBRACE);
         }
-#line 690 "src/lexer.c"
+#line 689 "src/lexer.c"
     yy68:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -764,11 +763,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy69:
-#line 169 "src/lexer.re"
+#line 168 "src/lexer.re"
     {
         return rbs_next_token(lexer, tNONASCIIIDENT);
     }
-#line 714 "src/lexer.c"
+#line 713 "src/lexer.c"
     yy70:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -782,7 +781,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             goto yy70;
         }
     yy72:
-        *lexer = backup;
+        rbs_lexer_restore(lexer, backup);
         if (yyaccept <= 4) {
             if (yyaccept <= 2) {
                 if (yyaccept <= 1) {
@@ -810,11 +809,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         }
     yy73:
         rbs_skip(lexer);
-#line 135 "src/lexer.re"
+#line 134 "src/lexer.re"
         {
             return rbs_next_token(lexer, tDQSTRING);
         }
-#line 754 "src/lexer.c"
+#line 753 "src/lexer.c"
     yy74:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -851,11 +850,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy76:
-#line 179 "src/lexer.re"
+#line 178 "src/lexer.re"
     {
         return rbs_next_token(lexer, tGIDENT);
     }
-#line 793 "src/lexer.c"
+#line 792 "src/lexer.c"
     yy77:
         rbs_skip(lexer);
         goto yy76;
@@ -894,11 +893,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy81:
         rbs_skip(lexer);
     yy82:
-#line 136 "src/lexer.re"
+#line 135 "src/lexer.re"
     {
         return rbs_next_token(lexer, tSQSTRING);
     }
-#line 834 "src/lexer.c"
+#line 833 "src/lexer.c"
     yy83:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -916,7 +915,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pSTAR2);
         }
-#line 850 "src/lexer.c"
+#line 849 "src/lexer.c"
     yy85:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -925,14 +924,14 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, tINLINECOMMENT);
         }
-#line 857 "src/lexer.c"
+#line 856 "src/lexer.c"
     yy86:
         rbs_skip(lexer);
 #line 53 "src/lexer.re"
         {
             return rbs_next_token(lexer, pARROW);
         }
-#line 862 "src/lexer.c"
+#line 861 "src/lexer.c"
     yy87:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -944,11 +943,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         if (yych == '=') goto yy92;
         if (yych == '~') goto yy92;
     yy89:
-#line 152 "src/lexer.re"
+#line 151 "src/lexer.re"
     {
         return rbs_next_token(lexer, tSYMBOL);
     }
-#line 876 "src/lexer.c"
+#line 875 "src/lexer.c"
     yy90:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1036,7 +1035,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pCOLON2);
         }
-#line 962 "src/lexer.c"
+#line 961 "src/lexer.c"
     yy97:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1102,11 +1101,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy102:
-#line 150 "src/lexer.re"
+#line 149 "src/lexer.re"
     {
         return rbs_next_token(lexer, tSYMBOL);
     }
-#line 1030 "src/lexer.c"
+#line 1029 "src/lexer.c"
     yy103:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1128,7 +1127,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pFATARROW);
         }
-#line 1050 "src/lexer.c"
+#line 1049 "src/lexer.c"
     yy107:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1170,11 +1169,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy110:
-#line 176 "src/lexer.re"
+#line 175 "src/lexer.re"
     {
         return rbs_next_token(lexer, tAIDENT);
     }
-#line 1094 "src/lexer.c"
+#line 1093 "src/lexer.c"
     yy111:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1182,18 +1181,18 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         goto yy109;
     yy112:
         rbs_skip(lexer);
-#line 173 "src/lexer.re"
+#line 172 "src/lexer.re"
         {
             return rbs_next_token(lexer, tBANGIDENT);
         }
-#line 1104 "src/lexer.c"
+#line 1103 "src/lexer.c"
     yy113:
         rbs_skip(lexer);
-#line 174 "src/lexer.re"
+#line 173 "src/lexer.re"
         {
             return rbs_next_token(lexer, tEQIDENT);
         }
-#line 1109 "src/lexer.c"
+#line 1108 "src/lexer.c"
     yy114:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1202,7 +1201,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pAREF_OPR);
         }
-#line 1116 "src/lexer.c"
+#line 1115 "src/lexer.c"
     yy115:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1225,11 +1224,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy117:
-#line 156 "src/lexer.re"
+#line 155 "src/lexer.re"
     {
         return rbs_next_token(lexer, tULLIDENT);
     }
-#line 1141 "src/lexer.c"
+#line 1140 "src/lexer.c"
     yy118:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1251,11 +1250,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy119:
-#line 157 "src/lexer.re"
+#line 156 "src/lexer.re"
     {
         return rbs_next_token(lexer, tULIDENT);
     }
-#line 1165 "src/lexer.c"
+#line 1164 "src/lexer.c"
     yy120:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1293,11 +1292,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy124:
-#line 122 "src/lexer.re"
+#line 121 "src/lexer.re"
     {
         return rbs_next_token(lexer, kAS);
     }
-#line 1205 "src/lexer.c"
+#line 1204 "src/lexer.c"
     yy125:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1372,11 +1371,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy133:
-#line 101 "src/lexer.re"
+#line 100 "src/lexer.re"
     {
         return rbs_next_token(lexer, kIN);
     }
-#line 1282 "src/lexer.c"
+#line 1281 "src/lexer.c"
     yy134:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1508,7 +1507,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy156:
         yyaccept = 5;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= '\'') {
             if (yych <= 0x00000000) goto yy82;
@@ -1524,14 +1523,14 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, pDOT3);
         }
-#line 1428 "src/lexer.c"
+#line 1427 "src/lexer.c"
     yy158:
         rbs_skip(lexer);
-#line 137 "src/lexer.re"
+#line 136 "src/lexer.re"
         {
             return rbs_next_token(lexer, tDQSYMBOL);
         }
-#line 1433 "src/lexer.c"
+#line 1432 "src/lexer.c"
     yy159:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1568,22 +1567,22 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy161:
-#line 151 "src/lexer.re"
+#line 150 "src/lexer.re"
     {
         return rbs_next_token(lexer, tSYMBOL);
     }
-#line 1472 "src/lexer.c"
+#line 1471 "src/lexer.c"
     yy162:
         rbs_skip(lexer);
         goto yy161;
     yy163:
         rbs_skip(lexer);
     yy164:
-#line 138 "src/lexer.re"
+#line 137 "src/lexer.re"
     {
         return rbs_next_token(lexer, tSQSYMBOL);
     }
-#line 1481 "src/lexer.c"
+#line 1480 "src/lexer.c"
     yy165:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1648,11 +1647,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy171:
-#line 177 "src/lexer.re"
+#line 176 "src/lexer.re"
     {
         return rbs_next_token(lexer, tA2IDENT);
     }
-#line 1548 "src/lexer.c"
+#line 1547 "src/lexer.c"
     yy172:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1669,7 +1668,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, tQIDENT);
         }
-#line 1563 "src/lexer.c"
+#line 1562 "src/lexer.c"
     yy175:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1706,11 +1705,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy179:
-#line 94 "src/lexer.re"
+#line 93 "src/lexer.re"
     {
         return rbs_next_token(lexer, kBOT);
     }
-#line 1602 "src/lexer.c"
+#line 1601 "src/lexer.c"
     yy180:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1737,11 +1736,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy182:
-#line 97 "src/lexer.re"
+#line 96 "src/lexer.re"
     {
         return rbs_next_token(lexer, kDEF);
     }
-#line 1631 "src/lexer.c"
+#line 1630 "src/lexer.c"
     yy183:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1763,11 +1762,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy184:
-#line 98 "src/lexer.re"
+#line 97 "src/lexer.re"
     {
         return rbs_next_token(lexer, kEND);
     }
-#line 1655 "src/lexer.c"
+#line 1654 "src/lexer.c"
     yy185:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1819,11 +1818,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy192:
-#line 108 "src/lexer.re"
+#line 107 "src/lexer.re"
     {
         return rbs_next_token(lexer, kNIL);
     }
-#line 1709 "src/lexer.c"
+#line 1708 "src/lexer.c"
     yy193:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1845,11 +1844,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy194:
-#line 109 "src/lexer.re"
+#line 108 "src/lexer.re"
     {
         return rbs_next_token(lexer, kOUT);
     }
-#line 1733 "src/lexer.c"
+#line 1732 "src/lexer.c"
     yy195:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1906,11 +1905,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy203:
-#line 115 "src/lexer.re"
+#line 114 "src/lexer.re"
     {
         return rbs_next_token(lexer, kTOP);
     }
-#line 1792 "src/lexer.c"
+#line 1791 "src/lexer.c"
     yy204:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1952,11 +1951,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy209:
-#line 121 "src/lexer.re"
+#line 120 "src/lexer.re"
     {
         return rbs_next_token(lexer, kUSE);
     }
-#line 1836 "src/lexer.c"
+#line 1835 "src/lexer.c"
     yy210:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -1981,35 +1980,35 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         {
             return rbs_next_token(lexer, tANNOTATION);
         }
-#line 1859 "src/lexer.c"
+#line 1858 "src/lexer.c"
     yy213:
         rbs_skip(lexer);
 #line 71 "src/lexer.re"
         {
             return rbs_next_token(lexer, tANNOTATION);
         }
-#line 1864 "src/lexer.c"
+#line 1863 "src/lexer.c"
     yy214:
         rbs_skip(lexer);
 #line 69 "src/lexer.re"
         {
             return rbs_next_token(lexer, tANNOTATION);
         }
-#line 1869 "src/lexer.c"
+#line 1868 "src/lexer.c"
     yy215:
         rbs_skip(lexer);
 #line 67 "src/lexer.re"
         {
             return rbs_next_token(lexer, tANNOTATION);
         }
-#line 1874 "src/lexer.c"
+#line 1873 "src/lexer.c"
     yy216:
         rbs_skip(lexer);
 #line 70 "src/lexer.re"
         {
             return rbs_next_token(lexer, tANNOTATION);
         }
-#line 1879 "src/lexer.c"
+#line 1878 "src/lexer.c"
     yy217:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2034,7 +2033,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy219:
         yyaccept = 6;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= '\'') {
             if (yych <= 0x00000000) goto yy164;
@@ -2064,11 +2063,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy221:
-#line 124 "src/lexer.re"
+#line 123 "src/lexer.re"
     {
         return rbs_next_token(lexer, kATRBS);
     }
-#line 1936 "src/lexer.c"
+#line 1935 "src/lexer.c"
     yy222:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2105,11 +2104,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy226:
-#line 93 "src/lexer.re"
+#line 92 "src/lexer.re"
     {
         return rbs_next_token(lexer, kBOOL);
     }
-#line 1975 "src/lexer.c"
+#line 1974 "src/lexer.c"
     yy227:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2186,11 +2185,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy239:
-#line 113 "src/lexer.re"
+#line 112 "src/lexer.re"
     {
         return rbs_next_token(lexer, kSELF);
     }
-#line 2054 "src/lexer.c"
+#line 2053 "src/lexer.c"
     yy240:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2217,11 +2216,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy242:
-#line 125 "src/lexer.re"
+#line 124 "src/lexer.re"
     {
         return rbs_next_token(lexer, kSKIP);
     }
-#line 2083 "src/lexer.c"
+#line 2082 "src/lexer.c"
     yy243:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2243,11 +2242,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy244:
-#line 116 "src/lexer.re"
+#line 115 "src/lexer.re"
     {
         return rbs_next_token(lexer, kTRUE);
     }
-#line 2107 "src/lexer.c"
+#line 2106 "src/lexer.c"
     yy245:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2269,11 +2268,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy246:
-#line 117 "src/lexer.re"
+#line 116 "src/lexer.re"
     {
         return rbs_next_token(lexer, kTYPE);
     }
-#line 2131 "src/lexer.c"
+#line 2130 "src/lexer.c"
     yy247:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2305,11 +2304,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy250:
-#line 120 "src/lexer.re"
+#line 119 "src/lexer.re"
     {
         return rbs_next_token(lexer, kVOID);
     }
-#line 2165 "src/lexer.c"
+#line 2164 "src/lexer.c"
     yy251:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2362,11 +2361,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy255:
-#line 89 "src/lexer.re"
+#line 88 "src/lexer.re"
     {
         return rbs_next_token(lexer, kALIAS);
     }
-#line 2220 "src/lexer.c"
+#line 2219 "src/lexer.c"
     yy256:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2381,7 +2380,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy257:
         yyaccept = 7;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= '@') {
             if (yych <= '-') {
@@ -2407,11 +2406,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy258:
-#line 95 "src/lexer.re"
+#line 94 "src/lexer.re"
     {
         return rbs_next_token(lexer, kCLASS);
     }
-#line 2263 "src/lexer.c"
+#line 2262 "src/lexer.c"
     yy259:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2438,11 +2437,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy261:
-#line 100 "src/lexer.re"
+#line 99 "src/lexer.re"
     {
         return rbs_next_token(lexer, kFALSE);
     }
-#line 2292 "src/lexer.c"
+#line 2291 "src/lexer.c"
     yy262:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2570,11 +2569,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy281:
-#line 99 "src/lexer.re"
+#line 98 "src/lexer.re"
     {
         return rbs_next_token(lexer, kEXTEND);
     }
-#line 2422 "src/lexer.c"
+#line 2421 "src/lexer.c"
     yy282:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2593,7 +2592,7 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
     yy285:
         yyaccept = 8;
         rbs_skip(lexer);
-        backup = *lexer;
+        backup = rbs_lexer_save(lexer);
         yych = rbs_peek(lexer);
         if (yych <= '@') {
             if (yych <= '-') {
@@ -2619,11 +2618,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy286:
-#line 105 "src/lexer.re"
+#line 104 "src/lexer.re"
     {
         return rbs_next_token(lexer, kMODULE);
     }
-#line 2469 "src/lexer.c"
+#line 2468 "src/lexer.c"
     yy287:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2655,11 +2654,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy290:
-#line 112 "src/lexer.re"
+#line 111 "src/lexer.re"
     {
         return rbs_next_token(lexer, kPUBLIC);
     }
-#line 2503 "src/lexer.c"
+#line 2502 "src/lexer.c"
     yy291:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2681,11 +2680,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy292:
-#line 126 "src/lexer.re"
+#line 125 "src/lexer.re"
     {
         return rbs_next_token(lexer, kRETURN);
     }
-#line 2527 "src/lexer.c"
+#line 2526 "src/lexer.c"
     yy293:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2760,11 +2759,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy303:
-#line 102 "src/lexer.re"
+#line 101 "src/lexer.re"
     {
         return rbs_next_token(lexer, kINCLUDE);
     }
-#line 2604 "src/lexer.c"
+#line 2603 "src/lexer.c"
     yy304:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2802,11 +2801,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy308:
-#line 110 "src/lexer.re"
+#line 109 "src/lexer.re"
     {
         return rbs_next_token(lexer, kPREPEND);
     }
-#line 2644 "src/lexer.c"
+#line 2643 "src/lexer.c"
     yy309:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2828,11 +2827,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy310:
-#line 111 "src/lexer.re"
+#line 110 "src/lexer.re"
     {
         return rbs_next_token(lexer, kPRIVATE);
     }
-#line 2668 "src/lexer.c"
+#line 2667 "src/lexer.c"
     yy311:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2864,11 +2863,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy314:
-#line 119 "src/lexer.re"
+#line 118 "src/lexer.re"
     {
         return rbs_next_token(lexer, kUNTYPED);
     }
-#line 2702 "src/lexer.c"
+#line 2701 "src/lexer.c"
     yy315:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2890,11 +2889,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy316:
-#line 123 "src/lexer.re"
+#line 122 "src/lexer.re"
     {
         return rbs_next_token(lexer, k__TODO__);
     }
-#line 2726 "src/lexer.c"
+#line 2725 "src/lexer.c"
     yy317:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -2936,11 +2935,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy322:
-#line 103 "src/lexer.re"
+#line 102 "src/lexer.re"
     {
         return rbs_next_token(lexer, kINSTANCE);
     }
-#line 2770 "src/lexer.c"
+#line 2769 "src/lexer.c"
     yy323:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3007,11 +3006,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy333:
-#line 104 "src/lexer.re"
+#line 103 "src/lexer.re"
     {
         return rbs_next_token(lexer, kINTERFACE);
     }
-#line 2839 "src/lexer.c"
+#line 2838 "src/lexer.c"
     yy334:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3043,11 +3042,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy337:
-#line 114 "src/lexer.re"
+#line 113 "src/lexer.re"
     {
         return rbs_next_token(lexer, kSINGLETON);
     }
-#line 2873 "src/lexer.c"
+#line 2872 "src/lexer.c"
     yy338:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3069,11 +3068,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy339:
-#line 118 "src/lexer.re"
+#line 117 "src/lexer.re"
     {
         return rbs_next_token(lexer, kUNCHECKED);
     }
-#line 2897 "src/lexer.c"
+#line 2896 "src/lexer.c"
     yy340:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3130,11 +3129,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy348:
-#line 91 "src/lexer.re"
+#line 90 "src/lexer.re"
     {
         return rbs_next_token(lexer, kATTRREADER);
     }
-#line 2956 "src/lexer.c"
+#line 2955 "src/lexer.c"
     yy349:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3156,18 +3155,18 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy350:
-#line 92 "src/lexer.re"
+#line 91 "src/lexer.re"
     {
         return rbs_next_token(lexer, kATTRWRITER);
     }
-#line 2980 "src/lexer.c"
+#line 2979 "src/lexer.c"
     yy351:
         rbs_skip(lexer);
-#line 96 "src/lexer.re"
+#line 95 "src/lexer.re"
         {
             return rbs_next_token(lexer, kCLASSALIAS);
         }
-#line 2985 "src/lexer.c"
+#line 2984 "src/lexer.c"
     yy352:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3175,11 +3174,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         goto yy72;
     yy353:
         rbs_skip(lexer);
-#line 107 "src/lexer.re"
+#line 106 "src/lexer.re"
         {
             return rbs_next_token(lexer, kMODULESELF);
         }
-#line 2995 "src/lexer.c"
+#line 2994 "src/lexer.c"
     yy354:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3187,11 +3186,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
         goto yy54;
     yy355:
         rbs_skip(lexer);
-#line 106 "src/lexer.re"
+#line 105 "src/lexer.re"
         {
             return rbs_next_token(lexer, kMODULEALIAS);
         }
-#line 3005 "src/lexer.c"
+#line 3004 "src/lexer.c"
     yy356:
         rbs_skip(lexer);
         yych = rbs_peek(lexer);
@@ -3213,11 +3212,11 @@ rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
             }
         }
     yy357:
-#line 90 "src/lexer.re"
+#line 89 "src/lexer.re"
     {
         return rbs_next_token(lexer, kATTRACCESSOR);
     }
-#line 3029 "src/lexer.c"
+#line 3028 "src/lexer.c"
     }
-#line 186 "src/lexer.re"
+#line 185 "src/lexer.re"
 }
@@ -0,0 +1,40 @@
+/**
+ * @file lexer_ascii.c
+ *
+ * The lexer of `lexer.c`, compiled again for the input that is all ASCII.
+ *
+ * The DFA that re2c generates reads every character through `rbs_peek` and `rbs_skip`, which `lexstate.c` implements
+ * for any encoding: each step is a call that looks the width of the next character up through the encoding. This file
+ * replaces them with inline functions that read a byte as a character, and the bulk scans with
+ * `rbs_lexer_scan_token_ascii`. `rbs_lexer_next_token` runs the result for the lexers that `rbs_lexer_new` has found
+ * to read an input that is all ASCII.
+ */
+
+#include "rbs/defines.h"
+#include "rbs/lexer.h"
+
+static inline unsigned int rbs_peek_ascii(rbs_lexer_t *lexer) {
+    return lexer->current_code_point;
+}
+
+static inline void rbs_skip_ascii(rbs_lexer_t *lexer) {
+    if (RBS_UNLIKELY(lexer->current_code_point == '\0')) {
+        return;
+    }
+
+    if (lexer->current_code_point == '\n') {
+        lexer->first_token_of_line = true;
+    }
+
+    int byte_pos = lexer->current.byte_pos + 1;
+    lexer->current.byte_pos = byte_pos;
+    lexer->current.char_pos = byte_pos;
+    lexer->current_code_point = byte_pos < lexer->end_pos ? (unsigned char) lexer->string.start[byte_pos] : '\0';
+}
+
+#define rbs_peek(lexer) rbs_peek_ascii(lexer)
+#define rbs_skip(lexer) rbs_skip_ascii(lexer)
+#define rbs_lexer_scan_token(lexer, token) rbs_lexer_scan_token_ascii(lexer, token)
+#define rbs_lexer_next_token_generic rbs_lexer_next_token_ascii
+
+#include "lexer.c"
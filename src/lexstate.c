@@ -1,6 +1,10 @@
 #include "rbs/defines.h"
 #include "rbs/lexer.h"
 #include "rbs/util/rbs_assert.h"
+#include "rbs/util/rbs_constant_pool.h"
+#include "rbs/util/rbs_scan.h"
+
+#include <string.h>
 
 static const char *RBS_TOKENTYPE_NAMES[] = {
     "NullType",
@@ -99,8 +103,8 @@ static const char *RBS_TOKENTYPE_NAMES[] = {
     "tANNOTATION", /* Annotation */
 };
 
-const rbs_position_t NullPosition = { -1, -1, -1, -1 };
-const rbs_range_t NULL_RANGE = { { -1, -1, -1, -1 }, { -1, -1, -1, -1 } };
+const rbs_position_t NullPosition = { -1, -1 };
+const rbs_range_t NULL_RANGE = { { -1, -1 }, { -1, -1 } };
 const rbs_token_t NullToken = { .type = NullType, .range = { { 0 }, { 0 } } };
 
 const char *rbs_token_type_str(enum RBSTokenType type) {
@@ -152,6 +156,51 @@ bool rbs_next_char(rbs_lexer_t *lexer, unsigned int *codepoint, size_t *byte_len
     return true;
 }
 
+static void rbs_lexer_index_lines(rbs_lexer_t *lexer) {
+    // A `\n` byte is a new line in any ASCII compatible encoding, since no multibyte character contains one.
+    const char *start = lexer->string.start;
+    const char *end = start + lexer->end_pos;
+    if (end > lexer->string.end) end = lexer->string.end;
+
+    int count = 1;
+    for (const char *p = start; (p = (const char *) memchr(p, '\n', (size_t) (end - p))) != NULL; p++) {
+        count++;
+    }
+
+    int *starts = rbs_allocator_alloc_many(lexer->allocator, (size_t) count, int);
+    starts[0] = 0;
+    count = 1;
+    for (const char *p = start; (p = (const char *) memchr(p, '\n', (size_t) (end - p))) != NULL; p++) {
+        starts[count++] = (int) (p + 1 - start);
+    }
+
+    lexer->line_starts = starts;
+    lexer->line_count = count;
+}
+
+int rbs_lexer_line(rbs_lexer_t *lexer, int byte_pos) {
+    if (RBS_UNLIKELY(lexer->line_starts == NULL)) {
+        rbs_lexer_index_lines(lexer);
+    }
+
+    const int *starts = lexer->line_starts;
+
+    if (byte_pos >= starts[lexer->line_count - 1]) return lexer->line_count;
+
+    // Find the last line that starts at or before the position.
+    int low = 0, high = lexer->line_count - 1;
+    while (low + 1 < high) {
+        int middle = low + (high - low) / 2;
+        if (starts[middle] <= byte_pos) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low + 1;
+}
+
 void rbs_skip(rbs_lexer_t *lexer) {
     RBS_ASSERT(lexer->current_character_bytes > 0, "rbs_skip called with current_character_bytes == 0");
 
@@ -165,11 +214,7 @@ void rbs_skip(rbs_lexer_t *lexer) {
     lexer->current.byte_pos += lexer->current_character_bytes;
     lexer->current.char_pos += 1;
     if (lexer->current_code_point == '\n') {
-        lexer->current.line += 1;
-        lexer->current.column = 0;
         lexer->first_token_of_line = true;
-    } else {
-        lexer->current.column += 1;
     }
 
     if (rbs_next_char(lexer, &codepoint, &byte_len)) {
@@ -187,6 +232,10 @@ rbs_token_t rbs_next_token(rbs_lexer_t *lexer, enum RBSTokenType type) {
     t.type = type;
     t.range.start = lexer->start;
     t.range.end = lexer->current;
+    t.hash = 0;
+    if (RBS_TOKEN_HASHED_P(type)) {
+        t.hash = rbs_constant_pool_hash((const uint8_t *) lexer->string.start + t.range.start.byte_pos, (size_t) RBS_RANGE_BYTES(t.range));
+    }
     lexer->start = lexer->current;
     if (type != tTRIVIA) {
         lexer->first_token_of_line = false;
@@ -202,6 +251,7 @@ rbs_token_t rbs_next_eof_token(rbs_lexer_t *lexer) {
         t.type = pEOF;
         t.range.start = lexer->start;
         t.range.end = lexer->start;
+        t.hash = 0;
         lexer->start = lexer->current;
 
         return t;
@@ -211,6 +261,439 @@ rbs_token_t rbs_next_eof_token(rbs_lexer_t *lexer) {
     }
 }
 
+/**
+ * Moves the current position to `next`, which is `chars` characters ahead on the same line.
+ * */
+static inline void rbs_skip_to(rbs_lexer_t *lexer, const uint8_t *next, int chars, bool ascii_only) {
+    int byte_pos = (int) (next - (const uint8_t *) lexer->string.start);
+
+    lexer->current.byte_pos = byte_pos;
+    lexer->current.char_pos += chars;
+
+    if (ascii_only) {
+        lexer->current_code_point = byte_pos < lexer->end_pos ? *next : '\0';
+        return;
+    }
+
+    unsigned int codepoint;
+    size_t byte_len;
+
+    if (rbs_next_char(lexer, &codepoint, &byte_len)) {
+        lexer->current_code_point = codepoint;
+        lexer->current_character_bytes = byte_len;
+    } else {
+        lexer->current_character_bytes = 1;
+        lexer->current_code_point = '\0';
+    }
+}
+
+#define RBS_KEYWORD(name, type) \
+    if (memcmp(start, name, sizeof(name) - 1) == 0) return type;
+
+static enum RBSTokenType rbs_keyword_type(const uint8_t *start, size_t length) {
+    switch (length) {
+    case 2:
+        RBS_KEYWORD("in", kIN)
+        RBS_KEYWORD("as", kAS)
+        break;
+    case 3:
+        RBS_KEYWORD("def", kDEF)
+        RBS_KEYWORD("end", kEND)
+        RBS_KEYWORD("nil", kNIL)
+        RBS_KEYWORD("bot", kBOT)
+        RBS_KEYWORD("top", kTOP)
+        RBS_KEYWORD("out", kOUT)
+        RBS_KEYWORD("use", kUSE)
+        break;
+    case 4:
+        RBS_KEYWORD("void", kVOID)
+        RBS_KEYWORD("bool", kBOOL)
+        RBS_KEYWORD("self", kSELF)
+        RBS_KEYWORD("true", kTRUE)
+        RBS_KEYWORD("type", kTYPE)
+        RBS_KEYWORD("skip", kSKIP)
+        break;
+    case 5:
+        RBS_KEYWORD("class", kCLASS)
+        RBS_KEYWORD("alias", kALIAS)
+        RBS_KEYWORD("false", kFALSE)
+        break;
+    case 6:
+        RBS_KEYWORD("module", kMODULE)
+        RBS_KEYWORD("extend", kEXTEND)
+        RBS_KEYWORD("public", kPUBLIC)
+        RBS_KEYWORD("return", kRETURN)
+        break;
+    case 7:
+        RBS_KEYWORD("untyped", kUNTYPED)
+        RBS_KEYWORD("include", kINCLUDE)
+        RBS_KEYWORD("private", kPRIVATE)
+        RBS_KEYWORD("prepend", kPREPEND)
+        break;
+    case 8:
+        RBS_KEYWORD("instance", kINSTANCE)
+        RBS_KEYWORD("__todo__", k__TODO__)
+        break;
+    case 9:
+        RBS_KEYWORD("interface", kINTERFACE)
+        RBS_KEYWORD("singleton", kSINGLETON)
+        RBS_KEYWORD("unchecked", kUNCHECKED)
+        break;
+    case 11:
+        RBS_KEYWORD("attr_reader", kATTRREADER)
+        RBS_KEYWORD("attr_writer", kATTRWRITER)
+        break;
+    case 13:
+        RBS_KEYWORD("attr_accessor", kATTRACCESSOR)
+        break;
+    }
+
+    return NullType;
+}
+
+#undef RBS_KEYWORD
+
+/**
+ * Scans an identifier or a keyword made of ASCII characters, as the rules of `lexer.re` do.
+ *
+ * Returns `NullType` when the token continues with a character outside ASCII, or may be `class-alias`, `module-alias`
+ * or `module-self`, so that the generated lexer reads it.
+ * */
+static enum RBSTokenType rbs_scan_identifier(const uint8_t *start, const uint8_t *end, size_t *length) {
+    size_t bytes = 1 + rbs_scan_word(start + 1, end);
+    uint8_t next = start + bytes < end ? start[bytes] : '\0';
+
+    if (next >= 0x80) return NullType;
+
+    if (next == '!' || next == '=') {
+        *length = bytes + 1;
+        return next == '!' ? tBANGIDENT : tEQIDENT;
+    }
+
+    *length = bytes;
+
+    if (start[0] >= 'A' && start[0] <= 'Z') return tUIDENT;
+
+    enum RBSTokenType keyword = rbs_keyword_type(start, bytes);
+    if (keyword != NullType) {
+        if (next == '-' && (keyword == kCLASS || keyword == kMODULE)) return NullType;
+        return keyword;
+    }
+
+    if (start[0] != '_') return tLIDENT;
+    if (bytes > 1 && start[1] >= 'A' && start[1] <= 'Z') return tULIDENT;
+    return tULLIDENT;
+}
+
+/**
+ * The body of `rbs_lexer_scan_token` and `rbs_lexer_scan_token_ascii`, which the compiler specializes for each value of
+ * `ascii_only`.
+ * */
+static inline bool rbs_lexer_scan(rbs_lexer_t *lexer, rbs_token_t *token, bool ascii_only) {
+    const uint8_t *start = (const uint8_t *) lexer->string.start + lexer->current.byte_pos;
+    const uint8_t *end = (const uint8_t *) lexer->string.start + lexer->end_pos;
+    // The block scans below read up to `end`, so it must not be past the bytes of the string.
+    if (end > (const uint8_t *) lexer->string.end) end = (const uint8_t *) lexer->string.end;
+    unsigned int c = lexer->current_code_point;
+    enum RBSTokenType type;
+
+    if (c == ' ' || c == '\t') {
+        size_t length = rbs_scan_spaces(start, end);
+        rbs_skip_to(lexer, start + length, (int) length, ascii_only);
+        type = tTRIVIA;
+    } else if (c == '\n' || c == '\r') {
+        if (c == '\n') {
+            lexer->first_token_of_line = true;
+        }
+        rbs_skip_to(lexer, start + 1, 1, ascii_only);
+        type = tTRIVIA;
+    } else if (c == '#') {
+        const uint8_t *p = start + 1;
+        int chars = 1;
+
+        for (;;) {
+            size_t length = rbs_scan_comment(p, end);
+            p += length;
+            chars += (int) length;
+
+            if (ascii_only || p >= end || *p < 0x80) break;
+
+            // A character outside ASCII continues the comment, unless it is invalid in the encoding.
+            size_t width = lexer->encoding->char_width(p, (ptrdiff_t) ((const uint8_t *) lexer->string.end - p));
+            if (width == 0) break;
+            p += width;
+            chars += 1;
+        }
+
+        // Keep a bare CR in the comment, but leave the CR in CRLF for a trivia token.
+        if (p < end && *p == '\n' && p[-1] == '\r') {
+            p -= 1;
+            chars -= 1;
+        }
+
+        rbs_skip_to(lexer, p, chars, ascii_only);
+        type = lexer->first_token_of_line ? tLINECOMMENT : tCOMMENT;
+    } else if (((c | 0x20) >= 'a' && (c | 0x20) <= 'z') || c == '_') {
+        size_t length;
+        type = rbs_scan_identifier(start, end, &length);
+        if (type == NullType) return false;
+        rbs_skip_to(lexer, start + length, (int) length, ascii_only);
+    } else {
+        return false;
+    }
+
+    *token = rbs_next_token(lexer, type);
+    return true;
+}
+
+bool rbs_lexer_scan_token(rbs_lexer_t *lexer, rbs_token_t *token) {
+    return rbs_lexer_scan(lexer, token, false);
+}
+
+bool rbs_lexer_scan_token_ascii(rbs_lexer_t *lexer, rbs_token_t *token) {
+    return rbs_lexer_scan(lexer, token, true);
+}
+
+rbs_token_t rbs_lexer_next_token(rbs_lexer_t *lexer) {
+    if (lexer->ascii_only) {
+        return rbs_lexer_next_token_ascii(lexer);
+    } else {
+        return rbs_lexer_next_token_generic(lexer);
+    }
+}
+
+rbs_token_t *rbs_lexer_tokenize_all(rbs_lexer_t *lexer, size_t *count) {
+    rbs_token_t (*next_token)(rbs_lexer_t *) = lexer->ascii_only ? rbs_lexer_next_token_ascii : rbs_lexer_next_token_generic;
+
+    // RBS files average about 9 bytes a token, so a token for every 8 bytes is enough for most inputs without growing.
+    size_t capacity = (size_t) (lexer->end_pos - lexer->current.byte_pos) / 8 + 16;
+    rbs_token_t *tokens = rbs_allocator_alloc_many(lexer->allocator, capacity, rbs_token_t);
+    size_t length = 0;
+
+    for (;;) {
+        if (length == capacity) {
+            tokens = rbs_allocator_realloc(lexer->allocator, tokens, capacity * sizeof(rbs_token_t), capacity * 2 * sizeof(rbs_token_t), rbs_token_t);
+            capacity *= 2;
+        }
+
+        rbs_token_t token = next_token(lexer);
+        tokens[length++] = token;
+        if (token.type == pEOF) break;
+    }
+
+    // Give the unused tail back to the allocator, which it does in place for the last allocation.
+    tokens = rbs_allocator_realloc(lexer->allocator, tokens, capacity * sizeof(rbs_token_t), length * sizeof(rbs_token_t), rbs_token_t);
+
+    *count = length;
+    return tokens;
+}
+
+rbs_lexer_checkpoint_t rbs_lexer_checkpoint(const rbs_lexer_t *lexer) {
+    return (rbs_lexer_checkpoint_t) {
+        .position = lexer->current,
+        .first_token_of_line = lexer->first_token_of_line,
+    };
+}
+
+void rbs_lexer_resume(rbs_lexer_t *lexer, rbs_lexer_checkpoint_t checkpoint) {
+    lexer->current = checkpoint.position;
+    lexer->start = checkpoint.position;
+    lexer->first_token_of_line = checkpoint.first_token_of_line;
+
+    unsigned int codepoint;
+    size_t bytes;
+
+    if (rbs_next_char(lexer, &codepoint, &bytes)) {
+        lexer->current_code_point = codepoint;
+        lexer->current_character_bytes = bytes;
+    } else {
+        lexer->current_code_point = '\0';
+        lexer->current_character_bytes = 1;
+    }
+}
+
+/**
+ * Whether a line starts at `byte_pos`, after the token `previous`: a trivia token that ends with a newline, or `NULL`
+ * for the first token.
+ *
+ * Lexing from the start of a line does not depend on the tokens before the line, so the lexer can resume there, and
+ * the tokens after it are the same in two inputs that are the same after it.
+ * */
+static bool rbs_line_start_p(const rbs_lexer_t *lexer, const rbs_token_t *previous, int byte_pos) {
+    if (previous == NULL) return true;
+
+    return previous->type == tTRIVIA && byte_pos > 0 && lexer->string.start[byte_pos - 1] == '\n';
+}
+
+/**
+ * Whether the lexer may have read past the line of `token` to lex it.
+ *
+ * An unterminated string, annotation or quoted identifier is read up to the end of the input before the lexer backs up
+ * to the `ErrorToken` of its quote or the `tOPERATOR` of its `%` or backquote, so the token depends on every byte after
+ * it. Every other token depends on its own line only.
+ * */
+static bool rbs_token_reads_ahead_p(const rbs_lexer_t *lexer, const rbs_token_t *token) {
+    if (token->type == ErrorToken) return true;
+    if (token->type != tOPERATOR) return false;
+
+    char c = lexer->string.start[token->range.start.byte_pos];
+    return c == '%' || c == '`';
+}
+
+static rbs_token_t *rbs_push_token(rbs_allocator_t *allocator, rbs_token_t *tokens, size_t *length, size_t *capacity, rbs_token_t token) {
+    if (*length == *capacity) {
+        tokens = rbs_allocator_realloc(allocator, tokens, *capacity * sizeof(rbs_token_t), *capacity * 2 * sizeof(rbs_token_t), rbs_token_t);
+        *capacity *= 2;
+    }
+
+    tokens[(*length)++] = token;
+    return tokens;
+}
+
+rbs_token_t *rbs_lexer_relex(rbs_lexer_t *lexer, const rbs_token_t *old_tokens, size_t old_count, rbs_lexer_edit_t edit, size_t *count, size_t *relexed_start, size_t *relexed_count) {
+    rbs_token_t (*next_token)(rbs_lexer_t *) = lexer->ascii_only ? rbs_lexer_next_token_ascii : rbs_lexer_next_token_generic;
+
+    // The last token that starts at or before the edit, or the first token that may depend on the edit from further
+    // back, and then the start of its line. The bytes before the edit are the same in both inputs, so the old tokens
+    // tell where the lines start.
+    size_t low = 0, high = old_count;
+    while (high - low > 1) {
+        size_t middle = low + (high - low) / 2;
+        if (old_tokens[middle].range.start.byte_pos <= edit.start_byte) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+    size_t first = low;
+    for (size_t i = 0; i < first; i++) {
+        if (rbs_token_reads_ahead_p(lexer, &old_tokens[i])) {
+            first = i;
+            break;
+        }
+    }
+    while (!rbs_line_start_p(lexer, first > 0 ? &old_tokens[first - 1] : NULL, old_tokens[first].range.start.byte_pos)) {
+        first--;
+    }
+
+    size_t capacity = old_count + 16;
+    rbs_token_t *tokens = rbs_allocator_alloc_many(lexer->allocator, capacity, rbs_token_t);
+    memcpy(tokens, old_tokens, first * sizeof(rbs_token_t));
+    size_t length = first;
+
+    rbs_lexer_checkpoint_t checkpoint = {
+        .position = old_tokens[first].range.start,
+        .first_token_of_line = true,
+    };
+    rbs_lexer_resume(lexer, checkpoint);
+
+    int byte_delta = edit.new_end_byte - edit.old_end_byte;
+    size_t old_index = first;
+
+    for (;;) {
+        // A line that starts after the edit, at a line start of the old tokens too, is where the two token streams
+        // meet again.
+        int byte_pos = lexer->current.byte_pos;
+        if (byte_pos > edit.new_end_byte && length > 0 && rbs_line_start_p(lexer, &tokens[length - 1], byte_pos)) {
+            int old_byte_pos = byte_pos - byte_delta;
+            while (old_index < old_count && old_tokens[old_index].range.start.byte_pos < old_byte_pos) {
+                old_index++;
+            }
+            if (old_index < old_count && old_tokens[old_index].range.start.byte_pos == old_byte_pos && old_tokens[old_index - 1].type == tTRIVIA) {
+                break;
+            }
+        }
+
+        rbs_token_t token = next_token(lexer);
+        tokens = rbs_push_token(lexer->allocator, tokens, &length, &capacity, token);
+        if (token.type == pEOF) {
+            old_index = old_count;
+            break;
+        }
+    }
+
+    *relexed_start = first;
+    *relexed_count = length - first;
+
+    if (old_index < old_count) {
+        int char_delta = lexer->current.char_pos - old_tokens[old_index].range.start.char_pos;
+
+        for (size_t i = old_index; i < old_count; i++) {
+            rbs_token_t token = old_tokens[i];
+            token.range.start.byte_pos += byte_delta;
+            token.range.start.char_pos += char_delta;
+            token.range.end.byte_pos += byte_delta;
+            token.range.end.char_pos += char_delta;
+            tokens = rbs_push_token(lexer->allocator, tokens, &length, &capacity, token);
+        }
+    }
+
+    tokens = rbs_allocator_realloc(lexer->allocator, tokens, capacity * sizeof(rbs_token_t), length * sizeof(rbs_token_t), rbs_token_t);
+
+    *count = length;
+    return tokens;
+}
+
+static void rbs_pack_u32(uint8_t *out, uint32_t value) {
+    out[0] = (uint8_t) (value & 0xff);
+    out[1] = (uint8_t) ((value >> 8) & 0xff);
+    out[2] = (uint8_t) ((value >> 16) & 0xff);
+    out[3] = (uint8_t) ((value >> 24) & 0xff);
+}
+
+static uint32_t rbs_unpack_u32(const uint8_t *in) {
+    return (uint32_t) in[0] | ((uint32_t) in[1] << 8) | ((uint32_t) in[2] << 16) | ((uint32_t) in[3] << 24);
+}
+
+void rbs_pack_tokens(const rbs_token_t *tokens, size_t count, uint8_t *out) {
+    for (size_t i = 0; i < count; i++) {
+        out[0] = (uint8_t) tokens[i].type;
+        rbs_pack_u32(out + 1, (uint32_t) tokens[i].range.start.char_pos);
+        rbs_pack_u32(out + 5, (uint32_t) tokens[i].range.end.char_pos);
+        rbs_pack_u32(out + 9, (uint32_t) tokens[i].range.start.byte_pos);
+        rbs_pack_u32(out + 13, (uint32_t) tokens[i].range.end.byte_pos);
+        out += RBS_PACKED_TOKEN_SIZE;
+    }
+}
+
+void rbs_unpack_tokens(const uint8_t *in, size_t count, rbs_token_t *tokens) {
+    for (size_t i = 0; i < count; i++) {
+        tokens[i].type = (enum RBSTokenType) in[0];
+        tokens[i].range.start.char_pos = (int) rbs_unpack_u32(in + 1);
+        tokens[i].range.end.char_pos = (int) rbs_unpack_u32(in + 5);
+        tokens[i].range.start.byte_pos = (int) rbs_unpack_u32(in + 9);
+        tokens[i].range.end.byte_pos = (int) rbs_unpack_u32(in + 13);
+        tokens[i].hash = 0;
+        in += RBS_PACKED_TOKEN_SIZE;
+    }
+}
+
+bool rbs_packed_tokens_valid_p(const uint8_t *in, size_t size, rbs_lexer_edit_t edit, int end_pos) {
+    if (size == 0 || size % RBS_PACKED_TOKEN_SIZE != 0 || in[size - RBS_PACKED_TOKEN_SIZE] != pEOF) return false;
+
+    // The length of the old input, where the edit has to be too.
+    int64_t old_end_pos = (int64_t) end_pos - edit.new_end_byte + edit.old_end_byte;
+    if (edit.start_byte < 0 || edit.old_end_byte < edit.start_byte || old_end_pos < edit.old_end_byte || old_end_pos > INT32_MAX) return false;
+
+    // A character takes one byte at least, so a character position is never greater than its byte position.
+    uint32_t char_pos = 0, byte_pos = 0;
+    for (const uint8_t *p = in; p < in + size; p += RBS_PACKED_TOKEN_SIZE) {
+        uint32_t start_char = rbs_unpack_u32(p + 1), end_char = rbs_unpack_u32(p + 5);
+        uint32_t start_byte = rbs_unpack_u32(p + 9), end_byte = rbs_unpack_u32(p + 13);
+
+        if (p[0] >= RBS_TOKEN_TYPE_COUNT) return false;
+        if (start_char < char_pos || end_char < start_char || start_byte < byte_pos || end_byte < start_byte) return false;
+        if (end_byte > (uint32_t) old_end_pos || start_char > start_byte || end_char > end_byte) return false;
+
+        char_pos = end_char;
+        byte_pos = end_byte;
+    }
+
+    // The lexer stops at the end of the input, or at a NUL byte before it, so the tokens end there. The edit has to be
+    // in the input the tokens cover.
+    return (uint32_t) edit.old_end_byte <= byte_pos;
+}
+
 void rbs_skipn(rbs_lexer_t *lexer, size_t size) {
     for (size_t i = 0; i < size; i++) {
         rbs_skip(lexer);
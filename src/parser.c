@@ -14,14 +14,9 @@
 #include "rbs/util/rbs_unescape.h"
 #include "rbs/util/rbs_buffer.h"
 #include "rbs/util/rbs_assert.h"
+#include "rbs/util/rbs_scan.h"
 
-#define INTERN_TOKEN(parser, tok)                             \
-    rbs_constant_pool_insert_shared_with_encoding(            \
-        &parser->constant_pool,                               \
-        (const uint8_t *) rbs_peek_token(parser->lexer, tok), \
-        rbs_token_bytes(tok),                                 \
-        parser->lexer->encoding                               \
-    )
+#define INTERN_TOKEN(parser, tok) intern_token(parser, tok)
 
 #define KEYWORD_CASES   \
     case kBOOL:         \
@@ -116,6 +111,8 @@
 
 #define ALLOCATOR() parser->allocator
 
+#define POSITION_LINE(pos) rbs_lexer_line(parser->lexer, (pos).byte_pos)
+
 typedef struct {
     rbs_node_list_t *required_positionals;
     rbs_node_list_t *optional_positionals;
@@ -148,6 +145,7 @@ static rbs_location_range rbs_location_range_current_token(rbs_parser_t *parser)
 
 static bool parse_optional(rbs_parser_t *parser, rbs_node_t **optional, bool void_allowed, bool self_allowed, bool classish_allowed);
 static bool parse_simple(rbs_parser_t *parser, rbs_node_t **type, bool void_allowed, bool self_allowed, bool classish_allowed);
+static bool parse_member_type(rbs_parser_t *parser, rbs_node_t **type, bool self_allowed, bool classish_allowed);
 
 /**
  * @returns A borrowed copy of the current token, which does *not* need to be freed.
@@ -161,6 +159,20 @@ static rbs_string_t rbs_parser_peek_current_token(rbs_parser_t *parser) {
     return rbs_string_new(start, start + length);
 }
 
+/**
+ * Interns the content of the token, with the hash the lexer computed for identifier tokens.
+ * */
+static rbs_constant_id_t intern_token(rbs_parser_t *parser, rbs_token_t tok) {
+    const uint8_t *start = (const uint8_t *) rbs_peek_token(parser->lexer, tok);
+    size_t length = (size_t) rbs_token_bytes(tok);
+
+    if (RBS_TOKEN_HASHED_P(tok.type)) {
+        return rbs_constant_pool_insert_shared_with_hash(&parser->constant_pool, start, length, tok.hash);
+    }
+
+    return rbs_constant_pool_insert_shared_with_encoding(&parser->constant_pool, start, length, parser->lexer->encoding);
+}
+
 static rbs_constant_id_t rbs_constant_pool_insert_string(rbs_constant_pool_t *self, rbs_string_t string) {
     return rbs_constant_pool_insert_shared(self, (const uint8_t *) string.start, rbs_string_len(string));
 }
@@ -264,16 +276,26 @@ error_handling: {
 }
 }
 
+/**
+ * Appends `node` to `*list`, allocating a list in place of the shared empty list on the first append.
+ * */
+static void push_node(rbs_parser_t *parser, rbs_node_list_t **list, rbs_node_t *node) {
+    if (*list == rbs_node_list_empty()) {
+        *list = rbs_node_list_new(ALLOCATOR());
+    }
+    rbs_node_list_append(*list, node);
+}
+
 /*
   type_list ::= {} type `,` ... <`,`> eol
               | {} type `,` ... `,` <type> eol
 */
 RBS_NODISCARD
-static bool parse_type_list(rbs_parser_t *parser, enum RBSTokenType eol, rbs_node_list_t *types, bool void_allowed, bool self_allowed, bool classish_allowed) {
+static bool parse_type_list(rbs_parser_t *parser, enum RBSTokenType eol, rbs_node_list_t **types, bool void_allowed, bool self_allowed, bool classish_allowed) {
     while (true) {
         rbs_node_t *type;
         CHECK_PARSE(rbs_parse_type(parser, &type, void_allowed, self_allowed, classish_allowed));
-        rbs_node_list_append(types, type);
+        push_node(parser, types, type);
 
         if (parser->next_token.type == pCOMMA) {
             rbs_parser_advance(parser);
@@ -440,23 +462,24 @@ static bool parse_keyword_key(rbs_parser_t *parser, rbs_ast_symbol_t **key) {
   keyword ::= {} keyword `:` <function_param>
 */
 RBS_NODISCARD
-static bool parse_keyword(rbs_parser_t *parser, rbs_hash_t *keywords, rbs_hash_t *memo, bool self_allowed, bool classish_allowed) {
+static bool parse_keyword(rbs_parser_t *parser, method_params *params, bool optional, bool self_allowed, bool classish_allowed) {
     rbs_ast_symbol_t *key = NULL;
     CHECK_PARSE(parse_keyword_key(parser, &key));
 
-    if (rbs_hash_find(memo, (rbs_node_t *) key)) {
+    if (rbs_hash_find(params->required_keywords, (rbs_node_t *) key) || rbs_hash_find(params->optional_keywords, (rbs_node_t *) key)) {
         rbs_parser_set_error(parser, parser->current_token, true, "duplicated keyword argument");
         return false;
-    } else {
-        rbs_location_range symbol_range = rbs_location_range_current_token(parser);
-        rbs_hash_set(memo, (rbs_node_t *) key, (rbs_node_t *) rbs_ast_bool_new(ALLOCATOR(), symbol_range, true));
     }
 
     ADVANCE_ASSERT(parser, pCOLON);
     rbs_types_function_param_t *param = NULL;
     CHECK_PARSE(parse_function_param(parser, &param, self_allowed, classish_allowed));
 
-    rbs_hash_set(keywords, (rbs_node_t *) key, (rbs_node_t *) param);
+    rbs_hash_t **keywords = optional ? &params->optional_keywords : &params->required_keywords;
+    if (*keywords == rbs_hash_empty()) {
+        *keywords = rbs_hash_new(ALLOCATOR());
+    }
+    rbs_hash_set(*keywords, (rbs_node_t *) key, (rbs_node_t *) param);
 
     return true;
 }
@@ -537,8 +560,6 @@ static bool parse_params(rbs_parser_t *parser, method_params *params, bool forwa
         return true;
     }
 
-    rbs_hash_t *memo = rbs_hash_new(ALLOCATOR());
-
     while (true) {
         switch (parser->next_token.type) {
         case pQUESTION:
@@ -575,7 +596,7 @@ static bool parse_params(rbs_parser_t *parser, method_params *params, bool forwa
 
             rbs_types_function_param_t *param = NULL;
             CHECK_PARSE(parse_function_param(parser, &param, self_allowed, classish_allowed));
-            rbs_node_list_append(params->required_positionals, (rbs_node_t *) param);
+            push_node(parser, &params->required_positionals, (rbs_node_t *) param);
 
             break;
         }
@@ -592,14 +613,14 @@ PARSE_OPTIONAL_PARAMS:
             rbs_parser_advance(parser);
 
             if (is_keyword(parser)) {
-                CHECK_PARSE(parse_keyword(parser, params->optional_keywords, memo, self_allowed, classish_allowed));
+                CHECK_PARSE(parse_keyword(parser, params, true, self_allowed, classish_allowed));
                 parser_advance_if(parser, pCOMMA);
                 goto PARSE_KEYWORDS;
             }
 
             rbs_types_function_param_t *param = NULL;
             CHECK_PARSE(parse_function_param(parser, &param, self_allowed, classish_allowed));
-            rbs_node_list_append(params->optional_positionals, (rbs_node_t *) param);
+            push_node(parser, &params->optional_positionals, (rbs_node_t *) param);
 
             break;
         }
@@ -644,7 +665,7 @@ PARSE_TRAILING_PARAMS:
 
             rbs_types_function_param_t *param = NULL;
             CHECK_PARSE(parse_function_param(parser, &param, self_allowed, classish_allowed));
-            rbs_node_list_append(params->trailing_positionals, (rbs_node_t *) param);
+            push_node(parser, &params->trailing_positionals, (rbs_node_t *) param);
 
             break;
         }
@@ -660,7 +681,7 @@ PARSE_KEYWORDS:
         case pQUESTION:
             rbs_parser_advance(parser);
             if (is_keyword(parser)) {
-                CHECK_PARSE(parse_keyword(parser, params->optional_keywords, memo, self_allowed, classish_allowed));
+                CHECK_PARSE(parse_keyword(parser, params, true, self_allowed, classish_allowed));
             } else {
                 rbs_parser_set_error(parser, parser->next_token, true, "optional keyword argument type is expected");
                 return false;
@@ -683,7 +704,7 @@ PARSE_KEYWORDS:
         case tBANGIDENT:
             KEYWORD_CASES
             if (is_keyword(parser)) {
-                CHECK_PARSE(parse_keyword(parser, params->required_keywords, memo, self_allowed, classish_allowed));
+                CHECK_PARSE(parse_keyword(parser, params, false, self_allowed, classish_allowed));
             } else {
                 rbs_parser_set_error(parser, parser->next_token, true, "required keyword argument type is expected");
                 return false;
@@ -736,14 +757,14 @@ static bool parse_optional(rbs_parser_t *parser, rbs_node_t **optional, bool voi
     return true;
 }
 
-static void initialize_method_params(method_params *params, rbs_allocator_t *allocator) {
+static void initialize_method_params(method_params *params) {
     *params = (method_params) {
-        .required_positionals = rbs_node_list_new(allocator),
-        .optional_positionals = rbs_node_list_new(allocator),
+        .required_positionals = rbs_node_list_empty(),
+        .optional_positionals = rbs_node_list_empty(),
         .rest_positionals = NULL,
-        .trailing_positionals = rbs_node_list_new(allocator),
-        .required_keywords = rbs_hash_new(allocator),
-        .optional_keywords = rbs_hash_new(allocator),
+        .trailing_positionals = rbs_node_list_empty(),
+        .required_keywords = rbs_hash_empty(),
+        .optional_keywords = rbs_hash_empty(),
         .rest_keywords = NULL,
         .forwarding = NULL,
     };
@@ -790,7 +811,7 @@ static bool parse_function(rbs_parser_t *parser, bool accept_type_binding, bool
     function_range.start = parser->current_token.range.start;
 
     method_params params;
-    initialize_method_params(&params, ALLOCATOR());
+    initialize_method_params(&params);
 
     if (parser->next_token.type == pLPAREN) {
         rbs_parser_advance(parser);
@@ -837,7 +858,7 @@ static bool parse_function(rbs_parser_t *parser, bool accept_type_binding, bool
         rbs_parser_advance(parser);
 
         method_params block_params;
-        initialize_method_params(&block_params, ALLOCATOR());
+        initialize_method_params(&block_params);
 
         if (parser->next_token.type == pLPAREN) {
             rbs_parser_advance(parser);
@@ -1068,7 +1089,7 @@ static bool parse_instance_type(rbs_parser_t *parser, bool parse_alias, rbs_node
     rbs_type_name_t *type_name = NULL;
     CHECK_PARSE(parse_type_name(parser, expected_kind, &name_range, &type_name));
 
-    rbs_node_list_t *types = rbs_node_list_new(ALLOCATOR());
+    rbs_node_list_t *types = rbs_node_list_empty();
 
     TypeNameKind kind;
     switch (parser->current_token.type) {
@@ -1095,7 +1116,7 @@ static bool parse_instance_type(rbs_parser_t *parser, bool parse_alias, rbs_node
     if (parser->next_token.type == pLBRACKET) {
         rbs_parser_advance(parser);
         args_range.start = parser->current_token.range.start;
-        CHECK_PARSE(parse_type_list(parser, pRBRACKET, types, true, true, true));
+        CHECK_PARSE(parse_type_list(parser, pRBRACKET, &types, true, true, true));
         ADVANCE_ASSERT(parser, pRBRACKET);
         args_range.end = parser->current_token.range.end;
     } else {
@@ -1144,14 +1165,14 @@ static bool parse_singleton_type(rbs_parser_t *parser, rbs_types_class_singleton
 
     ADVANCE_ASSERT(parser, pRPAREN);
 
-    rbs_node_list_t *types = rbs_node_list_new(ALLOCATOR());
+    rbs_node_list_t *types = rbs_node_list_empty();
 
     rbs_location_range args_range = RBS_LOCATION_NULL_RANGE;
     if (parser->next_token.type == pLBRACKET) {
         rbs_parser_advance(parser);
         args_range.start_byte = parser->current_token.range.start.byte_pos;
         args_range.start_char = parser->current_token.range.start.char_pos;
-        CHECK_PARSE(parse_type_list(parser, pRBRACKET, types, true, self_allowed, classish_allowed));
+        CHECK_PARSE(parse_type_list(parser, pRBRACKET, &types, true, self_allowed, classish_allowed));
         ADVANCE_ASSERT(parser, pRBRACKET);
         args_range.end_byte = parser->current_token.range.end.byte_pos;
         args_range.end_char = parser->current_token.range.end.char_pos;
@@ -1351,9 +1372,9 @@ static bool parse_simple(rbs_parser_t *parser, rbs_node_t **type, bool void_allo
     case pLBRACKET: {
         rbs_range_t rg;
         rg.start = parser->current_token.range.start;
-        rbs_node_list_t *types = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *types = rbs_node_list_empty();
         if (parser->next_token.type != pRBRACKET) {
-            CHECK_PARSE(parse_type_list(parser, pRBRACKET, types, false, self_allowed, classish_allowed));
+            CHECK_PARSE(parse_type_list(parser, pRBRACKET, &types, false, self_allowed, classish_allowed));
         }
         ADVANCE_ASSERT(parser, pRBRACKET);
         rg.end = parser->current_token.range.end;
@@ -1363,7 +1384,7 @@ static bool parse_simple(rbs_parser_t *parser, rbs_node_t **type, bool void_allo
     }
     case pAREF_OPR: {
         rbs_location_range loc = rbs_location_range_current_token(parser);
-        rbs_node_list_t *types = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *types = rbs_node_list_empty();
         *type = (rbs_node_t *) rbs_types_tuple_new(ALLOCATOR(), loc, types);
         return true;
     }
@@ -1470,7 +1491,7 @@ bool rbs_parse_type(rbs_parser_t *parser, rbs_node_t **type, bool void_allowed,
 */
 RBS_NODISCARD
 static bool parse_type_params(rbs_parser_t *parser, rbs_range_t *rg, bool module_type_params, rbs_node_list_t **params) {
-    *params = rbs_node_list_new(ALLOCATOR());
+    *params = rbs_node_list_empty();
 
     bool required_param_allowed = true;
 
@@ -1587,7 +1608,7 @@ static bool parse_type_params(rbs_parser_t *parser, rbs_range_t *rg, bool module
             param->lower_bound_range = RBS_RANGE_LEX2AST(lower_bound_range);
             param->default_range = RBS_RANGE_LEX2AST(default_type_range);
 
-            rbs_node_list_append(*params, (rbs_node_t *) param);
+            push_node(parser, params, (rbs_node_t *) param);
 
             if (parser->next_token.type == pCOMMA) {
                 rbs_parser_advance(parser);
@@ -1675,7 +1696,7 @@ static bool parse_global_decl(rbs_parser_t *parser, rbs_node_list_t *annotations
     rbs_range_t decl_range;
     decl_range.start = parser->current_token.range.start;
 
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, decl_range.start.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(decl_range.start));
 
     rbs_range_t name_range = parser->current_token.range;
 
@@ -1685,7 +1706,7 @@ static bool parse_global_decl(rbs_parser_t *parser, rbs_node_list_t *annotations
     rbs_range_t colon_range = parser->current_token.range;
 
     rbs_node_t *type;
-    CHECK_PARSE(rbs_parse_type(parser, &type, false, false, false));
+    CHECK_PARSE(parse_member_type(parser, &type, false, false));
     decl_range.end = parser->current_token.range.end;
 
     *global = rbs_ast_declarations_global_new(ALLOCATOR(), RBS_RANGE_LEX2AST(decl_range), type_name, type, comment, annotations, RBS_RANGE_LEX2AST(name_range), RBS_RANGE_LEX2AST(colon_range));
@@ -1700,7 +1721,7 @@ static bool parse_const_decl(rbs_parser_t *parser, rbs_node_list_t *annotations,
     rbs_range_t decl_range;
 
     decl_range.start = parser->current_token.range.start;
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, decl_range.start.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(decl_range.start));
 
     rbs_range_t name_range;
     rbs_type_name_t *type_name = NULL;
@@ -1710,7 +1731,7 @@ static bool parse_const_decl(rbs_parser_t *parser, rbs_node_list_t *annotations,
     rbs_range_t colon_range = parser->current_token.range;
 
     rbs_node_t *type;
-    CHECK_PARSE(rbs_parse_type(parser, &type, false, false, false));
+    CHECK_PARSE(parse_member_type(parser, &type, false, false));
 
     decl_range.end = parser->current_token.range.end;
 
@@ -1745,13 +1766,13 @@ static bool parse_type_decl(rbs_parser_t *parser, rbs_position_t comment_pos, rb
     rbs_range_t eq_range = parser->current_token.range;
 
     rbs_node_t *type;
-    CHECK_PARSE(rbs_parse_type(parser, &type, false, false, false));
+    CHECK_PARSE(parse_member_type(parser, &type, false, false));
 
     decl_range.end = parser->current_token.range.end;
 
     CHECK_PARSE(parser_pop_typevar_table(parser));
 
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     *typealias = rbs_ast_declarations_type_alias_new(ALLOCATOR(), RBS_RANGE_LEX2AST(decl_range), type_name, type_params, type, annotations, comment, RBS_RANGE_LEX2AST(keyword_range), RBS_RANGE_LEX2AST(name_range), RBS_RANGE_LEX2AST(eq_range));
     (*typealias)->type_params_range = RBS_RANGE_LEX2AST(params_range);
@@ -1822,7 +1843,7 @@ static bool parse_annotation(rbs_parser_t *parser, rbs_ast_annotation_t **annota
                 | {<>}
 */
 RBS_NODISCARD
-static bool parse_annotations(rbs_parser_t *parser, rbs_node_list_t *annotations, rbs_position_t *annot_pos) {
+static bool parse_annotations(rbs_parser_t *parser, rbs_node_list_t **annotations, rbs_position_t *annot_pos) {
     *annot_pos = NullPosition;
 
     while (true) {
@@ -1835,7 +1856,7 @@ static bool parse_annotations(rbs_parser_t *parser, rbs_node_list_t *annotations
 
             rbs_ast_annotation_t *annotation = NULL;
             CHECK_PARSE(parse_annotation(parser, &annotation));
-            rbs_node_list_append(annotations, (rbs_node_t *) annotation);
+            push_node(parser, annotations, (rbs_node_t *) annotation);
         } else {
             break;
         }
@@ -1955,6 +1976,293 @@ static InstanceSingletonKind parse_instance_singleton_kind(rbs_parser_t *parser,
     return kind;
 }
 
+/**
+ * Skips a bracketed group, from the opening token at `current_token` up to and including the closing token that
+ * matches it.
+ *
+ * The brackets are only counted, not checked to pair with the same kind of bracket: parsing the text later does that.
+ * */
+static bool skip_balanced(rbs_parser_t *parser) {
+    int depth = 0;
+
+    while (true) {
+        switch (parser->current_token.type) {
+        case pLPAREN:
+        case pLBRACKET:
+        case pLBRACE:
+            depth++;
+            break;
+        case pRPAREN:
+        case pRBRACKET:
+        case pRBRACE:
+            depth--;
+            break;
+        case pEOF:
+            return false;
+        default:
+            break;
+        }
+
+        if (depth == 0) {
+            return true;
+        }
+
+        rbs_parser_advance(parser);
+    }
+}
+
+static bool skip_function(rbs_parser_t *parser, bool accept_type_binding);
+
+/**
+ * Skips the tokens of an `optional` type, which `parse_optional` would read.
+ * */
+static bool skip_optional(rbs_parser_t *parser) {
+    rbs_parser_advance(parser);
+
+    switch (parser->current_token.type) {
+    case pLPAREN:
+    case pLBRACKET:
+    case pLBRACE:
+        if (!skip_balanced(parser)) return false;
+        break;
+    case pHAT:
+        if (!skip_function(parser, true)) return false;
+        break;
+    case kSINGLETON:
+        if (parser->next_token.type != pLPAREN) return false;
+        rbs_parser_advance(parser);
+        if (!skip_balanced(parser)) return false;
+        if (parser->next_token.type == pLBRACKET) {
+            rbs_parser_advance(parser);
+            if (!skip_balanced(parser)) return false;
+        }
+        break;
+    case pCOLON2:
+    case tUIDENT:
+    case tULIDENT:
+    case tLIDENT:
+    case kSKIP:
+    case kRETURN:
+        if (parser->current_token.type == pCOLON2) {
+            rbs_parser_advance(parser);
+        }
+        while (parser->current_token.type == tUIDENT && parser->next_token.type == pCOLON2) {
+            rbs_parser_advance(parser);
+            rbs_parser_advance(parser);
+        }
+        switch (parser->current_token.type) {
+        case tUIDENT:
+        case tULIDENT:
+        case tLIDENT:
+        case kSKIP:
+        case kRETURN:
+            break;
+        default:
+            return false;
+        }
+        if (parser->next_token.type == pLBRACKET) {
+            rbs_parser_advance(parser);
+            if (!skip_balanced(parser)) return false;
+        }
+        break;
+    case kBOOL:
+    case kBOT:
+    case kCLASS:
+    case kINSTANCE:
+    case kNIL:
+    case kSELF:
+    case kTOP:
+    case kVOID:
+    case kUNTYPED:
+    case k__TODO__:
+    case tINTEGER:
+    case kTRUE:
+    case kFALSE:
+    case tSQSTRING:
+    case tDQSTRING:
+    case tSYMBOL:
+    case tSQSYMBOL:
+    case tDQSYMBOL:
+    case pAREF_OPR:
+        break;
+    default:
+        return false;
+    }
+
+    if (parser->next_token.type == pQUESTION) {
+        rbs_parser_advance(parser);
+    }
+
+    return true;
+}
+
+/**
+ * Skips the tokens of a `function`, which `parse_function` would read.
+ * */
+static bool skip_function(rbs_parser_t *parser, bool accept_type_binding) {
+    if (parser->next_token.type == pLPAREN) {
+        rbs_parser_advance(parser);
+        if (!skip_balanced(parser)) return false;
+    }
+
+    if (accept_type_binding && parser->next_token.type == pLBRACKET) {
+        rbs_parser_advance(parser);
+        if (!skip_balanced(parser)) return false;
+    }
+
+    if (parser->next_token.type == pQUESTION && parser->next_token2.type == pLBRACE) {
+        rbs_parser_advance(parser);
+    }
+
+    if (parser->next_token.type == pLBRACE) {
+        rbs_parser_advance(parser);
+        if (!skip_balanced(parser)) return false;
+    }
+
+    if (parser->next_token.type != pARROW) return false;
+    rbs_parser_advance(parser);
+
+    return skip_optional(parser);
+}
+
+/**
+ * The tokens and the lexer position of a parser, to go back to after skipping tokens that turn out not to match.
+ * */
+typedef struct {
+    rbs_token_t current_token;
+    rbs_token_t next_token;
+    rbs_token_t next_token2;
+    rbs_token_t next_token3;
+    rbs_lexer_checkpoint_t checkpoint;
+    rbs_comment_t *last_comment;
+} parser_backup_t;
+
+static parser_backup_t parser_backup(rbs_parser_t *parser) {
+    return (parser_backup_t) {
+        .current_token = parser->current_token,
+        .next_token = parser->next_token,
+        .next_token2 = parser->next_token2,
+        .next_token3 = parser->next_token3,
+        .checkpoint = rbs_lexer_checkpoint(parser->lexer),
+        .last_comment = parser->last_comment,
+    };
+}
+
+static void parser_restore(rbs_parser_t *parser, parser_backup_t backup) {
+    parser->current_token = backup.current_token;
+    parser->next_token = backup.next_token;
+    parser->next_token2 = backup.next_token2;
+    parser->next_token3 = backup.next_token3;
+    rbs_lexer_resume(parser->lexer, backup.checkpoint);
+    parser->last_comment = backup.last_comment;
+}
+
+/**
+ * Skips the tokens of a type, which `rbs_parse_type` would read, and sets `range` to them.
+ * */
+static bool skip_type(rbs_parser_t *parser, rbs_range_t *range) {
+    range->start = parser->next_token.range.start;
+
+    while (true) {
+        if (!skip_optional(parser)) return false;
+
+        if (parser->next_token.type == pBAR || parser->next_token.type == pAMP) {
+            rbs_parser_advance(parser);
+        } else {
+            break;
+        }
+    }
+
+    range->end = parser->current_token.range.end;
+    return true;
+}
+
+/**
+ * Parses the type of a declaration or a member other than a method definition.
+ *
+ * With the `skeleton` option, the type is skipped and given as `untyped` at the location of its text. If the tokens
+ * don't look like a type, they are parsed, so that the syntax error is reported as it is without the option.
+ * */
+static bool parse_member_type(rbs_parser_t *parser, rbs_node_t **type, bool self_allowed, bool classish_allowed) {
+    if (parser->options.skeleton) {
+        parser_backup_t backup = parser_backup(parser);
+
+        rbs_range_t range;
+        if (skip_type(parser, &range)) {
+            *type = (rbs_node_t *) rbs_types_bases_any_new(ALLOCATOR(), RBS_RANGE_LEX2AST(range), false);
+            return true;
+        }
+
+        parser_restore(parser, backup);
+    }
+
+    return rbs_parse_type(parser, type, false, self_allowed, classish_allowed);
+}
+
+/**
+ * Skips the overloads of a method definition for the `skeleton` option, and sets `range` to the method types in
+ * them, or to NULL_RANGE if the definition is only `...`.
+ *
+ * If the tokens don't look like method types, it sets the tokens and the lexer back to where they were, and returns
+ * false. The caller parses the overloads then, so that the syntax error is reported as it is without the option.
+ * */
+static bool skip_method_overloads(rbs_parser_t *parser, bool accept_overload, bool *overloading, rbs_range_t *overloading_range, rbs_range_t *range) {
+    parser_backup_t backup = parser_backup(parser);
+
+    *range = (rbs_range_t) { .start = parser->next_token.range.start, .end = NullPosition };
+
+    while (true) {
+        while (parser->next_token.type == tANNOTATION) {
+            rbs_parser_advance(parser);
+        }
+
+        if (parser->next_token.type == pDOT3) {
+            rbs_parser_advance(parser);
+            if (!accept_overload || parser->next_token.type == pBAR) break;
+
+            *overloading = true;
+            *overloading_range = parser->current_token.range;
+            if (rbs_null_position_p(range->end)) {
+                *range = NULL_RANGE;
+            }
+            return true;
+        }
+
+        if (parser->next_token.type == pLBRACKET) {
+            rbs_parser_advance(parser);
+            if (!skip_balanced(parser)) break;
+        }
+        if (!skip_function(parser, false)) break;
+
+        range->end = parser->current_token.range.end;
+
+        if (parser->next_token.type == pBAR) {
+            rbs_parser_advance(parser);
+        } else {
+            return true;
+        }
+    }
+
+    parser_restore(parser, backup);
+    return false;
+}
+
+/**
+ * Returns the symbols of the type variables in scope, for `rbs_parse_method_overloads` to declare them again.
+ * */
+static rbs_node_list_t *parser_typevar_symbols(rbs_parser_t *parser) {
+    rbs_node_list_t *symbols = rbs_node_list_new(ALLOCATOR());
+
+    for (id_table *table = parser->vars; table && !RESET_TABLE_P(table); table = table->next) {
+        for (size_t i = 0; i < table->count; i++) {
+            rbs_ast_symbol_t *symbol = rbs_ast_symbol_new(ALLOCATOR(), RBS_LOCATION_NULL_RANGE, &parser->constant_pool, table->ids[i]);
+            rbs_node_list_append(symbols, (rbs_node_t *) symbol);
+        }
+    }
+
+    return symbols;
+}
+
 /**
  * def_member ::= {kDEF} method_name `:` <method_types>
  *              | {kPRIVATE} kDEF method_name `:` <method_types>
@@ -1973,7 +2281,7 @@ static bool parse_member_def(rbs_parser_t *parser, bool instance_only, bool acce
     member_range.start = parser->current_token.range.start;
     comment_pos = rbs_nonnull_pos_or(comment_pos, member_range.start);
 
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     rbs_range_t visibility_range;
     enum rbs_method_definition_visibility visibility;
@@ -2028,15 +2336,31 @@ static bool parse_member_def(rbs_parser_t *parser, bool instance_only, bool acce
     bool overloading = false;
     rbs_range_t overloading_range = NULL_RANGE;
     bool loop = true;
+
+    // With `lazy_overloads`, the method types are parsed to report syntax errors in them, and only their range is kept.
+    rbs_range_t lazy_range = { .start = parser->next_token.range.start, .end = NullPosition };
+
+    if (parser->options.skeleton) {
+        rbs_range_t overloads_range;
+        if (skip_method_overloads(parser, accept_overload, &overloading, &overloading_range, &overloads_range)) {
+            if (!rbs_null_range_p(overloads_range)) {
+                rbs_node_t *lazy_overloads = (rbs_node_t *) rbs_ast_members_method_definition_lazy_overloads_new(ALLOCATOR(), RBS_RANGE_LEX2AST(overloads_range), parser_typevar_symbols(parser), !instance_only);
+                rbs_node_list_append(overloads, lazy_overloads);
+            }
+            member_range.end = parser->current_token.range.end;
+            loop = false;
+        }
+    }
+
     while (loop) {
-        rbs_node_list_t *annotations = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *annotations = rbs_node_list_empty();
         rbs_position_t overload_annot_pos = NullPosition;
 
         rbs_range_t overload_range;
         overload_range.start = parser->current_token.range.start;
 
         if (parser->next_token.type == tANNOTATION) {
-            CHECK_PARSE(parse_annotations(parser, annotations, &overload_annot_pos));
+            CHECK_PARSE(parse_annotations(parser, &annotations, &overload_annot_pos));
         }
 
         switch (parser->next_token.type) {
@@ -2049,6 +2373,7 @@ static bool parse_member_def(rbs_parser_t *parser, bool instance_only, bool acce
             CHECK_PARSE(rbs_parse_method_type(parser, &method_type, false, !instance_only));
 
             overload_range.end = parser->current_token.range.end;
+            lazy_range.end = overload_range.end;
             rbs_node_t *overload = (rbs_node_t *) rbs_ast_members_method_definition_overload_new(ALLOCATOR(), RBS_RANGE_LEX2AST(overload_range), annotations, (rbs_node_t *) method_type);
             rbs_node_list_append(overloads, overload);
             member_range.end = parser->current_token.range.end;
@@ -2080,6 +2405,12 @@ static bool parse_member_def(rbs_parser_t *parser, bool instance_only, bool acce
         }
     }
 
+    if (parser->options.lazy_overloads && !parser->options.skeleton && !rbs_null_position_p(lazy_range.end)) {
+        rbs_node_t *lazy_overloads = (rbs_node_t *) rbs_ast_members_method_definition_lazy_overloads_new(ALLOCATOR(), RBS_RANGE_LEX2AST(lazy_range), parser_typevar_symbols(parser), !instance_only);
+        overloads = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_append(overloads, lazy_overloads);
+    }
+
     CHECK_PARSE(parser_pop_typevar_table(parser));
 
     enum rbs_method_definition_kind k;
@@ -2109,6 +2440,44 @@ static bool parse_member_def(rbs_parser_t *parser, bool instance_only, bool acce
     return true;
 }
 
+/*
+  method_overloads ::= {} overload `|` ... `|` overload <EOF>
+
+  overload ::= annotations method_type
+*/
+bool rbs_parse_method_overloads(rbs_parser_t *parser, bool classish_allowed, rbs_node_list_t **overloads) {
+    *overloads = rbs_node_list_new(ALLOCATOR());
+
+    while (true) {
+        rbs_node_list_t *annotations = rbs_node_list_empty();
+        rbs_position_t overload_annot_pos = NullPosition;
+
+        rbs_range_t overload_range;
+        overload_range.start = parser->current_token.range.start;
+
+        if (parser->next_token.type == tANNOTATION) {
+            CHECK_PARSE(parse_annotations(parser, &annotations, &overload_annot_pos));
+        }
+
+        rbs_method_type_t *method_type = NULL;
+        CHECK_PARSE(rbs_parse_method_type(parser, &method_type, false, classish_allowed));
+
+        overload_range.end = parser->current_token.range.end;
+        rbs_node_t *overload = (rbs_node_t *) rbs_ast_members_method_definition_overload_new(ALLOCATOR(), RBS_RANGE_LEX2AST(overload_range), annotations, (rbs_node_t *) method_type);
+        rbs_node_list_append(*overloads, overload);
+
+        if (parser->next_token.type == pBAR) {
+            rbs_parser_advance(parser);
+        } else {
+            break;
+        }
+    }
+
+    ADVANCE_ASSERT(parser, pEOF);
+
+    return true;
+}
+
 /**
  * class_instance_name ::= {} <class_name>
  *                       | {} class_name `[` type args <`]`>
@@ -2116,7 +2485,7 @@ static bool parse_member_def(rbs_parser_t *parser, bool instance_only, bool acce
  * @param kind
  * */
 RBS_NODISCARD
-static bool class_instance_name(rbs_parser_t *parser, TypeNameKind kind, rbs_node_list_t *args, rbs_range_t *name_range, rbs_range_t *args_range, rbs_type_name_t **name, bool classish_allowed) {
+static bool class_instance_name(rbs_parser_t *parser, TypeNameKind kind, rbs_node_list_t **args, rbs_range_t *name_range, rbs_range_t *args_range, rbs_type_name_t **name, bool classish_allowed) {
     rbs_parser_advance(parser);
 
     rbs_type_name_t *type_name = NULL;
@@ -2177,14 +2546,14 @@ static bool parse_mixin_member(rbs_parser_t *parser, bool from_interface, rbs_po
 
     rbs_parser_push_typevar_table(parser, reset_typevar_scope);
 
-    rbs_node_list_t *args = rbs_node_list_new(ALLOCATOR());
+    rbs_node_list_t *args = rbs_node_list_empty();
     rbs_range_t name_range;
     rbs_range_t args_range = NULL_RANGE;
     rbs_type_name_t *name = NULL;
     CHECK_PARSE(class_instance_name(
         parser,
         from_interface ? INTERFACE_NAME : (TypeNameKind) (INTERFACE_NAME | CLASS_NAME),
-        args,
+        &args,
         &name_range,
         &args_range,
         &name,
@@ -2200,7 +2569,7 @@ static bool parse_mixin_member(rbs_parser_t *parser, bool from_interface, rbs_po
     rbs_location_range keyword_rg = RBS_RANGE_LEX2AST(keyword_range);
     rbs_location_range args_rg = RBS_RANGE_LEX2AST(args_range);
 
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
     switch (type) {
     case kINCLUDE: {
         rbs_ast_members_include_t *include_member = rbs_ast_members_include_new(ALLOCATOR(), loc, name, args, annotations, comment, name_rg, keyword_rg);
@@ -2241,7 +2610,7 @@ static bool parse_alias_member(rbs_parser_t *parser, bool instance_only, rbs_pos
     rbs_range_t keyword_range = parser->current_token.range;
 
     comment_pos = rbs_nonnull_pos_or(comment_pos, member_range.start);
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     enum rbs_alias_kind kind;
     rbs_ast_symbol_t *new_name, *old_name;
@@ -2295,7 +2664,7 @@ static bool parse_variable_member(rbs_parser_t *parser, rbs_position_t comment_p
     rbs_range_t member_range;
     member_range.start = parser->current_token.range.start;
     comment_pos = rbs_nonnull_pos_or(comment_pos, member_range.start);
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     switch (parser->current_token.type) {
     case tAIDENT:
@@ -2308,7 +2677,7 @@ static bool parse_variable_member(rbs_parser_t *parser, rbs_position_t comment_p
         rbs_range_t colon_range = parser->current_token.range;
 
         rbs_node_t *type;
-        CHECK_PARSE(rbs_parse_type(parser, &type, false, true, true));
+        CHECK_PARSE(parse_member_type(parser, &type, true, true));
         member_range.end = parser->current_token.range.end;
 
         rbs_location_range loc = RBS_RANGE_LEX2AST(member_range);
@@ -2328,7 +2697,7 @@ static bool parse_variable_member(rbs_parser_t *parser, rbs_position_t comment_p
         rbs_parser_push_typevar_table(parser, true);
 
         rbs_node_t *type;
-        CHECK_PARSE(rbs_parse_type(parser, &type, false, false, true));
+        CHECK_PARSE(parse_member_type(parser, &type, false, true));
 
         CHECK_PARSE(parser_pop_typevar_table(parser));
 
@@ -2364,7 +2733,7 @@ static bool parse_variable_member(rbs_parser_t *parser, rbs_position_t comment_p
         rbs_parser_push_typevar_table(parser, true);
 
         rbs_node_t *type;
-        CHECK_PARSE(rbs_parse_type(parser, &type, false, true, true));
+        CHECK_PARSE(parse_member_type(parser, &type, true, true));
 
         CHECK_PARSE(parser_pop_typevar_table(parser));
 
@@ -2433,7 +2802,7 @@ static bool parse_attribute_member(rbs_parser_t *parser, rbs_position_t comment_
 
     member_range.start = parser->current_token.range.start;
     comment_pos = rbs_nonnull_pos_or(comment_pos, member_range.start);
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     rbs_range_t visibility_range;
     enum rbs_attribute_visibility visibility;
@@ -2496,7 +2865,7 @@ static bool parse_attribute_member(rbs_parser_t *parser, rbs_position_t comment_
     rbs_parser_push_typevar_table(parser, is_kind == SINGLETON_KIND);
 
     rbs_node_t *type;
-    CHECK_PARSE(rbs_parse_type(parser, &type, false, true, true));
+    CHECK_PARSE(parse_member_type(parser, &type, true, true));
 
     CHECK_PARSE(parser_pop_typevar_table(parser));
 
@@ -2549,50 +2918,201 @@ static bool parse_attribute_member(rbs_parser_t *parser, rbs_position_t comment_
     }
 }
 
-/*
-  interface_members ::= {} ...<interface_member> kEND
+static bool member_sync_token_p(enum RBSTokenType type) {
+    switch (type) {
+    case kDEF:
+    case kINCLUDE:
+    case kEXTEND:
+    case kPREPEND:
+    case kALIAS:
+    case kATTRREADER:
+    case kATTRWRITER:
+    case kATTRACCESSOR:
+    case kPUBLIC:
+    case kPRIVATE:
+    case kCLASS:
+    case kMODULE:
+    case kINTERFACE:
+    case kTYPE:
+    case kEND:
+    case tAIDENT:
+    case tA2IDENT:
+    case tUIDENT:
+    case tANNOTATION:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool decl_sync_token_p(enum RBSTokenType type) {
+    switch (type) {
+    case kCLASS:
+    case kMODULE:
+    case kINTERFACE:
+    case kTYPE:
+    case tUIDENT:
+    case tGIDENT:
+    case pCOLON2:
+    case tANNOTATION:
+    case kUSE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * Returns true if only spaces come before `token` on its line.
+ * */
+static bool parser_line_start_p(rbs_parser_t *parser, rbs_token_t token) {
+    const char *start = parser->lexer->string.start;
+    for (const char *p = start + token.range.start.byte_pos; p > start; p--) {
+        if (p[-1] == '\n') return true;
+        if (p[-1] != ' ' && p[-1] != '\t') return false;
+    }
+    return true;
+}
+
+/**
+ * Moves the error of the parser to the end of `errors`.
+ * */
+static void parser_record_error(rbs_parser_t *parser) {
+    if (parser->last_error == NULL) {
+        parser->errors = parser->error;
+    } else {
+        parser->last_error->next = parser->error;
+    }
+    parser->last_error = parser->error;
+    parser->error = NULL;
+}
+
+/**
+ * Recovers from the error of a member or a declaration starting at `first`, if `recover_errors` is set.
+ *
+ * The error is moved to the `errors` of the parser, the type variables are set back to `vars`, and the tokens are skipped
+ * up to a token at the start of a line that `sync_p` accepts. Returns false, leaving the error as it is, otherwise.
+ * */
+static bool recover_from_error(rbs_parser_t *parser, rbs_token_t first, id_table *vars, bool (*sync_p)(enum RBSTokenType)) {
+    if (!parser->options.recover_errors) {
+        return false;
+    }
+
+    rbs_token_t error_token = parser->error->token;
+    parser_record_error(parser);
+    parser->vars = vars;
 
+    if (parser->next_token.range.start.byte_pos == first.range.start.byte_pos && parser->next_token.type == first.type) {
+        // Nothing is consumed yet: skip the first token, so that the next attempt doesn't fail at it again.
+        rbs_parser_advance(parser);
+    } else if (
+        error_token.range.start.byte_pos == parser->current_token.range.start.byte_pos && error_token.range.start.byte_pos > first.range.start.byte_pos &&
+        sync_p(error_token.type) && parser_line_start_p(parser, error_token)
+    ) {
+        // The token that doesn't fit starts the next member, like the `end` after `def foo: () ->`.
+        // Lex it again, so that the parser reads it next.
+        rbs_lexer_resume(parser->lexer, (rbs_lexer_checkpoint_t) { .position = error_token.range.start, .first_token_of_line = false });
+        parser->next_token = NullToken;
+        parser->next_token2 = NullToken;
+        parser->next_token3 = NullToken;
+        rbs_token_t current_token = parser->current_token;
+        rbs_parser_advance(parser);
+        rbs_parser_advance(parser);
+        rbs_parser_advance(parser);
+        parser->current_token = current_token;
+        return true;
+    }
+
+    while (parser->next_token.type != pEOF) {
+        if (sync_p(parser->next_token.type) && parser_line_start_p(parser, parser->next_token)) {
+            break;
+        }
+        rbs_parser_advance(parser);
+    }
+
+    return true;
+}
+
+/**
+ * Reads the `end` of the members of a class, module, or interface.
+ *
+ * With `recover_errors`, the declaration ends at the end of the input if the `end` is missing.
+ * The members have recorded the error already.
+ * */
+RBS_NODISCARD
+static bool parse_members_end(rbs_parser_t *parser, rbs_range_t *end_range) {
+    rbs_parser_advance(parser);
+
+    if (parser->current_token.type != pEOF || !parser->options.recover_errors) {
+        ASSERT_TOKEN(parser, kEND);
+    }
+
+    *end_range = parser->current_token.range;
+    return true;
+}
+
+/*
   interface_member ::= def_member     (instance method only && no overloading)
                      | mixin_member   (interface only)
                      | alias_member   (instance only)
 */
 RBS_NODISCARD
+static bool parse_interface_member(rbs_parser_t *parser, rbs_node_t **member) {
+    rbs_node_list_t *annotations = rbs_node_list_empty();
+    rbs_position_t annot_pos = NullPosition;
+
+    CHECK_PARSE(parse_annotations(parser, &annotations, &annot_pos));
+    rbs_parser_advance(parser);
+
+    switch (parser->current_token.type) {
+    case kDEF: {
+        rbs_ast_members_method_definition_t *method_definition = NULL;
+        CHECK_PARSE(parse_member_def(parser, true, true, annot_pos, annotations, &method_definition));
+        *member = (rbs_node_t *) method_definition;
+        return true;
+    }
+
+    case kINCLUDE:
+    case kEXTEND:
+    case kPREPEND: {
+        CHECK_PARSE(parse_mixin_member(parser, true, annot_pos, annotations, member));
+        return true;
+    }
+
+    case kALIAS: {
+        rbs_ast_members_alias_t *alias_member = NULL;
+        CHECK_PARSE(parse_alias_member(parser, true, annot_pos, annotations, &alias_member));
+        *member = (rbs_node_t *) alias_member;
+        return true;
+    }
+
+    default:
+        rbs_parser_set_error(parser, parser->current_token, true, "unexpected token for interface declaration member");
+        return false;
+    }
+}
+
+/*
+  interface_members ::= {} ...<interface_member> kEND
+*/
+RBS_NODISCARD
 static bool parse_interface_members(rbs_parser_t *parser, rbs_node_list_t **members) {
     *members = rbs_node_list_new(ALLOCATOR());
 
+    rbs_error_t *last_error = parser->last_error;
+
     while (parser->next_token.type != kEND) {
-        rbs_node_list_t *annotations = rbs_node_list_new(ALLOCATOR());
-        rbs_position_t annot_pos = NullPosition;
+        // A missing `end` is reported as the strict parser does, by the member that fails at the end of the input.
+        // It is skipped if the members already had an error, which skipped the rest of the input.
+        if (parser->options.recover_errors && parser->next_token.type == pEOF && parser->last_error != last_error) break;
 
-        CHECK_PARSE(parse_annotations(parser, annotations, &annot_pos));
-        rbs_parser_advance(parser);
+        rbs_token_t first = parser->next_token;
+        id_table *vars = parser->vars;
 
         rbs_node_t *member;
-        switch (parser->current_token.type) {
-        case kDEF: {
-            rbs_ast_members_method_definition_t *method_definition = NULL;
-            CHECK_PARSE(parse_member_def(parser, true, true, annot_pos, annotations, &method_definition));
-            member = (rbs_node_t *) method_definition;
-            break;
-        }
-
-        case kINCLUDE:
-        case kEXTEND:
-        case kPREPEND: {
-            CHECK_PARSE(parse_mixin_member(parser, true, annot_pos, annotations, &member));
-            break;
-        }
-
-        case kALIAS: {
-            rbs_ast_members_alias_t *alias_member = NULL;
-            CHECK_PARSE(parse_alias_member(parser, true, annot_pos, annotations, &alias_member));
-            member = (rbs_node_t *) alias_member;
-            break;
-        }
-
-        default:
-            rbs_parser_set_error(parser, parser->current_token, true, "unexpected token for interface declaration member");
-            return false;
+        if (!parse_interface_member(parser, &member)) {
+            CHECK_PARSE(recover_from_error(parser, first, vars, member_sync_token_p));
+            continue;
         }
 
         rbs_node_list_append(*members, member);
@@ -2627,14 +3147,14 @@ static bool parse_interface_decl(rbs_parser_t *parser, rbs_position_t comment_po
     rbs_node_list_t *members = NULL;
     CHECK_PARSE(parse_interface_members(parser, &members));
 
-    ADVANCE_ASSERT(parser, kEND);
-    rbs_range_t end_range = parser->current_token.range;
+    rbs_range_t end_range;
+    CHECK_PARSE(parse_members_end(parser, &end_range));
     member_range.end = end_range.end;
 
     CHECK_PARSE(parser_pop_typevar_table(parser));
 
     rbs_location_range loc = RBS_RANGE_LEX2AST(member_range);
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     *interface_decl = rbs_ast_declarations_interface_new(ALLOCATOR(), loc, name, type_params, members, annotations, comment, RBS_RANGE_LEX2AST(keyword_range), RBS_RANGE_LEX2AST(name_range), RBS_RANGE_LEX2AST(end_range));
     (*interface_decl)->type_params_range = RBS_RANGE_LEX2AST(type_params_range);
@@ -2661,12 +3181,12 @@ static bool parse_module_self_types(rbs_parser_t *parser, rbs_node_list_t *array
         CHECK_PARSE(parse_type_name(parser, (TypeNameKind) (CLASS_NAME | INTERFACE_NAME), &name_range, &module_name));
         self_range.end = name_range.end;
 
-        rbs_node_list_t *args = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *args = rbs_node_list_empty();
         rbs_range_t args_range = NULL_RANGE;
         if (parser->next_token.type == pLBRACKET) {
             rbs_parser_advance(parser);
             args_range.start = parser->current_token.range.start;
-            CHECK_PARSE(parse_type_list(parser, pRBRACKET, args, true, false, false));
+            CHECK_PARSE(parse_type_list(parser, pRBRACKET, &args, true, false, false));
             rbs_parser_advance(parser);
             self_range.end = args_range.end = parser->current_token.range.end;
         }
@@ -2691,8 +3211,6 @@ RBS_NODISCARD
 static bool parse_nested_decl(rbs_parser_t *parser, const char *nested_in, rbs_position_t annot_pos, rbs_node_list_t *annotations, rbs_node_t **decl);
 
 /*
-  module_members ::= {} ...<module_member> kEND
-
   module_member ::= def_member
                   | variable_member
                   | mixin_member
@@ -2702,80 +3220,102 @@ static bool parse_nested_decl(rbs_parser_t *parser, const char *nested_in, rbs_p
                   | `private`
 */
 RBS_NODISCARD
-static bool parse_module_members(rbs_parser_t *parser, rbs_node_list_t **members) {
-    *members = rbs_node_list_new(ALLOCATOR());
+static bool parse_module_member(rbs_parser_t *parser, rbs_node_t **member) {
+    rbs_node_list_t *annotations = rbs_node_list_empty();
+    rbs_position_t annot_pos;
+    CHECK_PARSE(parse_annotations(parser, &annotations, &annot_pos));
 
-    while (parser->next_token.type != kEND) {
-        rbs_node_list_t *annotations = rbs_node_list_new(ALLOCATOR());
-        rbs_position_t annot_pos;
-        CHECK_PARSE(parse_annotations(parser, annotations, &annot_pos));
+    rbs_parser_advance(parser);
 
-        rbs_parser_advance(parser);
+    switch (parser->current_token.type) {
+    case kDEF: {
+        rbs_ast_members_method_definition_t *method_definition;
+        CHECK_PARSE(parse_member_def(parser, false, true, annot_pos, annotations, &method_definition));
+        *member = (rbs_node_t *) method_definition;
+        break;
+    }
 
-        rbs_node_t *member;
-        switch (parser->current_token.type) {
-        case kDEF: {
-            rbs_ast_members_method_definition_t *method_definition;
-            CHECK_PARSE(parse_member_def(parser, false, true, annot_pos, annotations, &method_definition));
-            member = (rbs_node_t *) method_definition;
-            break;
-        }
+    case kINCLUDE:
+    case kEXTEND:
+    case kPREPEND: {
+        CHECK_PARSE(parse_mixin_member(parser, false, annot_pos, annotations, member));
+        break;
+    }
+    case kALIAS: {
+        rbs_ast_members_alias_t *alias_member = NULL;
+        CHECK_PARSE(parse_alias_member(parser, false, annot_pos, annotations, &alias_member));
+        *member = (rbs_node_t *) alias_member;
+        break;
+    }
+    case tAIDENT:
+    case tA2IDENT:
+    case kATRBS:
+    case kSELF: {
+        CHECK_PARSE(parse_variable_member(parser, annot_pos, annotations, member));
+        break;
+    }
 
-        case kINCLUDE:
-        case kEXTEND:
-        case kPREPEND: {
-            CHECK_PARSE(parse_mixin_member(parser, false, annot_pos, annotations, &member));
-            break;
-        }
-        case kALIAS: {
-            rbs_ast_members_alias_t *alias_member = NULL;
-            CHECK_PARSE(parse_alias_member(parser, false, annot_pos, annotations, &alias_member));
-            member = (rbs_node_t *) alias_member;
-            break;
-        }
-        case tAIDENT:
-        case tA2IDENT:
-        case kATRBS:
-        case kSELF: {
-            CHECK_PARSE(parse_variable_member(parser, annot_pos, annotations, &member));
-            break;
-        }
+    case kATTRREADER:
+    case kATTRWRITER:
+    case kATTRACCESSOR: {
+        CHECK_PARSE(parse_attribute_member(parser, annot_pos, annotations, member));
+        break;
+    }
 
-        case kATTRREADER:
-        case kATTRWRITER:
-        case kATTRACCESSOR: {
-            CHECK_PARSE(parse_attribute_member(parser, annot_pos, annotations, &member));
-            break;
+    case kPUBLIC:
+    case kPRIVATE:
+        if (POSITION_LINE(parser->next_token.range.start) == POSITION_LINE(parser->current_token.range.start)) {
+            switch (parser->next_token.type) {
+            case kDEF: {
+                rbs_ast_members_method_definition_t *method_definition = NULL;
+                CHECK_PARSE(parse_member_def(parser, false, true, annot_pos, annotations, &method_definition));
+                *member = (rbs_node_t *) method_definition;
+                break;
+            }
+            case kATTRREADER:
+            case kATTRWRITER:
+            case kATTRACCESSOR: {
+                CHECK_PARSE(parse_attribute_member(parser, annot_pos, annotations, member));
+                break;
+            }
+            default:
+                rbs_parser_set_error(parser, parser->next_token, true, "method or attribute definition is expected after visibility modifier");
+                return false;
+            }
+        } else {
+            CHECK_PARSE(parse_visibility_member(parser, annotations, member));
         }
+        break;
 
-        case kPUBLIC:
-        case kPRIVATE:
-            if (parser->next_token.range.start.line == parser->current_token.range.start.line) {
-                switch (parser->next_token.type) {
-                case kDEF: {
-                    rbs_ast_members_method_definition_t *method_definition = NULL;
-                    CHECK_PARSE(parse_member_def(parser, false, true, annot_pos, annotations, &method_definition));
-                    member = (rbs_node_t *) method_definition;
-                    break;
-                }
-                case kATTRREADER:
-                case kATTRWRITER:
-                case kATTRACCESSOR: {
-                    CHECK_PARSE(parse_attribute_member(parser, annot_pos, annotations, &member));
-                    break;
-                }
-                default:
-                    rbs_parser_set_error(parser, parser->next_token, true, "method or attribute definition is expected after visibility modifier");
-                    return false;
-                }
-            } else {
-                CHECK_PARSE(parse_visibility_member(parser, annotations, &member));
-            }
-            break;
+    default:
+        CHECK_PARSE(parse_nested_decl(parser, "module", annot_pos, annotations, member));
+        break;
+    }
 
-        default:
-            CHECK_PARSE(parse_nested_decl(parser, "module", annot_pos, annotations, &member));
-            break;
+    return true;
+}
+
+/*
+  module_members ::= {} ...<module_member> kEND
+*/
+RBS_NODISCARD
+static bool parse_module_members(rbs_parser_t *parser, rbs_node_list_t **members) {
+    *members = rbs_node_list_new(ALLOCATOR());
+
+    rbs_error_t *last_error = parser->last_error;
+
+    while (parser->next_token.type != kEND) {
+        // A missing `end` is reported as the strict parser does, by the member that fails at the end of the input.
+        // It is skipped if the members already had an error, which skipped the rest of the input.
+        if (parser->options.recover_errors && parser->next_token.type == pEOF && parser->last_error != last_error) break;
+
+        rbs_token_t first = parser->next_token;
+        id_table *vars = parser->vars;
+
+        rbs_node_t *member;
+        if (!parse_module_member(parser, &member)) {
+            CHECK_PARSE(recover_from_error(parser, first, vars, member_sync_token_p));
+            continue;
         }
 
         rbs_node_list_append(*members, member);
@@ -2816,9 +3356,9 @@ static bool parse_module_decl0(rbs_parser_t *parser, rbs_range_t keyword_range,
     rbs_node_list_t *members = NULL;
     CHECK_PARSE(parse_module_members(parser, &members));
 
-    ADVANCE_ASSERT(parser, kEND);
-    rbs_range_t end_range = parser->current_token.range;
-    decl_range.end = parser->current_token.range.end;
+    rbs_range_t end_range;
+    CHECK_PARSE(parse_members_end(parser, &end_range));
+    decl_range.end = end_range.end;
 
     CHECK_PARSE(parser_pop_typevar_table(parser));
 
@@ -2841,7 +3381,7 @@ static bool parse_module_decl(rbs_parser_t *parser, rbs_position_t comment_pos,
     rbs_range_t keyword_range = parser->current_token.range;
 
     comment_pos = rbs_nonnull_pos_or(comment_pos, parser->current_token.range.start);
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     rbs_parser_advance(parser);
 
@@ -2887,10 +3427,10 @@ static bool parse_class_decl_super(rbs_parser_t *parser, rbs_range_t *lt_range,
         rbs_range_t super_range;
         super_range.start = parser->next_token.range.start;
 
-        rbs_node_list_t *args = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *args = rbs_node_list_empty();
         rbs_type_name_t *name = NULL;
         rbs_range_t name_range, args_range;
-        CHECK_PARSE(class_instance_name(parser, CLASS_NAME, args, &name_range, &args_range, &name, false));
+        CHECK_PARSE(class_instance_name(parser, CLASS_NAME, &args, &name_range, &args_range, &name, false));
 
         super_range.end = parser->current_token.range.end;
 
@@ -2925,9 +3465,8 @@ static bool parse_class_decl0(rbs_parser_t *parser, rbs_range_t keyword_range, r
     rbs_node_list_t *members = NULL;
     CHECK_PARSE(parse_module_members(parser, &members));
 
-    ADVANCE_ASSERT(parser, kEND);
-
-    rbs_range_t end_range = parser->current_token.range;
+    rbs_range_t end_range;
+    CHECK_PARSE(parse_members_end(parser, &end_range));
 
     decl_range.end = end_range.end;
 
@@ -2951,7 +3490,7 @@ static bool parse_class_decl(rbs_parser_t *parser, rbs_position_t comment_pos, r
     rbs_range_t keyword_range = parser->current_token.range;
 
     comment_pos = rbs_nonnull_pos_or(comment_pos, parser->current_token.range.start);
-    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, comment_pos.line);
+    rbs_ast_comment_t *comment = rbs_parser_get_comment(parser, POSITION_LINE(comment_pos));
 
     rbs_parser_advance(parser);
     rbs_range_t class_name_range;
@@ -3045,10 +3584,10 @@ static bool parse_nested_decl(rbs_parser_t *parser, const char *nested_in, rbs_p
 
 RBS_NODISCARD
 static bool parse_decl(rbs_parser_t *parser, rbs_node_t **decl) {
-    rbs_node_list_t *annotations = rbs_node_list_new(ALLOCATOR());
+    rbs_node_list_t *annotations = rbs_node_list_empty();
     rbs_position_t annot_pos = NullPosition;
 
-    CHECK_PARSE(parse_annotations(parser, annotations, &annot_pos));
+    CHECK_PARSE(parse_annotations(parser, &annotations, &annot_pos));
     rbs_parser_advance(parser);
 
     switch (parser->current_token.type) {
@@ -3274,6 +3813,8 @@ static rbs_ast_comment_t *parse_comment_lines(rbs_parser_t *parser, rbs_comment_
         rbs_buffer_append_cstr(ALLOCATOR(), &rbs_buffer, "\n");
     }
 
+    rbs_buffer_shrink_to_fit(ALLOCATOR(), &rbs_buffer);
+
     return rbs_ast_comment_new(
         ALLOCATOR(),
         (rbs_location_range) {
@@ -3291,18 +3832,18 @@ static rbs_comment_t *comment_get_comment(rbs_comment_t *com, int line) {
         return NULL;
     }
 
-    if (com->end.line < line) {
+    if (com->end_line < line) {
         return NULL;
     }
 
-    if (com->end.line == line) {
+    if (com->end_line == line) {
         return com;
     }
 
     return comment_get_comment(com->next_comment, line);
 }
 
-static void comment_insert_new_line(rbs_allocator_t *allocator, rbs_comment_t *com, rbs_token_t comment_token) {
+static void comment_insert_new_line(rbs_allocator_t *allocator, rbs_comment_t *com, rbs_token_t comment_token, int line) {
     if (com->line_tokens_count == com->line_tokens_capacity) {
         size_t old_size = com->line_tokens_capacity;
         size_t new_size = old_size * 2;
@@ -3319,9 +3860,10 @@ static void comment_insert_new_line(rbs_allocator_t *allocator, rbs_comment_t *c
 
     com->line_tokens[com->line_tokens_count++] = comment_token;
     com->end = comment_token.range.end;
+    com->end_line = line;
 }
 
-static rbs_comment_t *alloc_comment(rbs_allocator_t *allocator, rbs_token_t comment_token, rbs_comment_t *last_comment) {
+static rbs_comment_t *alloc_comment(rbs_allocator_t *allocator, rbs_token_t comment_token, int line, rbs_comment_t *last_comment) {
     rbs_comment_t *new_comment = rbs_allocator_alloc(allocator, rbs_comment_t);
 
     size_t initial_line_capacity = 10;
@@ -3332,6 +3874,7 @@ static rbs_comment_t *alloc_comment(rbs_allocator_t *allocator, rbs_token_t comm
     *new_comment = (rbs_comment_t) {
         .start = comment_token.range.start,
         .end = comment_token.range.end,
+        .end_line = line,
 
         .line_tokens_capacity = initial_line_capacity,
         .line_tokens_count = 1,
@@ -3347,14 +3890,14 @@ static rbs_comment_t *alloc_comment(rbs_allocator_t *allocator, rbs_token_t comm
  * Insert new comment line token.
  * */
 static void insert_comment_line(rbs_parser_t *parser, rbs_token_t tok) {
-    int prev_line = tok.range.start.line - 1;
+    int line = POSITION_LINE(tok.range.start);
 
-    rbs_comment_t *com = comment_get_comment(parser->last_comment, prev_line);
+    rbs_comment_t *com = comment_get_comment(parser->last_comment, line - 1);
 
     if (com) {
-        comment_insert_new_line(ALLOCATOR(), com, tok);
+        comment_insert_new_line(ALLOCATOR(), com, tok, line);
     } else {
-        parser->last_comment = alloc_comment(ALLOCATOR(), tok, parser->last_comment);
+        parser->last_comment = alloc_comment(ALLOCATOR(), tok, line, parser->last_comment);
     }
 }
 
@@ -3366,20 +3909,140 @@ bool rbs_parse_signature(rbs_parser_t *parser, rbs_signature_t **signature) {
     rbs_node_list_t *decls = rbs_node_list_new(ALLOCATOR());
 
     while (parser->next_token.type == kUSE) {
+        rbs_token_t first = parser->next_token;
+
         rbs_ast_directives_use_t *use_node;
-        CHECK_PARSE(parse_use_directive(parser, &use_node));
+        if (!parse_use_directive(parser, &use_node)) {
+            CHECK_PARSE(recover_from_error(parser, first, parser->vars, decl_sync_token_p));
+            continue;
+        }
 
         rbs_node_list_append(dirs, (rbs_node_t *) use_node);
     }
 
     while (parser->next_token.type != pEOF) {
+        rbs_token_t first = parser->next_token;
+        id_table *vars = parser->vars;
+
         rbs_node_t *decl = NULL;
-        CHECK_PARSE(parse_decl(parser, &decl));
+        if (!parse_decl(parser, &decl)) {
+            CHECK_PARSE(recover_from_error(parser, first, vars, decl_sync_token_p));
+            continue;
+        }
         rbs_node_list_append(decls, decl);
     }
 
     signature_range.end = parser->current_token.range.end;
     *signature = rbs_signature_new(ALLOCATOR(), RBS_RANGE_LEX2AST(signature_range), dirs, decls);
+
+    parser->error = parser->errors;
+    return true;
+}
+
+bool rbs_parse_signature_skeleton(rbs_parser_t *parser, rbs_signature_t **signature) {
+    parser->options.skeleton = true;
+    return rbs_parse_signature(parser, signature);
+}
+
+/**
+ * Returns the number of leading declarations of `previous` that the edit cannot change.
+ *
+ * A declaration is kept when the next declaration also ends before the edit. That declaration is parsed again, and
+ * the lookahead tokens the parser needed to find the end of the kept one are in it.
+ * */
+static size_t reusable_declaration_count(rbs_parser_t *parser, rbs_signature_t *previous, rbs_lexer_edit_t edit) {
+    // A lone backtick lexes as an operator only when no backtick follows it, so inserting one changes a token that
+    // may be anywhere before the edit.
+    const char *inserted = parser->lexer->string.start + edit.start_byte;
+    if (memchr(inserted, '`', (size_t) (edit.new_end_byte - edit.start_byte)) != NULL) {
+        return 0;
+    }
+
+    rbs_node_list_t *decls = previous->declarations;
+
+    size_t count = 0;
+    while (count < decls->length && decls->items[count]->location.end_byte <= edit.start_byte) {
+        count++;
+    }
+
+    return count > 0 ? count - 1 : 0;
+}
+
+bool rbs_parse_signature_incremental(rbs_parser_t *parser, rbs_signature_t *previous, rbs_lexer_edit_t edit, rbs_signature_t **signature) {
+    rbs_node_list_t *dirs;
+    rbs_node_list_t *olds = previous->declarations;
+    rbs_node_list_t *decls = rbs_node_list_new_with_capacity(ALLOCATOR(), olds->length);
+    size_t old = 0;
+
+    size_t reused = reusable_declaration_count(parser, previous, edit);
+
+    if (reused == 0) {
+        dirs = rbs_node_list_new(ALLOCATOR());
+
+        while (parser->next_token.type == kUSE) {
+            rbs_ast_directives_use_t *use_node;
+            CHECK_PARSE(parse_use_directive(parser, &use_node));
+
+            rbs_node_list_append(dirs, (rbs_node_t *) use_node);
+        }
+    } else {
+        dirs = previous->directives;
+
+        for (; old < reused; old++) {
+            rbs_node_list_append(decls, olds->items[old]);
+        }
+        rbs_location_range last = decls->items[decls->length - 1]->location;
+
+        rbs_parser_resume(parser, (rbs_lexer_checkpoint_t) {
+            .position = { .byte_pos = last.end_byte, .char_pos = last.end_char },
+            .first_token_of_line = false,
+        });
+    }
+
+    int byte_delta = edit.new_end_byte - edit.old_end_byte;
+
+    while (parser->next_token.type != pEOF) {
+        rbs_node_t *decl = NULL;
+        CHECK_PARSE(parse_decl(parser, &decl));
+        rbs_node_list_append(decls, decl);
+
+        // The text after a declaration that ends past the edit is the same as before. If an old declaration ended at
+        // the same place, the parser continues from there as it did before, and gives the same declarations.
+        int old_end_byte = decl->location.end_byte - byte_delta;
+        if (old_end_byte < edit.old_end_byte) continue;
+
+        while (old < olds->length && olds->items[old]->location.end_byte < old_end_byte) {
+            old++;
+        }
+
+        if (old < olds->length && olds->items[old]->location.end_byte == old_end_byte) {
+            int char_delta = decl->location.end_char - olds->items[old]->location.end_char;
+
+            for (old++; old < olds->length; old++) {
+                rbs_node_shift_locations(olds->items[old], char_delta, byte_delta);
+                rbs_node_list_append(decls, olds->items[old]);
+            }
+
+            rbs_location_range range = previous->base.location;
+            range.end_char += char_delta;
+            range.end_byte += byte_delta;
+            *signature = rbs_signature_new(ALLOCATOR(), range, dirs, decls);
+            parser->error = parser->errors;
+            return true;
+        }
+    }
+
+    rbs_location_range range = previous->base.location;
+    if (parser->current_token.type != NullType || reused == 0) {
+        range.end_char = parser->current_token.range.end.char_pos;
+        range.end_byte = parser->current_token.range.end.byte_pos;
+    } else {
+        // No declaration follows the reused ones.
+        range.end_char = decls->items[decls->length - 1]->location.end_char;
+        range.end_byte = decls->items[decls->length - 1]->location.end_byte;
+    }
+    *signature = rbs_signature_new(ALLOCATOR(), range, dirs, decls);
+    parser->error = parser->errors;
     return true;
 }
 
@@ -3494,6 +4157,42 @@ void rbs_parser_advance(rbs_parser_t *parser) {
     }
 }
 
+void rbs_parser_resume(rbs_parser_t *parser, rbs_lexer_checkpoint_t checkpoint) {
+    rbs_lexer_resume(parser->lexer, checkpoint);
+
+    parser->current_token = NullToken;
+    parser->next_token = NullToken;
+    parser->next_token2 = NullToken;
+    parser->next_token3 = NullToken;
+    parser->last_comment = NULL;
+
+    rbs_parser_advance(parser);
+    rbs_parser_advance(parser);
+    rbs_parser_advance(parser);
+}
+
+// Callers may give an `end_pos` past the end of the string -- the lexer used to stop at the NUL terminator there -- but
+// the lexer scans the input in blocks up to `end_pos`, so it must not go past the bytes that are actually there.
+static int rbs_lexer_clamp_end_pos(rbs_string_t string, int end_pos) {
+    size_t length = rbs_string_len(string);
+    return end_pos >= 0 && (size_t) end_pos > length ? (int) length : end_pos;
+}
+
+void rbs_parser_seek(rbs_parser_t *parser, rbs_lexer_checkpoint_t start, int end_pos) {
+    rbs_lexer_t *lexer = parser->lexer;
+    const uint8_t *bytes = (const uint8_t *) lexer->string.start;
+    int start_pos = start.position.byte_pos;
+    end_pos = rbs_lexer_clamp_end_pos(lexer->string, end_pos);
+
+    lexer->start_pos = start_pos;
+    lexer->end_pos = end_pos;
+    // The lexer can read a byte as a character if the text up to `start` is ASCII too -- the text it counted as many
+    // characters as bytes -- since it sets the character position to the byte position.
+    lexer->ascii_only = start.position.char_pos == start_pos && rbs_scan_ascii(bytes + start_pos, bytes + end_pos) == (size_t) (end_pos - start_pos);
+
+    rbs_parser_resume(parser, start);
+}
+
 void rbs_print_token(rbs_token_t tok) {
     printf(
         "%s char=%d...%d\n",
@@ -3525,12 +4224,11 @@ rbs_ast_comment_t *rbs_parser_get_comment(rbs_parser_t *parser, int subject_line
 
 rbs_lexer_t *rbs_lexer_new(rbs_allocator_t *allocator, rbs_string_t string, const rbs_encoding_t *encoding, int start_pos, int end_pos) {
     rbs_lexer_t *lexer = rbs_allocator_alloc(allocator, rbs_lexer_t);
+    end_pos = rbs_lexer_clamp_end_pos(string, end_pos);
 
     rbs_position_t start_position = (rbs_position_t) {
         .byte_pos = 0,
         .char_pos = 0,
-        .line = 1,
-        .column = 0,
     };
 
     *lexer = (rbs_lexer_t) {
@@ -3543,8 +4241,23 @@ rbs_lexer_t *rbs_lexer_new(rbs_allocator_t *allocator, rbs_string_t string, cons
         .current_character_bytes = 0,
         .current_code_point = '\0',
         .encoding = encoding,
+        .allocator = allocator,
+        .line_starts = NULL,
+        .line_count = 0,
     };
 
+    if (end_pos >= 0) {
+        const uint8_t *bytes = (const uint8_t *) string.start;
+        lexer->ascii_only = rbs_scan_ascii(bytes, bytes + end_pos) == (size_t) end_pos;
+    }
+
+    // A byte is a character in an input that is all ASCII, so the lexer can start at `start_pos` right away -- unless
+    // the walk below would stop short of it at a NUL byte.
+    if (lexer->ascii_only && start_pos >= 0 && start_pos <= end_pos && memchr(string.start, '\0', (size_t) start_pos) == NULL) {
+        lexer->current.byte_pos = start_pos;
+        lexer->current.char_pos = start_pos;
+    }
+
     unsigned int codepoint;
     size_t bytes;
 
@@ -3580,9 +4293,20 @@ rbs_parser_t *rbs_parser_new(rbs_string_t string, const rbs_encoding_t *encoding
 rbs_parser_t *rbs_parser_new_with_options(rbs_string_t string, const rbs_encoding_t *encoding, int start_pos, int end_pos, rbs_parser_options_t options) {
     rbs_allocator_t *allocator = rbs_allocator_init();
 
+    rbs_parser_t *parser = rbs_parser_new_with_allocator(allocator, string, encoding, start_pos, end_pos, options);
+    if (parser == NULL) {
+        rbs_allocator_free(allocator);
+        return NULL;
+    }
+
+    parser->owns_allocator = true;
+
+    return parser;
+}
+
+rbs_parser_t *rbs_parser_new_with_allocator(rbs_allocator_t *allocator, rbs_string_t string, const rbs_encoding_t *encoding, int start_pos, int end_pos, rbs_parser_options_t options) {
     rbs_lexer_t *lexer = rbs_lexer_new(allocator, string, encoding, start_pos, end_pos);
     if (lexer == NULL) {
-        rbs_allocator_free(allocator);
         return NULL;
     }
 
@@ -3601,7 +4325,10 @@ rbs_parser_t *rbs_parser_new_with_options(rbs_string_t string, const rbs_encodin
 
         .constant_pool = { 0 },
         .allocator = allocator,
+        .owns_allocator = false,
         .error = NULL,
+        .errors = NULL,
+        .last_error = NULL,
 
         .options = options,
     };
@@ -3633,9 +4360,16 @@ rbs_parser_t *rbs_parser_new_with_options(rbs_string_t string, const rbs_encodin
     return parser;
 }
 
+void rbs_parser_use_global_constant_pool(rbs_parser_t *parser, rbs_global_constant_pool_t *global) {
+    rbs_constant_pool_free(&parser->constant_pool);
+    rbs_constant_pool_init_global(&parser->constant_pool, global);
+}
+
 void rbs_parser_free(rbs_parser_t *parser) {
     rbs_constant_pool_free(&parser->constant_pool);
-    rbs_allocator_free(ALLOCATOR());
+    if (parser->owns_allocator) {
+        rbs_allocator_free(ALLOCATOR());
+    }
 }
 
 void rbs_parser_set_error(rbs_parser_t *parser, rbs_token_t tok, bool syntax_error, const char *fmt, ...) {
@@ -3659,13 +4393,14 @@ void rbs_parser_set_error(rbs_parser_t *parser, rbs_token_t tok, bool syntax_err
     parser->error->token = tok;
     parser->error->message = message;
     parser->error->syntax_error = syntax_error;
+    parser->error->next = NULL;
 }
 
 /*
   parse_method_overload ::= {} annotations <method_type>
  */
 RBS_NODISCARD
-static bool parse_method_overload(rbs_parser_t *parser, rbs_node_list_t *annotations, rbs_method_type_t **method_type) {
+static bool parse_method_overload(rbs_parser_t *parser, rbs_node_list_t **annotations, rbs_method_type_t **method_type) {
     rbs_position_t pos = NullPosition;
 
     if (!parse_annotations(parser, annotations, &pos)) {
@@ -3684,10 +4419,10 @@ static bool parse_method_overload(rbs_parser_t *parser, rbs_node_list_t *annotat
 RBS_NODISCARD
 static bool parse_inline_method_overloads(rbs_parser_t *parser, rbs_node_list_t *overloads, rbs_location_range_list_t *bar_locations, rbs_location_range *dot3_location) {
     while (true) {
-        rbs_node_list_t *annotations = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *annotations = rbs_node_list_empty();
         rbs_method_type_t *method_type = NULL;
 
-        if (!parse_method_overload(parser, annotations, &method_type)) {
+        if (!parse_method_overload(parser, &annotations, &method_type)) {
             return false;
         }
 
@@ -3780,10 +4515,10 @@ static bool parse_inline_leading_annotation(rbs_parser_t *parser, rbs_ast_ruby_a
         rbs_range_t colon_range = parser->next_token.range;
         rbs_parser_advance(parser);
 
-        rbs_node_list_t *annotations = rbs_node_list_new(ALLOCATOR());
+        rbs_node_list_t *annotations = rbs_node_list_empty();
         rbs_method_type_t *method_type = NULL;
 
-        if (!parse_method_overload(parser, annotations, &method_type)) {
+        if (!parse_method_overload(parser, &annotations, &method_type)) {
             return false;
         }
 
@@ -9,34 +9,24 @@
 
 #include "rbs/location.h"
 #include "rbs/util/rbs_assert.h"
-#include "rbs/util/rbs_buffer.h"
 
 #include <stdint.h>
-
-/**
- * State threaded through the recursive serializer: the arena the output buffer
- * grows in, the constant pool used to resolve interned ids, and the buffer
- * itself.
- */
-typedef struct {
-    rbs_allocator_t *allocator;
-    rbs_constant_pool_t *constant_pool;
-    rbs_buffer_t buffer;
-} rbs_serialize_state;
+#include <string.h>
 
 /* All multi-byte integers are written little-endian. */
 
-static void w_bytes(rbs_serialize_state *state, const char *value, size_t length) {
-    if (length > 0) {
-        rbs_buffer_append_string(state->allocator, &state->buffer, value, length);
+static void w_bytes(rbs_serializer_t *state, const char *value, size_t length) {
+    if (state->output != NULL && length > 0) {
+        memcpy(state->output + state->size, value, length);
     }
+    state->size += length;
 }
 
-static void w_u8(rbs_serialize_state *state, uint8_t value) {
+static void w_u8(rbs_serializer_t *state, uint8_t value) {
     w_bytes(state, (const char *) &value, 1);
 }
 
-static void w_u32(rbs_serialize_state *state, uint32_t value) {
+static void w_u32(rbs_serializer_t *state, uint32_t value) {
     unsigned char bytes[4] = {
         (unsigned char) (value & 0xff),
         (unsigned char) ((value >> 8) & 0xff),
@@ -46,27 +36,83 @@ static void w_u32(rbs_serialize_state *state, uint32_t value) {
     w_bytes(state, (const char *) bytes, 4);
 }
 
-static void w_i32(rbs_serialize_state *state, int32_t value) {
+static void w_i32(rbs_serializer_t *state, int32_t value) {
     w_u32(state, (uint32_t) value);
 }
 
-static void w_string(rbs_serialize_state *state, rbs_string_t string) {
+static void w_string(rbs_serializer_t *state, rbs_string_t string) {
     size_t length = rbs_string_len(string);
     w_u32(state, (uint32_t) length);
     w_bytes(state, string.start, length);
 }
 
-static void w_constant(rbs_serialize_state *state, rbs_constant_id_t id) {
-    rbs_constant_t *constant = rbs_constant_pool_id_to_constant(state->constant_pool, id);
-    RBS_ASSERT(constant != NULL, "constant is NULL");
-    w_u32(state, (uint32_t) constant->length);
-    w_bytes(state, (const char *) constant->start, constant->length);
+static uint32_t constant_slot(rbs_constant_id_t id, uint32_t mask) {
+    return (id * 2654435761u) & mask;
+}
+
+// Returns the slot of the index that has `id`, or the empty slot to put it in.
+static uint32_t find_constant_slot(rbs_serializer_t *state, rbs_constant_id_t id) {
+    uint32_t mask = state->index_capacity - 1;
+    uint32_t slot = constant_slot(id, mask);
+    while (state->index[slot] != 0 && state->constants[state->index[slot] - 1] != id) {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+// Adds `id` to the constant table, growing the index so that it stays at most half full.
+static void add_constant(rbs_serializer_t *state, rbs_constant_id_t id) {
+    if (state->constants_count == state->constants_capacity) {
+        if (state->constants == NULL) {
+            state->constants_capacity = 32;
+            state->constants = rbs_allocator_alloc_many(state->allocator, state->constants_capacity, rbs_constant_id_t);
+        } else {
+            size_t old_size = state->constants_capacity * sizeof(rbs_constant_id_t);
+            state->constants_capacity *= 2;
+            state->constants = rbs_allocator_realloc(state->allocator, state->constants, old_size, state->constants_capacity * sizeof(rbs_constant_id_t), rbs_constant_id_t);
+        }
+    }
+    state->constants[state->constants_count++] = id;
+
+    if (state->constants_count * 2 > state->index_capacity) {
+        state->index_capacity = state->index_capacity == 0 ? 64 : state->index_capacity * 2;
+        state->index = rbs_allocator_calloc(state->allocator, state->index_capacity, uint32_t);
+        for (uint32_t i = 0; i < state->constants_count; i++) {
+            state->index[find_constant_slot(state, state->constants[i])] = i + 1;
+        }
+    } else {
+        state->index[find_constant_slot(state, id)] = state->constants_count;
+    }
+}
+
+// A constant is written as its position in the constant table at the start of the output.
+// The measuring pass builds the table, and counts the bytes each new constant takes in it.
+static void w_constant(rbs_serializer_t *state, rbs_constant_id_t id) {
+    if (state->output == NULL && (state->index_capacity == 0 || state->index[find_constant_slot(state, id)] == 0)) {
+        rbs_constant_t *constant = rbs_constant_pool_id_to_constant(state->constant_pool, id);
+        RBS_ASSERT(constant != NULL, "constant is NULL");
+        add_constant(state, id);
+        state->size += 4 + constant->length;
+    }
+
+    uint32_t position = state->index[find_constant_slot(state, id)];
+    RBS_ASSERT(position != 0, "constant %u is not in the constant table", id);
+    w_u32(state, position - 1);
+}
+
+static void w_constant_table(rbs_serializer_t *state) {
+    w_u32(state, state->constants_count);
+    for (uint32_t i = 0; i < state->constants_count; i++) {
+        rbs_constant_t *constant = rbs_constant_pool_id_to_constant(state->constant_pool, state->constants[i]);
+        w_u32(state, (uint32_t) constant->length);
+        w_bytes(state, (const char *) constant->start, constant->length);
+    }
 }
 
 // A location range is encoded as a presence byte, followed by the start/end
 // character positions when present. A null range encodes as a single 0 byte
 // (it becomes `nil` on the Ruby side).
-static void w_loc_range(rbs_serialize_state *state, rbs_location_range range) {
+static void w_loc_range(rbs_serializer_t *state, rbs_location_range range) {
     if (RBS_LOCATION_NULL_RANGE_P(range)) {
         w_u8(state, 0);
     } else {
@@ -76,7 +122,7 @@ static void w_loc_range(rbs_serialize_state *state, rbs_location_range range) {
     }
 }
 
-static void w_loc_range_list(rbs_serialize_state *state, rbs_location_range_list_t *list) {
+static void w_loc_range_list(rbs_serializer_t *state, rbs_location_range_list_t *list) {
     if (list == NULL) {
         w_u32(state, 0);
         return;
@@ -88,53 +134,46 @@ static void w_loc_range_list(rbs_serialize_state *state, rbs_location_range_list
     }
 }
 
-static void w_attr_ivar_name(rbs_serialize_state *state, rbs_attr_ivar_name_t ivar_name) {
+static void w_attr_ivar_name(rbs_serializer_t *state, rbs_attr_ivar_name_t ivar_name) {
     w_u8(state, (uint8_t) ivar_name.tag);
     if (ivar_name.tag == RBS_ATTR_IVAR_NAME_TAG_NAME) {
         w_constant(state, ivar_name.name);
     }
 }
 
-static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance);
+static void serialize_node(rbs_serializer_t *state, rbs_node_t *instance);
 
-static void w_node_list(rbs_serialize_state *state, rbs_node_list_t *list) {
+static void w_node_list(rbs_serializer_t *state, rbs_node_list_t *list) {
     if (list == NULL) {
         w_u32(state, 0);
         return;
     }
 
     w_u32(state, (uint32_t) list->length);
-    for (rbs_node_list_node_t *n = list->head; n != NULL; n = n->next) {
-        serialize_node(state, n->node);
+    for (size_t i = 0; i < list->length; i++) {
+        serialize_node(state, list->items[i]);
     }
 }
 
-static void w_hash(rbs_serialize_state *state, rbs_hash_t *hash) {
+static void w_hash(rbs_serializer_t *state, rbs_hash_t *hash) {
     if (hash == NULL) {
         w_u32(state, 0);
         return;
     }
 
-    // rbs_hash_t does not maintain its `length` field (unlike rbs_node_list_t),
-    // so count the entries by walking the list.
-    uint32_t count = 0;
-    for (rbs_hash_node_t *n = hash->head; n != NULL; n = n->next) {
-        count++;
-    }
-    w_u32(state, count);
-
-    for (rbs_hash_node_t *n = hash->head; n != NULL; n = n->next) {
-        serialize_node(state, n->key);
-        serialize_node(state, n->value);
+    w_u32(state, (uint32_t) hash->length);
+    for (size_t i = 0; i < hash->length; i++) {
+        serialize_node(state, hash->entries[i].key);
+        serialize_node(state, hash->entries[i].value);
     }
 }
 
 // The node tag written ahead of every node. Tag 0 is reserved for NULL, tags
 // 1..N are the nodes below (in the same order the Ruby schema is generated),
 // and the final tag is `rbs_ast_symbol`, which is not a config.yml node.
-#define RBS_SERIALIZE_TAG_SYMBOL 79
+#define RBS_SERIALIZE_TAG_SYMBOL 80
 
-static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
+static void serialize_node(rbs_serializer_t *state, rbs_node_t *instance) {
     if (instance == NULL) {
         w_u8(state, 0);
         return;
@@ -486,15 +525,23 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         w_u8(state, (uint8_t) node->visibility);
         return;
     }
-    case RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD: {
+    case RBS_AST_MEMBERS_METHOD_DEFINITION_LAZY_OVERLOADS: {
         w_u8(state, 28);
+        rbs_ast_members_method_definition_lazy_overloads_t *node = (rbs_ast_members_method_definition_lazy_overloads_t *) instance;
+        w_loc_range(state, node->base.location);
+        w_node_list(state, node->variables);
+        w_u8(state, node->classish_allowed ? 1 : 0);
+        return;
+    }
+    case RBS_AST_MEMBERS_METHOD_DEFINITION_OVERLOAD: {
+        w_u8(state, 29);
         rbs_ast_members_method_definition_overload_t *node = (rbs_ast_members_method_definition_overload_t *) instance;
         w_node_list(state, node->annotations);
         serialize_node(state, (rbs_node_t *) node->method_type);
         return;
     }
     case RBS_AST_MEMBERS_PREPEND: {
-        w_u8(state, 29);
+        w_u8(state, 30);
         rbs_ast_members_prepend_t *node = (rbs_ast_members_prepend_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -507,19 +554,19 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_MEMBERS_PRIVATE: {
-        w_u8(state, 30);
+        w_u8(state, 31);
         rbs_ast_members_private_t *node = (rbs_ast_members_private_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_AST_MEMBERS_PUBLIC: {
-        w_u8(state, 31);
+        w_u8(state, 32);
         rbs_ast_members_public_t *node = (rbs_ast_members_public_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_BLOCK_PARAM_TYPE_ANNOTATION: {
-        w_u8(state, 32);
+        w_u8(state, 33);
         rbs_ast_ruby_annotations_block_param_type_annotation_t *node = (rbs_ast_ruby_annotations_block_param_type_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -533,7 +580,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_CLASS_ALIAS_ANNOTATION: {
-        w_u8(state, 33);
+        w_u8(state, 34);
         rbs_ast_ruby_annotations_class_alias_annotation_t *node = (rbs_ast_ruby_annotations_class_alias_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -543,7 +590,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_COLON_METHOD_TYPE_ANNOTATION: {
-        w_u8(state, 34);
+        w_u8(state, 35);
         rbs_ast_ruby_annotations_colon_method_type_annotation_t *node = (rbs_ast_ruby_annotations_colon_method_type_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -552,7 +599,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_DOUBLE_SPLAT_PARAM_TYPE_ANNOTATION: {
-        w_u8(state, 35);
+        w_u8(state, 36);
         rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *node = (rbs_ast_ruby_annotations_double_splat_param_type_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -564,7 +611,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_INSTANCE_VARIABLE_ANNOTATION: {
-        w_u8(state, 36);
+        w_u8(state, 37);
         rbs_ast_ruby_annotations_instance_variable_annotation_t *node = (rbs_ast_ruby_annotations_instance_variable_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -576,7 +623,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_METHOD_TYPES_ANNOTATION: {
-        w_u8(state, 37);
+        w_u8(state, 38);
         rbs_ast_ruby_annotations_method_types_annotation_t *node = (rbs_ast_ruby_annotations_method_types_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -586,7 +633,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_MODULE_ALIAS_ANNOTATION: {
-        w_u8(state, 38);
+        w_u8(state, 39);
         rbs_ast_ruby_annotations_module_alias_annotation_t *node = (rbs_ast_ruby_annotations_module_alias_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -596,7 +643,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_MODULE_SELF_ANNOTATION: {
-        w_u8(state, 39);
+        w_u8(state, 40);
         rbs_ast_ruby_annotations_module_self_annotation_t *node = (rbs_ast_ruby_annotations_module_self_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -611,7 +658,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_NODE_TYPE_ASSERTION: {
-        w_u8(state, 40);
+        w_u8(state, 41);
         rbs_ast_ruby_annotations_node_type_assertion_t *node = (rbs_ast_ruby_annotations_node_type_assertion_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -619,7 +666,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_PARAM_TYPE_ANNOTATION: {
-        w_u8(state, 41);
+        w_u8(state, 42);
         rbs_ast_ruby_annotations_param_type_annotation_t *node = (rbs_ast_ruby_annotations_param_type_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -630,7 +677,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_RETURN_TYPE_ANNOTATION: {
-        w_u8(state, 42);
+        w_u8(state, 43);
         rbs_ast_ruby_annotations_return_type_annotation_t *node = (rbs_ast_ruby_annotations_return_type_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -641,7 +688,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_SKIP_ANNOTATION: {
-        w_u8(state, 43);
+        w_u8(state, 44);
         rbs_ast_ruby_annotations_skip_annotation_t *node = (rbs_ast_ruby_annotations_skip_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -650,7 +697,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_SPLAT_PARAM_TYPE_ANNOTATION: {
-        w_u8(state, 44);
+        w_u8(state, 45);
         rbs_ast_ruby_annotations_splat_param_type_annotation_t *node = (rbs_ast_ruby_annotations_splat_param_type_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -662,7 +709,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_RUBY_ANNOTATIONS_TYPE_APPLICATION_ANNOTATION: {
-        w_u8(state, 45);
+        w_u8(state, 46);
         rbs_ast_ruby_annotations_type_application_annotation_t *node = (rbs_ast_ruby_annotations_type_application_annotation_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->prefix_location);
@@ -672,12 +719,12 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_AST_STRING: {
-        w_u8(state, 46);
+        w_u8(state, 47);
         w_string(state, ((rbs_ast_string_t *) instance)->string);
         return;
     }
     case RBS_AST_TYPE_PARAM: {
-        w_u8(state, 47);
+        w_u8(state, 48);
         rbs_ast_type_param_t *node = (rbs_ast_type_param_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -695,7 +742,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_METHOD_TYPE: {
-        w_u8(state, 48);
+        w_u8(state, 49);
         rbs_method_type_t *node = (rbs_method_type_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->type_range);
@@ -706,28 +753,28 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_NAMESPACE: {
-        w_u8(state, 49);
+        w_u8(state, 50);
         rbs_namespace_t *node = (rbs_namespace_t *) instance;
         w_node_list(state, node->path);
         w_u8(state, node->absolute ? 1 : 0);
         return;
     }
     case RBS_SIGNATURE: {
-        w_u8(state, 50);
+        w_u8(state, 51);
         rbs_signature_t *node = (rbs_signature_t *) instance;
         w_node_list(state, node->directives);
         w_node_list(state, node->declarations);
         return;
     }
     case RBS_TYPE_NAME: {
-        w_u8(state, 51);
+        w_u8(state, 52);
         rbs_type_name_t *node = (rbs_type_name_t *) instance;
         serialize_node(state, (rbs_node_t *) node->rbs_namespace);
         serialize_node(state, (rbs_node_t *) node->name);
         return;
     }
     case RBS_TYPES_ALIAS: {
-        w_u8(state, 52);
+        w_u8(state, 53);
         rbs_types_alias_t *node = (rbs_types_alias_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -737,62 +784,62 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_BASES_ANY: {
-        w_u8(state, 53);
+        w_u8(state, 54);
         rbs_types_bases_any_t *node = (rbs_types_bases_any_t *) instance;
         w_loc_range(state, node->base.location);
         w_u8(state, node->todo ? 1 : 0);
         return;
     }
     case RBS_TYPES_BASES_BOOL: {
-        w_u8(state, 54);
+        w_u8(state, 55);
         rbs_types_bases_bool_t *node = (rbs_types_bases_bool_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_BOTTOM: {
-        w_u8(state, 55);
+        w_u8(state, 56);
         rbs_types_bases_bottom_t *node = (rbs_types_bases_bottom_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_CLASS: {
-        w_u8(state, 56);
+        w_u8(state, 57);
         rbs_types_bases_class_t *node = (rbs_types_bases_class_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_INSTANCE: {
-        w_u8(state, 57);
+        w_u8(state, 58);
         rbs_types_bases_instance_t *node = (rbs_types_bases_instance_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_NIL: {
-        w_u8(state, 58);
+        w_u8(state, 59);
         rbs_types_bases_nil_t *node = (rbs_types_bases_nil_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_SELF: {
-        w_u8(state, 59);
+        w_u8(state, 60);
         rbs_types_bases_self_t *node = (rbs_types_bases_self_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_TOP: {
-        w_u8(state, 60);
+        w_u8(state, 61);
         rbs_types_bases_top_t *node = (rbs_types_bases_top_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BASES_VOID: {
-        w_u8(state, 61);
+        w_u8(state, 62);
         rbs_types_bases_void_t *node = (rbs_types_bases_void_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_BLOCK: {
-        w_u8(state, 62);
+        w_u8(state, 63);
         rbs_types_block_t *node = (rbs_types_block_t *) instance;
         w_loc_range(state, node->base.location);
         serialize_node(state, (rbs_node_t *) node->type);
@@ -801,7 +848,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_CLASS_INSTANCE: {
-        w_u8(state, 63);
+        w_u8(state, 64);
         rbs_types_class_instance_t *node = (rbs_types_class_instance_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -811,7 +858,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_CLASS_SINGLETON: {
-        w_u8(state, 64);
+        w_u8(state, 65);
         rbs_types_class_singleton_t *node = (rbs_types_class_singleton_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -821,7 +868,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_FUNCTION: {
-        w_u8(state, 65);
+        w_u8(state, 66);
         rbs_types_function_t *node = (rbs_types_function_t *) instance;
         w_node_list(state, node->required_positionals);
         w_node_list(state, node->optional_positionals);
@@ -835,13 +882,13 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_FUNCTION_FORWARDING_PARAM: {
-        w_u8(state, 66);
+        w_u8(state, 67);
         rbs_types_function_forwarding_param_t *node = (rbs_types_function_forwarding_param_t *) instance;
         w_loc_range(state, node->base.location);
         return;
     }
     case RBS_TYPES_FUNCTION_PARAM: {
-        w_u8(state, 67);
+        w_u8(state, 68);
         rbs_types_function_param_t *node = (rbs_types_function_param_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -850,7 +897,7 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_INTERFACE: {
-        w_u8(state, 68);
+        w_u8(state, 69);
         rbs_types_interface_t *node = (rbs_types_interface_t *) instance;
         w_loc_range(state, node->base.location);
         w_loc_range(state, node->name_range);
@@ -860,28 +907,28 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_INTERSECTION: {
-        w_u8(state, 69);
+        w_u8(state, 70);
         rbs_types_intersection_t *node = (rbs_types_intersection_t *) instance;
         w_loc_range(state, node->base.location);
         w_node_list(state, node->types);
         return;
     }
     case RBS_TYPES_LITERAL: {
-        w_u8(state, 70);
+        w_u8(state, 71);
         rbs_types_literal_t *node = (rbs_types_literal_t *) instance;
         w_loc_range(state, node->base.location);
         serialize_node(state, (rbs_node_t *) node->literal);
         return;
     }
     case RBS_TYPES_OPTIONAL: {
-        w_u8(state, 71);
+        w_u8(state, 72);
         rbs_types_optional_t *node = (rbs_types_optional_t *) instance;
         w_loc_range(state, node->base.location);
         serialize_node(state, (rbs_node_t *) node->type);
         return;
     }
     case RBS_TYPES_PROC: {
-        w_u8(state, 72);
+        w_u8(state, 73);
         rbs_types_proc_t *node = (rbs_types_proc_t *) instance;
         w_loc_range(state, node->base.location);
         serialize_node(state, (rbs_node_t *) node->type);
@@ -890,41 +937,41 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
         return;
     }
     case RBS_TYPES_RECORD: {
-        w_u8(state, 73);
+        w_u8(state, 74);
         rbs_types_record_t *node = (rbs_types_record_t *) instance;
         w_loc_range(state, node->base.location);
         w_hash(state, node->all_fields);
         return;
     }
     case RBS_TYPES_RECORD_FIELD_TYPE: {
-        w_u8(state, 74);
+        w_u8(state, 75);
         rbs_types_record_field_type_t *node = (rbs_types_record_field_type_t *) instance;
         serialize_node(state, node->type);
         w_u8(state, node->required ? 1 : 0);
         return;
     }
     case RBS_TYPES_TUPLE: {
-        w_u8(state, 75);
+        w_u8(state, 76);
         rbs_types_tuple_t *node = (rbs_types_tuple_t *) instance;
         w_loc_range(state, node->base.location);
         w_node_list(state, node->types);
         return;
     }
     case RBS_TYPES_UNION: {
-        w_u8(state, 76);
+        w_u8(state, 77);
         rbs_types_union_t *node = (rbs_types_union_t *) instance;
         w_loc_range(state, node->base.location);
         w_node_list(state, node->types);
         return;
     }
     case RBS_TYPES_UNTYPED_FUNCTION: {
-        w_u8(state, 77);
+        w_u8(state, 78);
         rbs_types_untyped_function_t *node = (rbs_types_untyped_function_t *) instance;
         serialize_node(state, (rbs_node_t *) node->return_type);
         return;
     }
     case RBS_TYPES_VARIABLE: {
-        w_u8(state, 78);
+        w_u8(state, 79);
         rbs_types_variable_t *node = (rbs_types_variable_t *) instance;
         w_loc_range(state, node->base.location);
         serialize_node(state, (rbs_node_t *) node->name);
@@ -940,26 +987,62 @@ static void serialize_node(rbs_serialize_state *state, rbs_node_t *instance) {
     RBS_ASSERT(false, "rbs_serialize_node: unknown node type: %d", instance->type);
 }
 
-rbs_string_t rbs_serialize_node(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, rbs_node_t *node) {
-    rbs_serialize_state state = {
+void rbs_serializer_init(rbs_serializer_t *serializer, rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool) {
+    *serializer = (rbs_serializer_t) {
         .allocator = allocator,
         .constant_pool = constant_pool,
+        .constants = NULL,
+        .constants_count = 0,
+        .constants_capacity = 0,
+        .index = NULL,
+        .index_capacity = 0,
+        .output = NULL,
+        .size = 4, // The count of the constant table
     };
-    rbs_buffer_init(allocator, &state.buffer);
+}
 
-    serialize_node(&state, node);
+size_t rbs_serializer_measure_node(rbs_serializer_t *serializer, rbs_node_t *node) {
+    serialize_node(serializer, node);
+    return serializer->size;
+}
+
+void rbs_serializer_write_node(rbs_serializer_t *serializer, rbs_node_t *node, char *output) {
+    serializer->output = output;
+    serializer->size = 0;
+    w_constant_table(serializer);
+    serialize_node(serializer, node);
+}
+
+size_t rbs_serializer_measure_node_list(rbs_serializer_t *serializer, rbs_node_list_t *list) {
+    w_node_list(serializer, list);
+    return serializer->size;
+}
 
-    return rbs_buffer_to_string(&state.buffer);
+void rbs_serializer_write_node_list(rbs_serializer_t *serializer, rbs_node_list_t *list, char *output) {
+    serializer->output = output;
+    serializer->size = 0;
+    w_constant_table(serializer);
+    w_node_list(serializer, list);
+}
+
+rbs_string_t rbs_serialize_node(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, rbs_node_t *node) {
+    rbs_serializer_t serializer;
+    rbs_serializer_init(&serializer, allocator, constant_pool);
+
+    size_t size = rbs_serializer_measure_node(&serializer, node);
+    char *output = rbs_allocator_alloc_many(allocator, size, char);
+    rbs_serializer_write_node(&serializer, node, output);
+
+    return rbs_string_new(output, output + size);
 }
 
 rbs_string_t rbs_serialize_node_list(rbs_allocator_t *allocator, rbs_constant_pool_t *constant_pool, rbs_node_list_t *list) {
-    rbs_serialize_state state = {
-        .allocator = allocator,
-        .constant_pool = constant_pool,
-    };
-    rbs_buffer_init(allocator, &state.buffer);
+    rbs_serializer_t serializer;
+    rbs_serializer_init(&serializer, allocator, constant_pool);
 
-    w_node_list(&state, list);
+    size_t size = rbs_serializer_measure_node_list(&serializer, list);
+    char *output = rbs_allocator_alloc_many(allocator, size, char);
+    rbs_serializer_write_node_list(&serializer, list, output);
 
-    return rbs_buffer_to_string(&state.buffer);
+    return rbs_string_new(output, output + size);
 }
@@ -11,12 +11,14 @@
  *  page is allocated, and the small allocation is placed at its start. This approach wastes that unused slack at the
  *  end of the previous page, but it means that allocations are instant and never scan the linked list to find a gap.
  *
- *  This allocator doesn't support freeing individual allocations. Only the whole arena can be freed at once at the end.
+ *  This allocator doesn't support freeing individual allocations. Only the whole arena can be freed at once at the end,
+ *  or reset with `rbs_allocator_reset()`, which keeps the small pages around for the next use of the arena.
  */
 
 #include "rbs/util/rbs_allocator.h"
 #include "rbs/util/rbs_assert.h"
 
+#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h> // for memset()
 #include <stdint.h>
@@ -37,8 +39,14 @@ typedef struct rbs_allocator_page {
 
     // The offset of the next available byte.
     size_t used;
+
+    // Whether the page is a large allocation page, which holds a single allocation.
+    bool large;
 } rbs_allocator_page_t;
 
+// The small pages grow up to this many system pages.
+#define RBS_ALLOCATOR_MAX_PAGE_COUNT 64
+
 // Normalize a raw page size to a safe value for payload_size subtraction.
 // Falls back to 4096 when the raw value is <= 0 or smaller than the page
 // header struct, preventing underflow in rbs_allocator_init.
@@ -72,6 +80,7 @@ static rbs_allocator_page_t *rbs_allocator_page_new(size_t payload_size) {
     rbs_allocator_page_t *page = (rbs_allocator_page_t *) malloc(page_header_size + payload_size);
     page->size = payload_size;
     page->used = 0;
+    page->large = false;
 
     return page;
 }
@@ -82,37 +91,206 @@ rbs_allocator_t *rbs_allocator_init(void) {
     const size_t system_page_size = get_system_page_size();
 
     allocator->default_page_payload_size = system_page_size - sizeof(rbs_allocator_page_t);
+    allocator->page_payload_size = allocator->default_page_payload_size;
+    allocator->max_page_payload_size = system_page_size * RBS_ALLOCATOR_MAX_PAGE_COUNT - sizeof(rbs_allocator_page_t);
 
     allocator->page = rbs_allocator_page_new(allocator->default_page_payload_size);
     allocator->page->next = NULL;
+    allocator->free_pages = NULL;
+
+    allocator->requested_bytes = 0;
+    allocator->alignment_bytes = 0;
+    allocator->abandoned_bytes = 0;
 
     return allocator;
 }
 
-void rbs_allocator_free(rbs_allocator_t *allocator) {
-    rbs_allocator_page_t *page = allocator->page;
+static void rbs_allocator_free_page_list(rbs_allocator_page_t *page) {
     while (page) {
         rbs_allocator_page_t *next = page->next;
         free(page);
         page = next;
     }
+}
+
+void rbs_allocator_free(rbs_allocator_t *allocator) {
+    rbs_allocator_free_page_list(allocator->page);
+    rbs_allocator_free_page_list(allocator->free_pages);
     free(allocator);
 }
 
-// Allocates `new_size` bytes from `allocator`, aligned to an `alignment`-byte boundary.
-// Copies `old_size` bytes from `ptr` to the new allocation.
-// It always reallocates the memory in new space and thus wastes the old space.
+void rbs_allocator_reset(rbs_allocator_t *allocator, size_t retain) {
+    // Collect every page of the arena, including the ones kept by the previous reset.
+    rbs_allocator_page_t *page = allocator->page;
+    rbs_allocator_page_t *free_pages = allocator->free_pages;
+
+    rbs_allocator_page_t *head = NULL;
+    rbs_allocator_page_t *kept = NULL;
+    size_t kept_size = 0;
+
+    // One system page is kept in any case, the arena has to have a head page.
+    size_t limit = retain > allocator->default_page_payload_size ? retain : allocator->default_page_payload_size;
+
+    for (int list = 0; list < 2; list++) {
+        while (page) {
+            rbs_allocator_page_t *next = page->next;
+
+            if (page->large || kept_size + page->size > limit) {
+                // Large pages are sized for the allocation they were made for, and are never reused.
+                free(page);
+            } else if (head == NULL) {
+                head = page;
+                kept_size += page->size;
+            } else {
+                page->next = kept;
+                kept = page;
+                kept_size += page->size;
+            }
+
+            page = next;
+        }
+
+        page = free_pages;
+    }
+
+    if (head == NULL) {
+        head = rbs_allocator_page_new(allocator->default_page_payload_size);
+    }
+
+    head->next = NULL;
+    head->used = 0;
+
+    allocator->page = head;
+    allocator->free_pages = kept;
+
+    // Start growing from one system page again, so that a large parse doesn't leave the next small ones with the largest pages.
+    allocator->page_payload_size = allocator->default_page_payload_size;
+
+    allocator->requested_bytes = 0;
+    allocator->alignment_bytes = 0;
+    allocator->abandoned_bytes = 0;
+}
+
+// Returns a small page with at least `size` bytes of payload, taking one of the kept pages when it's large enough.
+// The size of the next new page grows geometrically, so that a large parse doesn't call `malloc` for every few KiB.
+static rbs_allocator_page_t *rbs_allocator_small_page_new(rbs_allocator_t *allocator, size_t size) {
+    rbs_allocator_page_t *page = allocator->free_pages;
+    if (page && page->size >= size) {
+        allocator->free_pages = page->next;
+        page->used = 0;
+        return page;
+    }
+
+    size_t payload_size = allocator->page_payload_size;
+    if (payload_size < size) {
+        // `rbs_allocator_reserve()` can ask for more than the next page size.
+        // Round it up to whole system pages, as the other pages are.
+        const size_t system_page_size = allocator->default_page_payload_size + sizeof(rbs_allocator_page_t);
+        payload_size = (size + sizeof(rbs_allocator_page_t) + system_page_size - 1) / system_page_size * system_page_size - sizeof(rbs_allocator_page_t);
+    } else if (payload_size < allocator->max_page_payload_size) {
+        size_t next_size = (payload_size + sizeof(rbs_allocator_page_t)) * 2 - sizeof(rbs_allocator_page_t);
+        allocator->page_payload_size = next_size < allocator->max_page_payload_size ? next_size : allocator->max_page_payload_size;
+    }
+
+    return rbs_allocator_page_new(payload_size);
+}
+
+void rbs_allocator_reserve(rbs_allocator_t *allocator, size_t size) {
+    rbs_allocator_page_t *page = allocator->page;
+    if (page->size - page->used >= size) return;
+
+    rbs_allocator_page_t *new_page = rbs_allocator_small_page_new(allocator, size);
+
+    if (page->used == 0) {
+        // Nothing is allocated in the head page yet, keep it for later instead of wasting it.
+        allocator->page = page->next;
+        page->next = allocator->free_pages;
+        allocator->free_pages = page;
+    }
+
+    new_page->next = allocator->page;
+    allocator->page = new_page;
+}
+
+rbs_allocator_stats_t rbs_allocator_stats(const rbs_allocator_t *allocator) {
+    rbs_allocator_stats_t stats = {
+        .requested_bytes = allocator->requested_bytes,
+        .alignment_bytes = allocator->alignment_bytes,
+        .abandoned_bytes = allocator->abandoned_bytes,
+    };
+
+    for (rbs_allocator_page_t *page = allocator->page; page; page = page->next) {
+        stats.page_count += 1;
+        stats.used_bytes += page->used;
+        stats.capacity_bytes += page->size;
+
+        if (page->large) {
+            stats.large_page_count += 1;
+        } else if (page != allocator->page) {
+            stats.slack_bytes += page->size - page->used;
+        }
+    }
+
+    return stats;
+}
+
+// Returns true if `ptr` is the last allocation of `size` bytes in the head page, which can be resized in place.
+static bool rbs_allocator_is_tail(const rbs_allocator_t *allocator, const void *ptr, size_t size) {
+    const rbs_allocator_page_t *page = allocator->page;
+    uintptr_t base = (uintptr_t) page + sizeof(rbs_allocator_page_t);
+
+    return (uintptr_t) ptr >= base && (uintptr_t) ptr + size == base + page->used;
+}
+
+size_t rbs_allocator_tail_capacity(const rbs_allocator_t *allocator, const void *ptr, size_t size) {
+    if (!rbs_allocator_is_tail(allocator, ptr, size)) return size;
+
+    const rbs_allocator_page_t *page = allocator->page;
+    return size + (page->size - page->used);
+}
+
+// Resizes the allocation at `ptr` from `old_size` bytes to `new_size` bytes, aligned to an `alignment`-byte boundary.
+//
+// If `ptr` is the last allocation in the head page, and the page has enough room, it is resized in place, so that
+// buffers growing at the end of the arena (`rbs_buffer_t`, for example) don't strand a copy of themselves on every growth.
+// Otherwise, it allocates `new_size` bytes in new space, copies `old_size` bytes from `ptr` to it, and wastes the old space.
 void *rbs_allocator_realloc_impl(rbs_allocator_t *allocator, void *ptr, size_t old_size, size_t new_size, size_t alignment) {
+    if (rbs_allocator_is_tail(allocator, ptr, old_size)) {
+        rbs_allocator_page_t *page = allocator->page;
+        size_t offset = (size_t) ((uintptr_t) ptr - ((uintptr_t) page + sizeof(rbs_allocator_page_t)));
+
+        if (offset + new_size <= page->size) {
+            page->used = offset + new_size;
+            allocator->requested_bytes = allocator->requested_bytes - old_size + new_size;
+            return ptr;
+        }
+
+        // Moving to a new page, the space of the old allocation can be given back to the head page.
+        // It is the slack of the page once a new head page is allocated, but is reused if the allocation takes a large page.
+        page->used = offset;
+    } else {
+        if (new_size < old_size) return ptr;
+
+        allocator->abandoned_bytes += old_size;
+    }
+
+    allocator->requested_bytes -= old_size;
+
     void *p = rbs_allocator_malloc_impl(allocator, new_size, alignment);
-    memcpy(p, ptr, old_size);
+    memmove(p, ptr, old_size);
     return p;
 }
 
 // Allocates `size` bytes from `allocator`, aligned to an `alignment`-byte boundary.
 void *rbs_allocator_malloc_impl(rbs_allocator_t *allocator, size_t size, size_t alignment) {
-    if (allocator->default_page_payload_size < size) { // Big allocation, give it its own page.
+    if (allocator->page_payload_size < size) { // Big allocation, give it its own page.
         // Add padding to ensure we can align the start pointer within this page
         rbs_allocator_page_t *new_page = rbs_allocator_page_new(size + (alignment - 1));
+        new_page->large = true;
+        new_page->used = new_page->size;
+
+        allocator->requested_bytes += size;
+        allocator->alignment_bytes += alignment - 1;
 
         // This simple allocator can only put small allocations into the head page.
         // Naively prepending this large allocation page to the head of the allocator before the previous head page
@@ -144,7 +322,7 @@ void *rbs_allocator_malloc_impl(rbs_allocator_t *allocator, size_t size, size_t
 
     if (used_aligned + size > page->size) {
         // Not enough space. Allocate a new small page and prepend it to the allocator's linked list.
-        rbs_allocator_page_t *new_page = rbs_allocator_page_new(allocator->default_page_payload_size);
+        rbs_allocator_page_t *new_page = rbs_allocator_small_page_new(allocator, size + (alignment - 1));
         new_page->next = allocator->page;
         allocator->page = new_page;
         page = new_page;
@@ -152,6 +330,9 @@ void *rbs_allocator_malloc_impl(rbs_allocator_t *allocator, size_t size, size_t
         used_aligned = (size_t) (rbs_align_up_uintptr(base, alignment) - base); // start of fresh page (usually 0 if header is aligned)
     }
 
+    allocator->requested_bytes += size;
+    allocator->alignment_bytes += used_aligned - page->used;
+
     uintptr_t pointer = base + used_aligned;
     page->used = used_aligned + size;
     return (void *) pointer;
@@ -33,6 +33,12 @@ void rbs_buffer_append_string(rbs_allocator_t *allocator, rbs_buffer_t *buffer,
             new_capacity *= 2;
         }
 
+        // Grow less than double when that keeps the buffer at the end of its page, instead of moving it to a new one.
+        size_t tail_capacity = rbs_allocator_tail_capacity(allocator, buffer->value, old_capacity);
+        if (next_length <= tail_capacity && tail_capacity < new_capacity) {
+            new_capacity = tail_capacity;
+        }
+
         char *new_value = rbs_allocator_realloc(allocator, buffer->value, old_capacity, new_capacity, char);
         RBS_ASSERT(new_value != NULL, "Failed to append to buffer. Old capacity: %zu, new capacity: %zu", old_capacity, new_capacity);
 
@@ -45,6 +51,13 @@ void rbs_buffer_append_string(rbs_allocator_t *allocator, rbs_buffer_t *buffer,
     memcpy(buffer->value + cursor, source, length);
 }
 
+void rbs_buffer_shrink_to_fit(rbs_allocator_t *allocator, rbs_buffer_t *buffer) {
+    if (buffer->length == 0 || buffer->length == buffer->capacity) return;
+
+    buffer->value = rbs_allocator_realloc(allocator, buffer->value, buffer->capacity, buffer->length, char);
+    buffer->capacity = buffer->length;
+}
+
 void rbs_buffer_append_cstr(rbs_allocator_t *allocator, rbs_buffer_t *buffer, const char *value) {
     rbs_buffer_append_string(allocator, buffer, value, strlen(value));
 }
@@ -1,20 +1,63 @@
 #include "rbs/util/rbs_constant_pool.h"
+#include "rbs/util/rbs_constant_pool_seeds.h"
 #include "rbs/util/rbs_assert.h"
 
 /**
- * A relatively simple hash function (djb2) that is used to hash strings. We are
- * optimizing here for simplicity and speed.
+ * Read `length` (at most 8) bytes as a 64-bit integer.
  */
-static inline uint32_t
+static inline uint64_t
+rbs_constant_pool_read(const uint8_t *start, size_t length) {
+    uint64_t value = 0;
+    memcpy(&value, start, length);
+    return value;
+}
+
+/**
+ * Mix two 64-bit values, in the style of wyhash but with a 64-bit multiply so
+ * that it's portable to compilers without 128-bit integers.
+ */
+static inline uint64_t
+rbs_constant_pool_mix(uint64_t a, uint64_t b) {
+    uint64_t value = (a ^ b) * 0x9e3779b97f4a7c15ull;
+    return value ^ (value >> 32);
+}
+
+/**
+ * A hash function that reads the string 8 bytes at a time. Most of the
+ * constants are identifiers shorter than 16 bytes, which take one or two
+ * multiplications instead of a multiplication per byte.
+ *
+ * The hash depends on the byte order, so it's not meant to be stored.
+ */
+uint32_t
 rbs_constant_pool_hash(const uint8_t *start, size_t length) {
-    // This is a prime number used as the initial value for the hash function.
-    uint32_t value = 5381;
+    uint64_t value = 0x243f6a8885a308d3ull ^ length;
 
-    for (size_t index = 0; index < length; index++) {
-        value = ((value << 5) + value) + start[index];
+    while (length >= 8) {
+        value = rbs_constant_pool_mix(value, rbs_constant_pool_read(start, 8));
+        start += 8;
+        length -= 8;
     }
 
-    return value;
+    if (length > 0) {
+        value = rbs_constant_pool_mix(value, rbs_constant_pool_read(start, length));
+    }
+
+    // The murmur3 finalizer, so that the low bits (which index the buckets) depend on all of the bytes.
+    value ^= value >> 33;
+    value *= 0xff51afd7ed558ccdull;
+    value ^= value >> 33;
+
+    return (uint32_t) value;
+}
+
+/**
+ * Return the constant of a pool with an id that is not seeded. The ids of the
+ * constants of a pool start after the ids of the seeded constants.
+ */
+static inline rbs_constant_t *
+rbs_constant_pool_constant(const rbs_constant_pool_t *pool, rbs_constant_id_t constant_id) {
+    return &pool->constants[constant_id - RBS_CONSTANT_POOL_SEED_COUNT - 1];
 }
 
 /**
@@ -111,16 +154,34 @@ bool rbs_constant_pool_init(rbs_constant_pool_t *pool, uint32_t capacity) {
     pool->constants = (rbs_constant_t *) (((char *) memory) + capacity * sizeof(rbs_constant_pool_bucket_t));
     pool->size = 0;
     pool->capacity = capacity;
+    pool->global = NULL;
     return true;
 }
 
+void rbs_constant_pool_init_global(rbs_constant_pool_t *pool, rbs_global_constant_pool_t *global) {
+    *pool = (rbs_constant_pool_t) {
+        .buckets = NULL,
+        .constants = NULL,
+        .size = 0,
+        .capacity = 0,
+        .global = global,
+    };
+}
+
 /**
  * Return a pointer to the constant indicated by the given constant id.
  */
 rbs_constant_t *
 rbs_constant_pool_id_to_constant(const rbs_constant_pool_t *pool, rbs_constant_id_t constant_id) {
-    RBS_ASSERT(constant_id != RBS_CONSTANT_ID_UNSET && constant_id <= pool->size, "constant_id is not valid. Got %i, pool->size: %i", constant_id, pool->size);
-    return &pool->constants[constant_id - 1];
+    if (pool->global) return rbs_global_constant_pool_id_to_constant(pool->global, constant_id);
+
+    RBS_ASSERT(constant_id != RBS_CONSTANT_ID_UNSET && constant_id <= RBS_CONSTANT_POOL_SEED_COUNT + pool->size, "constant_id is not valid. Got %i, pool->size: %i", constant_id, pool->size);
+    if (constant_id <= RBS_CONSTANT_POOL_SEED_COUNT) {
+        // The seeded constants are never written through the returned pointer.
+        return (rbs_constant_t *) &rbs_constant_pool_seeds[constant_id - 1];
+    }
+
+    return rbs_constant_pool_constant(pool, constant_id);
 }
 
 /**
@@ -129,16 +190,29 @@ rbs_constant_pool_id_to_constant(const rbs_constant_pool_t *pool, rbs_constant_i
  */
 rbs_constant_id_t
 rbs_constant_pool_find(const rbs_constant_pool_t *pool, const uint8_t *start, size_t length) {
+    return rbs_constant_pool_find_with_hash(pool, start, length, rbs_constant_pool_hash(start, length));
+}
+
+/**
+ * Find a constant in a constant pool, with the hash of the constant computed
+ * by the caller.
+ */
+rbs_constant_id_t
+rbs_constant_pool_find_with_hash(const rbs_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash) {
+    if (pool->global) return rbs_global_constant_pool_find_with_hash(pool->global, start, length, hash);
+
+    rbs_constant_id_t seed = rbs_constant_pool_seed_find(start, length);
+    if (seed != RBS_CONSTANT_ID_UNSET) return seed;
+
     RBS_ASSERT(is_power_of_two(pool->capacity), "pool->capacity is not a power of two. Got %i", pool->capacity);
     const uint32_t mask = pool->capacity - 1;
 
-    uint32_t hash = rbs_constant_pool_hash(start, length);
     uint32_t index = hash & mask;
     rbs_constant_pool_bucket_t *bucket;
 
     while (bucket = &pool->buckets[index], bucket->id != RBS_CONSTANT_ID_UNSET) {
-        rbs_constant_t *constant = &pool->constants[bucket->id - 1];
-        if ((constant->length == length) && memcmp(constant->start, start, length) == 0) {
+        rbs_constant_t *constant = rbs_constant_pool_constant(pool, bucket->id);
+        if (bucket->hash == hash && constant->length == length && memcmp(constant->start, start, length) == 0) {
             return bucket->id;
         }
 
@@ -152,7 +226,27 @@ rbs_constant_pool_find(const rbs_constant_pool_t *pool, const uint8_t *start, si
  * Insert a constant into a constant pool and return its index in the pool.
  */
 static inline rbs_constant_id_t
-rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t length, rbs_constant_pool_bucket_type_t type) {
+rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash, rbs_constant_pool_bucket_type_t type) {
+    if (pool->global) {
+        rbs_constant_id_t id = rbs_global_constant_pool_insert_with_hash(pool->global, start, length, hash);
+
+        // The global pool keeps a copy, so the memory of an owned constant is not needed anymore.
+        if (type == RBS_CONSTANT_POOL_BUCKET_OWNED) {
+            free((void *) start);
+        }
+
+        return id;
+    }
+
+    rbs_constant_id_t seed = rbs_constant_pool_seed_find(start, length);
+    if (seed != RBS_CONSTANT_ID_UNSET) {
+        if (type == RBS_CONSTANT_POOL_BUCKET_OWNED) {
+            free((void *) start);
+        }
+
+        return seed;
+    }
+
     if (pool->size >= (pool->capacity / 4 * 3)) {
         if (!rbs_constant_pool_resize(pool)) return RBS_CONSTANT_ID_UNSET;
     }
@@ -160,7 +254,6 @@ rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t
     RBS_ASSERT(is_power_of_two(pool->capacity), "pool->capacity is not a power of two. Got %i", pool->capacity);
     const uint32_t mask = pool->capacity - 1;
 
-    uint32_t hash = rbs_constant_pool_hash(start, length);
     uint32_t index = hash & mask;
     rbs_constant_pool_bucket_t *bucket;
 
@@ -168,9 +261,9 @@ rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t
         // If there is a collision, then we need to check if the content is the
         // same as the content we are trying to insert. If it is, then we can
         // return the id of the existing constant.
-        rbs_constant_t *constant = &pool->constants[bucket->id - 1];
+        rbs_constant_t *constant = rbs_constant_pool_constant(pool, bucket->id);
 
-        if ((constant->length == length) && memcmp(constant->start, start, length) == 0) {
+        if (bucket->hash == hash && constant->length == length && memcmp(constant->start, start, length) == 0) {
             // Since we have found a match, we need to check if this is
             // attempting to insert a shared or an owned constant. We want to
             // prefer shared constants since they don't require allocations.
@@ -195,9 +288,9 @@ rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t
         index = (index + 1) & mask;
     }
 
-    // IDs are allocated starting at 1, since the value 0 denotes a non-existent
-    // constant.
-    uint32_t id = ++pool->size;
+    // IDs are allocated starting after the seeded constants, which start at 1,
+    // since the value 0 denotes a non-existent constant.
+    uint32_t id = RBS_CONSTANT_POOL_SEED_COUNT + ++pool->size;
     RBS_ASSERT(pool->size < ((uint32_t) (1 << 30)), "pool->size is too large. Got %i", pool->size);
 
     *bucket = (rbs_constant_pool_bucket_t) {
@@ -206,7 +299,7 @@ rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t
         .hash = hash
     };
 
-    pool->constants[id - 1] = (rbs_constant_t) {
+    *rbs_constant_pool_constant(pool, id) = (rbs_constant_t) {
         .start = start,
         .length = length,
     };
@@ -220,7 +313,17 @@ rbs_constant_pool_insert(rbs_constant_pool_t *pool, const uint8_t *start, size_t
  */
 rbs_constant_id_t
 rbs_constant_pool_insert_shared(rbs_constant_pool_t *pool, const uint8_t *start, size_t length) {
-    return rbs_constant_pool_insert(pool, start, length, RBS_CONSTANT_POOL_BUCKET_DEFAULT);
+    return rbs_constant_pool_insert(pool, start, length, rbs_constant_pool_hash(start, length), RBS_CONSTANT_POOL_BUCKET_DEFAULT);
+}
+
+/**
+ * Insert a constant into a constant pool, with the hash of the constant
+ * computed by the caller (the lexer computes it for identifier tokens).
+ */
+rbs_constant_id_t
+rbs_constant_pool_insert_shared_with_hash(rbs_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash) {
+    RBS_ASSERT(hash == rbs_constant_pool_hash(start, length), "hash is not the hash of the constant. Got %u", hash);
+    return rbs_constant_pool_insert(pool, start, length, hash, RBS_CONSTANT_POOL_BUCKET_DEFAULT);
 }
 
 rbs_constant_id_t
@@ -235,7 +338,7 @@ rbs_constant_pool_insert_shared_with_encoding(rbs_constant_pool_t *pool, const u
  */
 rbs_constant_id_t
 rbs_constant_pool_insert_owned(rbs_constant_pool_t *pool, uint8_t *start, size_t length) {
-    return rbs_constant_pool_insert(pool, start, length, RBS_CONSTANT_POOL_BUCKET_OWNED);
+    return rbs_constant_pool_insert(pool, start, length, rbs_constant_pool_hash(start, length), RBS_CONSTANT_POOL_BUCKET_OWNED);
 }
 
 /**
@@ -245,13 +348,16 @@ rbs_constant_pool_insert_owned(rbs_constant_pool_t *pool, uint8_t *start, size_t
  */
 rbs_constant_id_t
 rbs_constant_pool_insert_constant(rbs_constant_pool_t *pool, const uint8_t *start, size_t length) {
-    return rbs_constant_pool_insert(pool, start, length, RBS_CONSTANT_POOL_BUCKET_CONSTANT);
+    return rbs_constant_pool_insert(pool, start, length, rbs_constant_pool_hash(start, length), RBS_CONSTANT_POOL_BUCKET_CONSTANT);
 }
 
 /**
  * Free the memory associated with a constant pool.
  */
 void rbs_constant_pool_free(rbs_constant_pool_t *pool) {
+    // The constants belong to the global pool.
+    if (pool->global) return;
+
     // For each constant in the current constant pool, free the contents if the
     // contents are owned.
     for (uint32_t index = 0; index < pool->capacity; index++) {
@@ -259,7 +365,7 @@ void rbs_constant_pool_free(rbs_constant_pool_t *pool) {
 
         // If an id is set on this constant, then we know we have content here.
         if (bucket->id != RBS_CONSTANT_ID_UNSET && bucket->type == RBS_CONSTANT_POOL_BUCKET_OWNED) {
-            rbs_constant_t *constant = &pool->constants[bucket->id - 1];
+            rbs_constant_t *constant = rbs_constant_pool_constant(pool, bucket->id);
             free((void *) constant->start);
         }
     }
@@ -0,0 +1,331 @@
+/**
+ *  @file rbs_constant_pool_global.c
+ *
+ *  A constant pool that parsers running on many threads share.
+ *
+ *  Finding a constant doesn't take a lock. The hash map is an array of 64-bit buckets, each of which packs the hash of
+ *  the constant in the upper half and its id in the lower half, so that a reader loads a bucket in one atomic load and
+ *  never sees a half written bucket. A bucket is published only after its constant is written, so a reader that sees
+ *  an id also sees the constant.
+ *
+ *  Inserting a constant takes the lock of the pool, finds the constant again (another thread may have inserted it in
+ *  the meantime), and then publishes it. When the hash map gets too full, it is copied into a bigger one, which is
+ *  published in one atomic store. The old hash maps are kept until the pool is freed, since readers may still be
+ *  probing them. They miss the constants inserted after the resize, but a reader that misses a constant falls back to
+ *  the insertion path, which finds it under the lock.
+ *
+ *  The seeded constants (see `rbs_constant_pool_seeds.h`) are inserted first when the pool is created, so that they get
+ *  their fixed ids and are found in the hash map as the other constants are.
+ *
+ *  The constants are stored in chunks that double in size, and are never moved, so that the ids and the pointers
+ *  returned by `rbs_global_constant_pool_id_to_constant` stay valid until the pool is freed. The bytes of the constants
+ *  are copied into an arena of the pool, since the pool outlives the sources the constants are found in.
+ */
+
+#include "rbs/util/rbs_constant_pool.h"
+#include "rbs/util/rbs_constant_pool_seeds.h"
+#include "rbs/util/rbs_allocator.h"
+#include "rbs/util/rbs_assert.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#define RBS_GLOBAL_POOL_LOCK_WINDOWS
+#elif defined(__wasi__) && !defined(_REENTRANT)
+// WASI without threads: nothing runs concurrently, so the lock is a no-op.
+#define RBS_GLOBAL_POOL_LOCK_NONE
+#else
+#include <pthread.h>
+#define RBS_GLOBAL_POOL_LOCK_PTHREAD
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+// MSVC gives volatile loads acquire semantics, and volatile stores release semantics (/volatile:ms).
+#define RBS_ATOMIC volatile
+#define rbs_atomic_load_acquire(ptr) (*(ptr))
+#define rbs_atomic_store_release(ptr, value) (*(ptr) = (value))
+#else
+#define RBS_ATOMIC
+#define rbs_atomic_load_acquire(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define rbs_atomic_store_release(ptr, value) __atomic_store_n((ptr), (value), __ATOMIC_RELEASE)
+#endif
+
+// The first chunk of constants has this many entries, and each of the following chunks has twice as many as the previous one.
+#define RBS_GLOBAL_POOL_FIRST_CHUNK_BITS 8
+#define RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE (((uint32_t) 1) << RBS_GLOBAL_POOL_FIRST_CHUNK_BITS)
+#define RBS_GLOBAL_POOL_MAX_CHUNKS (32 - RBS_GLOBAL_POOL_FIRST_CHUNK_BITS)
+
+typedef struct {
+    rbs_constant_t constant;
+
+    // The value attached by `rbs_global_constant_pool_set_data`.
+    RBS_ATOMIC uintptr_t data;
+} rbs_global_constant_pool_entry_t;
+
+typedef struct rbs_global_constant_pool_table {
+    // The previous (smaller) table, which is freed with the pool.
+    struct rbs_global_constant_pool_table *retired;
+
+    // The number of buckets, which is a power of two.
+    uint32_t capacity;
+
+    // `(hash << 32) | id`, or 0 if the bucket is empty.
+    RBS_ATOMIC uint64_t buckets[1];
+} rbs_global_constant_pool_table_t;
+
+struct rbs_global_constant_pool {
+    rbs_global_constant_pool_table_t *RBS_ATOMIC table;
+
+    // The number of constants in the pool, which is also the largest id.
+    RBS_ATOMIC uint32_t size;
+
+    rbs_global_constant_pool_entry_t *RBS_ATOMIC chunks[RBS_GLOBAL_POOL_MAX_CHUNKS];
+
+    // The arena for the bytes of the constants.
+    rbs_allocator_t *allocator;
+
+#if defined(RBS_GLOBAL_POOL_LOCK_WINDOWS)
+    SRWLOCK lock;
+#elif defined(RBS_GLOBAL_POOL_LOCK_PTHREAD)
+    pthread_mutex_t lock;
+#endif
+};
+
+static void rbs_global_constant_pool_lock(rbs_global_constant_pool_t *pool) {
+#if defined(RBS_GLOBAL_POOL_LOCK_WINDOWS)
+    AcquireSRWLockExclusive(&pool->lock);
+#elif defined(RBS_GLOBAL_POOL_LOCK_PTHREAD)
+    pthread_mutex_lock(&pool->lock);
+#else
+    (void) pool;
+#endif
+}
+
+static void rbs_global_constant_pool_unlock(rbs_global_constant_pool_t *pool) {
+#if defined(RBS_GLOBAL_POOL_LOCK_WINDOWS)
+    ReleaseSRWLockExclusive(&pool->lock);
+#elif defined(RBS_GLOBAL_POOL_LOCK_PTHREAD)
+    pthread_mutex_unlock(&pool->lock);
+#else
+    (void) pool;
+#endif
+}
+
+static rbs_global_constant_pool_table_t *rbs_global_constant_pool_table_new(uint32_t capacity) {
+    size_t size = offsetof(rbs_global_constant_pool_table_t, buckets) + sizeof(uint64_t) * capacity;
+    rbs_global_constant_pool_table_t *table = (rbs_global_constant_pool_table_t *) calloc(1, size);
+    if (table == NULL) return NULL;
+
+    table->capacity = capacity;
+    return table;
+}
+
+/**
+ * Return the entry of the constant with the given id. The id is 1-based, and
+ * the index `id - 1` is in chunk `k` when it's in
+ * `[FIRST_CHUNK_SIZE * (2^k - 1), FIRST_CHUNK_SIZE * (2^(k+1) - 1))`.
+ */
+static rbs_global_constant_pool_entry_t *rbs_global_constant_pool_entry(const rbs_global_constant_pool_t *pool, rbs_constant_id_t id) {
+    RBS_ASSERT(id != RBS_CONSTANT_ID_UNSET && id <= rbs_atomic_load_acquire(&pool->size), "constant_id is not valid. Got %i", id);
+    uint32_t n = (id - 1) + RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE;
+
+    uint32_t chunk = 0;
+    while ((n >> (chunk + 1)) >= RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE) {
+        chunk++;
+    }
+
+    rbs_global_constant_pool_entry_t *entries = rbs_atomic_load_acquire(&pool->chunks[chunk]);
+    return &entries[n - (RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE << chunk)];
+}
+
+static rbs_constant_id_t rbs_global_constant_pool_lookup(const rbs_global_constant_pool_t *pool, const rbs_global_constant_pool_table_t *table, uint32_t hash, const uint8_t *start, size_t length) {
+    const uint32_t mask = table->capacity - 1;
+    uint32_t index = hash & mask;
+
+    for (;;) {
+        uint64_t bucket = rbs_atomic_load_acquire(&table->buckets[index]);
+        if (bucket == 0) return RBS_CONSTANT_ID_UNSET;
+
+        if ((uint32_t) (bucket >> 32) == hash) {
+            rbs_constant_id_t id = (rbs_constant_id_t) (bucket & 0xffffffff);
+            rbs_constant_t *constant = &rbs_global_constant_pool_entry(pool, id)->constant;
+
+            if (constant->length == length && memcmp(constant->start, start, length) == 0) {
+                return id;
+            }
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+static void rbs_global_constant_pool_table_put(rbs_global_constant_pool_table_t *table, uint64_t bucket) {
+    const uint32_t mask = table->capacity - 1;
+    uint32_t index = (uint32_t) (bucket >> 32) & mask;
+
+    while (table->buckets[index] != 0) {
+        index = (index + 1) & mask;
+    }
+
+    rbs_atomic_store_release(&table->buckets[index], bucket);
+}
+
+/**
+ * Replace the table of the pool with one twice as big. Must be called with the
+ * lock held.
+ */
+static bool rbs_global_constant_pool_grow(rbs_global_constant_pool_t *pool) {
+    rbs_global_constant_pool_table_t *table = pool->table;
+    if (table->capacity >= (((uint32_t) 1) << 31)) return false;
+
+    rbs_global_constant_pool_table_t *next = rbs_global_constant_pool_table_new(table->capacity * 2);
+    if (next == NULL) return false;
+
+    for (uint32_t index = 0; index < table->capacity; index++) {
+        if (table->buckets[index] != 0) {
+            rbs_global_constant_pool_table_put(next, table->buckets[index]);
+        }
+    }
+
+    next->retired = table;
+    rbs_atomic_store_release(&pool->table, next);
+    return true;
+}
+
+rbs_constant_id_t rbs_global_constant_pool_find(const rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length) {
+    return rbs_global_constant_pool_find_with_hash(pool, start, length, rbs_constant_pool_hash(start, length));
+}
+
+rbs_constant_id_t rbs_global_constant_pool_find_with_hash(const rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash) {
+    return rbs_global_constant_pool_lookup(pool, rbs_atomic_load_acquire(&pool->table), hash, start, length);
+}
+
+/**
+ * Append a new constant to the pool, and return its id, or 0 if the allocation
+ * fails. The bytes are copied unless `copy` is false, for the seeded constants
+ * that are static. Must be called with the lock held.
+ */
+static rbs_constant_id_t rbs_global_constant_pool_append(rbs_global_constant_pool_t *pool, uint32_t hash, const uint8_t *start, size_t length, bool copy) {
+    if (pool->size >= pool->table->capacity / 4 * 3 && !rbs_global_constant_pool_grow(pool)) return RBS_CONSTANT_ID_UNSET;
+
+    uint32_t n = pool->size + RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE;
+    uint32_t chunk = 0;
+    while ((n >> (chunk + 1)) >= RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE) {
+        chunk++;
+    }
+
+    if (pool->chunks[chunk] == NULL) {
+        rbs_global_constant_pool_entry_t *entries = (rbs_global_constant_pool_entry_t *) calloc(RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE << chunk, sizeof(rbs_global_constant_pool_entry_t));
+        if (entries == NULL) return RBS_CONSTANT_ID_UNSET;
+        rbs_atomic_store_release(&pool->chunks[chunk], entries);
+    }
+
+    if (copy) {
+        uint8_t *bytes = rbs_allocator_alloc_many(pool->allocator, length > 0 ? length : 1, uint8_t);
+        memcpy(bytes, start, length);
+        start = bytes;
+    }
+
+    rbs_global_constant_pool_entry_t *entry = &pool->chunks[chunk][n - (RBS_GLOBAL_POOL_FIRST_CHUNK_SIZE << chunk)];
+    entry->constant = (rbs_constant_t) { .start = start, .length = length };
+
+    rbs_constant_id_t id = pool->size + 1;
+    rbs_atomic_store_release(&pool->size, id);
+
+    // Publishing the bucket makes the constant visible to the readers.
+    rbs_global_constant_pool_table_put(pool->table, ((uint64_t) hash << 32) | id);
+
+    return id;
+}
+
+rbs_constant_id_t rbs_global_constant_pool_insert(rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length) {
+    return rbs_global_constant_pool_insert_with_hash(pool, start, length, rbs_constant_pool_hash(start, length));
+}
+
+rbs_constant_id_t rbs_global_constant_pool_insert_with_hash(rbs_global_constant_pool_t *pool, const uint8_t *start, size_t length, uint32_t hash) {
+    rbs_constant_id_t id = rbs_global_constant_pool_lookup(pool, rbs_atomic_load_acquire(&pool->table), hash, start, length);
+    if (id != RBS_CONSTANT_ID_UNSET) return id;
+
+    rbs_global_constant_pool_lock(pool);
+
+    // Another thread may have inserted the constant since the lookup above.
+    id = rbs_global_constant_pool_lookup(pool, pool->table, hash, start, length);
+    if (id == RBS_CONSTANT_ID_UNSET) {
+        id = rbs_global_constant_pool_append(pool, hash, start, length, true);
+    }
+
+    rbs_global_constant_pool_unlock(pool);
+    return id;
+}
+
+rbs_global_constant_pool_t *rbs_global_constant_pool_new(uint32_t capacity) {
+    uint32_t table_capacity = 16;
+    while (table_capacity < capacity && table_capacity < (((uint32_t) 1) << 31)) {
+        table_capacity *= 2;
+    }
+
+    rbs_global_constant_pool_t *pool = (rbs_global_constant_pool_t *) calloc(1, sizeof(rbs_global_constant_pool_t));
+    if (pool == NULL) return NULL;
+
+    pool->table = rbs_global_constant_pool_table_new(table_capacity);
+    if (pool->table == NULL) {
+        free(pool);
+        return NULL;
+    }
+
+    pool->allocator = rbs_allocator_init();
+
+#if defined(RBS_GLOBAL_POOL_LOCK_WINDOWS)
+    InitializeSRWLock(&pool->lock);
+#elif defined(RBS_GLOBAL_POOL_LOCK_PTHREAD)
+    pthread_mutex_init(&pool->lock, NULL);
+#endif
+
+    for (size_t index = 0; index < RBS_CONSTANT_POOL_SEED_COUNT; index++) {
+        const rbs_constant_t *seed = &rbs_constant_pool_seeds[index];
+        if (rbs_global_constant_pool_append(pool, rbs_constant_pool_hash(seed->start, seed->length), seed->start, seed->length, false) == RBS_CONSTANT_ID_UNSET) {
+            rbs_global_constant_pool_free(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+rbs_constant_t *rbs_global_constant_pool_id_to_constant(const rbs_global_constant_pool_t *pool, rbs_constant_id_t constant_id) {
+    return &rbs_global_constant_pool_entry(pool, constant_id)->constant;
+}
+
+uint32_t rbs_global_constant_pool_size(const rbs_global_constant_pool_t *pool) {
+    return rbs_atomic_load_acquire(&pool->size);
+}
+
+uintptr_t rbs_global_constant_pool_get_data(const rbs_global_constant_pool_t *pool, rbs_constant_id_t constant_id) {
+    return rbs_atomic_load_acquire(&rbs_global_constant_pool_entry(pool, constant_id)->data);
+}
+
+void rbs_global_constant_pool_set_data(rbs_global_constant_pool_t *pool, rbs_constant_id_t constant_id, uintptr_t data) {
+    rbs_atomic_store_release(&rbs_global_constant_pool_entry(pool, constant_id)->data, data);
+}
+
+void rbs_global_constant_pool_free(rbs_global_constant_pool_t *pool) {
+    rbs_global_constant_pool_table_t *table = pool->table;
+    while (table) {
+        rbs_global_constant_pool_table_t *retired = table->retired;
+        free(table);
+        table = retired;
+    }
+
+    for (size_t chunk = 0; chunk < RBS_GLOBAL_POOL_MAX_CHUNKS; chunk++) {
+        free(pool->chunks[chunk]);
+    }
+
+    rbs_allocator_free(pool->allocator);
+
+#if defined(RBS_GLOBAL_POOL_LOCK_WINDOWS)
+    // SRWLOCKs don't need to be destroyed.
+#elif defined(RBS_GLOBAL_POOL_LOCK_PTHREAD)
+    pthread_mutex_destroy(&pool->lock);
+#endif
+
+    free(pool);
+}
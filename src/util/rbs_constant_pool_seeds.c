@@ -0,0 +1,288 @@
+/*----------------------------------------------------------------------------*/
+/* This file is generated by the templates/template.rb script and should not  */
+/* be modified manually.                                                      */
+/* To change the template see                                                 */
+/* templates/src/util/rbs_constant_pool_seeds.c.erb                           */
+/*----------------------------------------------------------------------------*/
+
+#include "rbs/util/rbs_constant_pool_seeds.h"
+
+const rbs_constant_t rbs_constant_pool_seeds[RBS_CONSTANT_POOL_SEED_COUNT] = {
+    { (const uint8_t *) "alias", 5 },            // 1
+    { (const uint8_t *) "attr_accessor", 13 },   // 2
+    { (const uint8_t *) "attr_reader", 11 },     // 3
+    { (const uint8_t *) "attr_writer", 11 },     // 4
+    { (const uint8_t *) "bool", 4 },             // 5
+    { (const uint8_t *) "bot", 3 },              // 6
+    { (const uint8_t *) "class", 5 },            // 7
+    { (const uint8_t *) "class-alias", 11 },     // 8
+    { (const uint8_t *) "def", 3 },              // 9
+    { (const uint8_t *) "end", 3 },              // 10
+    { (const uint8_t *) "extend", 6 },           // 11
+    { (const uint8_t *) "false", 5 },            // 12
+    { (const uint8_t *) "in", 2 },               // 13
+    { (const uint8_t *) "include", 7 },          // 14
+    { (const uint8_t *) "instance", 8 },         // 15
+    { (const uint8_t *) "interface", 9 },        // 16
+    { (const uint8_t *) "module", 6 },           // 17
+    { (const uint8_t *) "module-alias", 12 },    // 18
+    { (const uint8_t *) "nil", 3 },              // 19
+    { (const uint8_t *) "out", 3 },              // 20
+    { (const uint8_t *) "prepend", 7 },          // 21
+    { (const uint8_t *) "private", 7 },          // 22
+    { (const uint8_t *) "public", 6 },           // 23
+    { (const uint8_t *) "self", 4 },             // 24
+    { (const uint8_t *) "singleton", 9 },        // 25
+    { (const uint8_t *) "top", 3 },              // 26
+    { (const uint8_t *) "true", 4 },             // 27
+    { (const uint8_t *) "type", 4 },             // 28
+    { (const uint8_t *) "unchecked", 9 },        // 29
+    { (const uint8_t *) "untyped", 7 },          // 30
+    { (const uint8_t *) "void", 4 },             // 31
+    { (const uint8_t *) "use", 3 },              // 32
+    { (const uint8_t *) "as", 2 },               // 33
+    { (const uint8_t *) "__todo__", 8 },         // 34
+    { (const uint8_t *) "@rbs", 4 },             // 35
+    { (const uint8_t *) "skip", 4 },             // 36
+    { (const uint8_t *) "return", 6 },           // 37
+    { (const uint8_t *) "module-self", 11 },     // 38
+    { (const uint8_t *) "BasicObject", 11 },     // 39
+    { (const uint8_t *) "Object", 6 },           // 40
+    { (const uint8_t *) "Kernel", 6 },           // 41
+    { (const uint8_t *) "String", 6 },           // 42
+    { (const uint8_t *) "Comparable", 10 },      // 43
+    { (const uint8_t *) "Enumerable", 10 },      // 44
+    { (const uint8_t *) "Class", 5 },            // 45
+    { (const uint8_t *) "Module", 6 },           // 46
+    { (const uint8_t *) "Array", 5 },            // 47
+    { (const uint8_t *) "Hash", 4 },             // 48
+    { (const uint8_t *) "Range", 5 },            // 49
+    { (const uint8_t *) "Enumerator", 10 },      // 50
+    { (const uint8_t *) "Set", 3 },              // 51
+    { (const uint8_t *) "Symbol", 6 },           // 52
+    { (const uint8_t *) "Integer", 7 },          // 53
+    { (const uint8_t *) "Float", 5 },            // 54
+    { (const uint8_t *) "Regexp", 6 },           // 55
+    { (const uint8_t *) "TrueClass", 9 },        // 56
+    { (const uint8_t *) "FalseClass", 10 },      // 57
+    { (const uint8_t *) "Numeric", 7 },          // 58
+    { (const uint8_t *) "NilClass", 8 },         // 59
+    { (const uint8_t *) "Proc", 4 },             // 60
+    { (const uint8_t *) "Exception", 9 },        // 61
+    { (const uint8_t *) "StandardError", 13 },   // 62
+    { (const uint8_t *) "IO", 2 },               // 63
+    { (const uint8_t *) "File", 4 },             // 64
+    { (const uint8_t *) "Time", 4 },             // 65
+    { (const uint8_t *) "Encoding", 8 },         // 66
+    { (const uint8_t *) "Rational", 8 },         // 67
+    { (const uint8_t *) "Complex", 7 },          // 68
+    { (const uint8_t *) "Thread", 6 },           // 69
+    { (const uint8_t *) "Method", 6 },           // 70
+    { (const uint8_t *) "Process", 7 },          // 71
+    { (const uint8_t *) "Errno", 5 },            // 72
+    { (const uint8_t *) "MatchData", 9 },        // 73
+    { (const uint8_t *) "Struct", 6 },           // 74
+    { (const uint8_t *) "T", 1 },                // 75
+    { (const uint8_t *) "U", 1 },                // 76
+    { (const uint8_t *) "V", 1 },                // 77
+    { (const uint8_t *) "K", 1 },                // 78
+    { (const uint8_t *) "E", 1 },                // 79
+    { (const uint8_t *) "A", 1 },                // 80
+    { (const uint8_t *) "R", 1 },                // 81
+    { (const uint8_t *) "X", 1 },                // 82
+    { (const uint8_t *) "Y", 1 },                // 83
+    { (const uint8_t *) "N", 1 },                // 84
+    { (const uint8_t *) "Elem", 4 },             // 85
+    { (const uint8_t *) "Return", 6 },           // 86
+    { (const uint8_t *) "boolish", 7 },          // 87
+    { (const uint8_t *) "string", 6 },           // 88
+    { (const uint8_t *) "int", 3 },              // 89
+    { (const uint8_t *) "interned", 8 },         // 90
+    { (const uint8_t *) "_ToS", 4 },             // 91
+    { (const uint8_t *) "_ToStr", 6 },           // 92
+    { (const uint8_t *) "_ToInt", 6 },           // 93
+    { (const uint8_t *) "_ToAry", 6 },           // 94
+    { (const uint8_t *) "_ToHash", 7 },          // 95
+    { (const uint8_t *) "_ToProc", 7 },          // 96
+    { (const uint8_t *) "_Each", 5 },            // 97
+    { (const uint8_t *) "_Reader", 7 },          // 98
+    { (const uint8_t *) "_Writer", 7 },          // 99
+    { (const uint8_t *) "initialize", 10 },      // 100
+    { (const uint8_t *) "initialize_copy", 15 }, // 101
+    { (const uint8_t *) "to_s", 4 },             // 102
+    { (const uint8_t *) "to_a", 4 },             // 103
+    { (const uint8_t *) "to_i", 4 },             // 104
+    { (const uint8_t *) "to_h", 4 },             // 105
+    { (const uint8_t *) "to_str", 6 },           // 106
+    { (const uint8_t *) "to_ary", 6 },           // 107
+    { (const uint8_t *) "to_proc", 7 },          // 108
+    { (const uint8_t *) "to_sym", 6 },           // 109
+    { (const uint8_t *) "inspect", 7 },          // 110
+    { (const uint8_t *) "hash", 4 },             // 111
+    { (const uint8_t *) "eql?", 4 },             // 112
+    { (const uint8_t *) "==", 2 },               // 113
+    { (const uint8_t *) "===", 3 },              // 114
+    { (const uint8_t *) "<=>", 3 },              // 115
+    { (const uint8_t *) "[]", 2 },               // 116
+    { (const uint8_t *) "[]=", 3 },              // 117
+    { (const uint8_t *) "<<", 2 },               // 118
+    { (const uint8_t *) "+", 1 },                // 119
+    { (const uint8_t *) "-", 1 },                // 120
+    { (const uint8_t *) "each", 4 },             // 121
+    { (const uint8_t *) "size", 4 },             // 122
+    { (const uint8_t *) "length", 6 },           // 123
+    { (const uint8_t *) "new", 3 },              // 124
+    { (const uint8_t *) "call", 4 },             // 125
+    { (const uint8_t *) "name", 4 },             // 126
+    { (const uint8_t *) "value", 5 },            // 127
+    { (const uint8_t *) "key", 3 },              // 128
+    { (const uint8_t *) "other", 5 },            // 129
+    { (const uint8_t *) "args", 4 },             // 130
+    { (const uint8_t *) "arg", 3 },              // 131
+    { (const uint8_t *) "path", 4 },             // 132
+    { (const uint8_t *) "obj", 3 },              // 133
+    { (const uint8_t *) "str", 3 },              // 134
+    { (const uint8_t *) "data", 4 },             // 135
+    { (const uint8_t *) "mode", 4 },             // 136
+    { (const uint8_t *) "options", 7 },          // 137
+    { (const uint8_t *) "block", 5 },            // 138
+    { (const uint8_t *) "index", 5 },            // 139
+    { (const uint8_t *) "count", 5 },            // 140
+    { (const uint8_t *) "freeze", 6 },           // 141
+    { (const uint8_t *) "dup", 3 },              // 142
+    { (const uint8_t *) "message", 7 },          // 143
+    { (const uint8_t *) "close", 5 },            // 144
+    { (const uint8_t *) "read", 4 },             // 145
+    { (const uint8_t *) "write", 5 },            // 146
+};
+
+const uint8_t rbs_constant_pool_seed_slots[RBS_CONSTANT_POOL_SEED_SLOTS] = {
+    0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    105, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 28, 139, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 58, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97,
+    0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 90, 0, 82, 0, 0, 140, 0, 0, 59, 0, 12, 0, 0,
+    0, 0, 62, 0, 0, 0, 0, 0, 104, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0,
+    0, 78, 95, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 115, 0, 0, 68, 0, 0, 51, 0,
+    0, 0, 0, 0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96,
+    0, 0, 0, 0, 0, 27, 0, 6, 9, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 81, 0, 0,
+    0, 69, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 29, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 138, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 36, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 83, 0, 11, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    34, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 145, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 23, 89, 0, 0, 33, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 119, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 143, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 133, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 132, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 136, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 85, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0,
+    0, 0, 87, 0, 0, 0, 0, 0, 0, 0, 0, 0, 61, 0, 0, 0,
+    0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 64, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 67, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 0, 0, 42, 0, 44, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 75, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 127, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 98, 0, 46, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 110, 0, 0, 0,
+    0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 93, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 109, 0,
+    0, 0, 0, 100, 0, 0, 25, 0, 0, 80, 91, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 63, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 92, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 118, 0, 0, 0, 0, 0,
+    0, 142, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 24, 0, 0, 0,
+    41, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 0,
+    0, 0, 101, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 0, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 131, 0, 0, 102, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 126, 146, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 113, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 70, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 53, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0,
+    72, 0, 124, 0, 123, 0, 48, 0, 66, 0, 49, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 65, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
@@ -0,0 +1,196 @@
+#include "rbs/util/rbs_scan.h"
+
+#include <stdbool.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define RBS_SCAN_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RBS_SCAN_SSE2
+#elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define RBS_SCAN_NEON
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+static inline bool ascii_p(uint8_t c) {
+    return c < 0x80;
+}
+
+static inline bool space_p(uint8_t c) {
+    return c == ' ' || c == '\t';
+}
+
+static inline bool comment_p(uint8_t c) {
+    return c != '\n' && c != '\0' && c < 0x80;
+}
+
+static inline bool word_p(uint8_t c) {
+    return (uint8_t) ((c | 0x20) - 'a') < 26 || (uint8_t) (c - '0') < 10 || c == '_';
+}
+
+#if defined(RBS_SCAN_AVX2) || defined(RBS_SCAN_SSE2) || defined(RBS_SCAN_NEON)
+
+// A block is scanned into a mask with a bit (or, with NEON, a nibble) set for each byte that ends the run, so the run is
+// as long as the count of trailing zeros.
+
+static inline unsigned int rbs_scan_ctz(uint64_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+#if defined(_M_IX86)
+    _BitScanForward(&index, (unsigned long) mask); // The masks of SSE2 fit in 16 bits
+#else
+    _BitScanForward64(&index, mask);
+#endif
+    return (unsigned int) index;
+#else
+    return (unsigned int) __builtin_ctzll(mask);
+#endif
+}
+
+#if defined(RBS_SCAN_AVX2)
+
+#define RBS_SCAN_BLOCK 32
+#define RBS_SCAN_RUN(mask) rbs_scan_ctz(mask)
+
+static inline uint64_t ascii_stop(const uint8_t *p) {
+    return (uint64_t) (uint32_t) _mm256_movemask_epi8(_mm256_loadu_si256((const __m256i *) p));
+}
+
+static inline uint64_t spaces_stop(const uint8_t *p) {
+    __m256i v = _mm256_loadu_si256((const __m256i *) p);
+    __m256i space = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+    return (uint64_t) (uint32_t) ~_mm256_movemask_epi8(space);
+}
+
+static inline uint64_t comment_stop(const uint8_t *p) {
+    __m256i v = _mm256_loadu_si256((const __m256i *) p);
+    __m256i stop = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_setzero_si256()));
+    // The sign bit of a byte is set for the bytes outside ASCII.
+    return (uint64_t) (uint32_t) _mm256_movemask_epi8(_mm256_or_si256(stop, v));
+}
+
+static inline uint64_t word_stop(const uint8_t *p) {
+    // The signed comparisons put the bytes outside ASCII below every range.
+    __m256i v = _mm256_loadu_si256((const __m256i *) p);
+    __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    __m256i letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    __m256i underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+    __m256i word = _mm256_or_si256(_mm256_or_si256(letter, digit), underscore);
+    return (uint64_t) (uint32_t) ~_mm256_movemask_epi8(word);
+}
+
+#elif defined(RBS_SCAN_SSE2)
+
+#define RBS_SCAN_BLOCK 16
+#define RBS_SCAN_RUN(mask) rbs_scan_ctz(mask)
+
+static inline uint64_t ascii_stop(const uint8_t *p) {
+    return (uint64_t) _mm_movemask_epi8(_mm_loadu_si128((const __m128i *) p));
+}
+
+static inline uint64_t spaces_stop(const uint8_t *p) {
+    __m128i v = _mm_loadu_si128((const __m128i *) p);
+    __m128i space = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+    return (uint64_t) (~_mm_movemask_epi8(space) & 0xffff);
+}
+
+static inline uint64_t comment_stop(const uint8_t *p) {
+    __m128i v = _mm_loadu_si128((const __m128i *) p);
+    __m128i stop = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_setzero_si128()));
+    // The sign bit of a byte is set for the bytes outside ASCII.
+    return (uint64_t) _mm_movemask_epi8(_mm_or_si128(stop, v));
+}
+
+static inline uint64_t word_stop(const uint8_t *p) {
+    // The signed comparisons put the bytes outside ASCII below every range.
+    __m128i v = _mm_loadu_si128((const __m128i *) p);
+    __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    __m128i underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    __m128i word = _mm_or_si128(_mm_or_si128(letter, digit), underscore);
+    return (uint64_t) (~_mm_movemask_epi8(word) & 0xffff);
+}
+
+#elif defined(RBS_SCAN_NEON)
+
+#define RBS_SCAN_BLOCK 16
+#define RBS_SCAN_RUN(mask) (rbs_scan_ctz(mask) >> 2)
+
+// NEON has no movemask, so narrow each byte of the comparison to a nibble.
+static inline uint64_t neon_mask(uint8x16_t match) {
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+}
+
+static inline uint64_t ascii_stop(const uint8_t *p) {
+    return neon_mask(vcgeq_u8(vld1q_u8(p), vdupq_n_u8(0x80)));
+}
+
+static inline uint64_t spaces_stop(const uint8_t *p) {
+    uint8x16_t v = vld1q_u8(p);
+    uint8x16_t space = vorrq_u8(vceqq_u8(v, vdupq_n_u8(' ')), vceqq_u8(v, vdupq_n_u8('\t')));
+    return neon_mask(vmvnq_u8(space));
+}
+
+static inline uint64_t comment_stop(const uint8_t *p) {
+    uint8x16_t v = vld1q_u8(p);
+    uint8x16_t stop = vorrq_u8(vceqq_u8(v, vdupq_n_u8('\n')), vceqq_u8(v, vdupq_n_u8(0)));
+    return neon_mask(vorrq_u8(stop, vcgeq_u8(v, vdupq_n_u8(0x80))));
+}
+
+static inline uint64_t word_stop(const uint8_t *p) {
+    uint8x16_t v = vld1q_u8(p);
+    uint8x16_t letter = vcleq_u8(vsubq_u8(vorrq_u8(v, vdupq_n_u8(0x20)), vdupq_n_u8('a')), vdupq_n_u8(25));
+    uint8x16_t digit = vcleq_u8(vsubq_u8(v, vdupq_n_u8('0')), vdupq_n_u8(9));
+    uint8x16_t underscore = vceqq_u8(v, vdupq_n_u8('_'));
+    return neon_mask(vmvnq_u8(vorrq_u8(vorrq_u8(letter, digit), underscore)));
+}
+
+#endif
+
+#define RBS_SCAN_BLOCKS(p, end, stop)                                      \
+    while ((end) - (p) >= RBS_SCAN_BLOCK) {                                \
+        uint64_t mask = stop(p);                                           \
+        if (mask != 0) return (size_t) ((p) - start) + RBS_SCAN_RUN(mask); \
+        (p) += RBS_SCAN_BLOCK;                                             \
+    }
+
+#else
+
+#define RBS_SCAN_BLOCKS(p, end, stop)
+
+#endif
+
+size_t rbs_scan_ascii(const uint8_t *start, const uint8_t *end) {
+    const uint8_t *p = start;
+    RBS_SCAN_BLOCKS(p, end, ascii_stop)
+    while (p < end && ascii_p(*p)) p++;
+    return (size_t) (p - start);
+}
+
+size_t rbs_scan_spaces(const uint8_t *start, const uint8_t *end) {
+    const uint8_t *p = start;
+    RBS_SCAN_BLOCKS(p, end, spaces_stop)
+    while (p < end && space_p(*p)) p++;
+    return (size_t) (p - start);
+}
+
+size_t rbs_scan_comment(const uint8_t *start, const uint8_t *end) {
+    const uint8_t *p = start;
+    RBS_SCAN_BLOCKS(p, end, comment_stop)
+    while (p < end && comment_p(*p)) p++;
+    return (size_t) (p - start);
+}
+
+size_t rbs_scan_word(const uint8_t *start, const uint8_t *end) {
+    const uint8_t *p = start;
+    RBS_SCAN_BLOCKS(p, end, word_stop)
+    while (p < end && word_p(*p)) p++;
+    return (size_t) (p - start);
+}
@@ -273,6 +273,79 @@ module RBS
       end
     end
 
+    # The names that every constant pool starts with (`constants:` in config.yml)
+    #
+    # The names get the fixed ids `1..names.size`, in the order of the config, and are found with a perfect hash:
+    # a key is packed from the length and three bytes of a name, and `(key * multiplier) >> (32 - bits)` is the
+    # index of the name in a table of `2**bits` slots, which never collide.
+    #
+    class ConstantSeeds
+      attr_reader :names #: Array[String]
+
+      attr_reader :bits #: Integer
+
+      attr_reader :multiplier #: Integer
+
+      def initialize(names:)
+        @names = names
+        @keys = names_to_keys(names)
+        @bits, @multiplier = search_perfect_hash
+      end
+
+      def each_name
+        names.each.with_index(1) do |name, id|
+          yield name, id
+        end
+      end
+
+      def max_length #: Integer
+        names.map(&:bytesize).max || 0
+      end
+
+      # The id of the name in each slot of the table, or `0` for an empty slot
+      def slots #: Array[Integer]
+        slots = Array.new(2**bits, 0)
+        @keys.each.with_index(1) do |key, id|
+          slots[index(key, bits, multiplier)] = id
+        end
+        slots
+      end
+
+      private
+
+      def names_to_keys(names)
+        keys = {} #: Hash[Integer, String]
+        names.each do |name|
+          raise "Constant seeds must be ASCII: #{name.inspect}" unless name.ascii_only? && !name.empty?
+
+          bytes = name.bytes
+          key = bytes.size | (bytes[0] << 8) | (bytes[bytes.size / 2] << 16) | (bytes[-1] << 24)
+          if other = keys[key]
+            raise "Constant seeds `#{other}` and `#{name}` have the same length and the same first, middle, and last bytes"
+          end
+          keys[key] = name
+        end
+        keys.keys
+      end
+
+      def index(key, bits, multiplier)
+        ((key * multiplier) & 0xffffffff) >> (32 - bits)
+      end
+
+      # Searches the multipliers in a fixed order, so that the generated table doesn't change unless the names change.
+      def search_perfect_hash
+        bits = [(names.size * 2).bit_length + 2, 4].max
+        loop do
+          (1..1_000_000).each do |i|
+            multiplier = ((i * 0x9e3779b1) & 0xffffffff) | 1
+            indexes = @keys.map { index(_1, bits, multiplier) }
+            return [bits, multiplier] if indexes.uniq.size == indexes.size
+          end
+          bits += 1
+        end
+      end
+    end
+
     class << self
       def render(out_file)
         filepath = "templates/#{out_file}.erb"
@@ -406,6 +479,7 @@ module RBS
           nodes: sorted_nodes,
           enums: enum_desc,
           annotation_nodes: annotation_nodes,
+          constant_seeds: ConstantSeeds.new(names: config.fetch("constants", []).map(&:to_s)),
         }
       end
     end
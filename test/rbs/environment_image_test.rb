@@ -0,0 +1,130 @@
+require "test_helper"
+
+class RBS::EnvironmentImageTest < Test::Unit::TestCase
+  include TestHelper
+
+  EnvironmentImage = RBS::EnvironmentImage
+  EnvironmentLoader = RBS::EnvironmentLoader
+  TypeName = RBS::TypeName
+
+  def mktmpdir
+    Dir.mktmpdir do |path|
+      yield Pathname(path)
+    end
+  end
+
+  def write_signatures(path:)
+    path.join("person.rbs").write(<<~RBS)
+      # resolve-type-names: false
+
+      # A person
+      class Person
+        class Name
+        end
+
+        type id = Integer
+
+        def name: () -> Name
+      end
+
+      interface _Named
+        def name: () -> String
+      end
+    RBS
+
+    path.join("account.rbs").write(<<~RBS)
+      class Account = Person
+
+      ACCOUNTS: Array[Account]
+
+      $account: Account
+    RBS
+  end
+
+  def test_declarations
+    mktmpdir do |path|
+      write_signatures(path: path)
+
+      loader = EnvironmentLoader.new(core_root: nil)
+      loader.add(path: path)
+      EnvironmentImage.write(path + "env.image", loader)
+
+      image = EnvironmentImage.load(path + "env.image")
+
+      assert_equal(
+        ["::Account", "::ACCOUNTS", "::Person", "::Person::Name", "::Person::id", "::_Named"].sort,
+        image.type_names.map(&:to_s).sort
+      )
+
+      image.declarations(TypeName.parse("::Person::Name")).tap do |decls|
+        assert_equal 1, decls.size
+        assert_instance_of RBS::AST::Declarations::Class, decls[0]
+        assert_equal TypeName.parse("Person"), decls[0].name
+        assert_equal "A person\n", decls[0].comment.string
+        assert_equal "class Person", decls[0].location.source.lines.first.chomp
+      end
+
+      assert_same image.declarations(TypeName.parse("::Person"))[0], image.declarations(TypeName.parse("::Person::id"))[0]
+      assert_equal [], image.declarations(TypeName.parse("::Unknown"))
+    end
+  end
+
+  def test_load
+    mktmpdir do |path|
+      write_signatures(path: path)
+
+      loader = EnvironmentLoader.new(core_root: nil)
+      loader.add(path: path)
+      EnvironmentImage.write(path + "env.image", loader)
+
+      env = RBS::Environment.new
+      loaded = EnvironmentImage.load(path + "env.image").load(env: env)
+
+      expected_env = RBS::Environment.new
+      expected_loaded = loader.load(env: expected_env)
+
+      assert_equal expected_loaded, loaded
+      assert_equal expected_env.declarations, env.declarations
+      assert_equal expected_env.sources.map { _1.buffer.content }, env.sources.map { _1.buffer.content }
+      assert_equal(
+        expected_env.sources.map { |source| source.directives.map(&:class) },
+        env.sources.map { |source| source.directives.map(&:class) }
+      )
+      assert_operator env.global_decls, :key?, :$account
+
+      env.resolve_type_names
+    end
+  end
+
+  def test_invalid_image
+    assert_raises EnvironmentImage::InvalidImageError do
+      EnvironmentImage.new("not an image")
+    end
+
+    mktmpdir do |path|
+      loader = EnvironmentLoader.new(core_root: nil)
+      loader.add(path: path)
+      bytes = EnvironmentImage.build(loader)
+
+      assert_raises EnvironmentImage::InvalidImageError do
+        EnvironmentImage.new(bytes.byteslice(0, bytes.bytesize - 2))
+      end
+    end
+  end
+
+  def test_truncated_image
+    mktmpdir do |path|
+      write_signatures(path: path)
+
+      loader = EnvironmentLoader.new(core_root: nil)
+      loader.add(path: path)
+      bytes = EnvironmentImage.build(loader)
+
+      # The tables are complete, but the last blobs are cut short.
+      image = EnvironmentImage.new(bytes.byteslice(0, bytes.bytesize - 2))
+      assert_raises EnvironmentImage::InvalidImageError do
+        image.load(env: RBS::Environment.new)
+      end
+    end
+  end
+end
@@ -70,6 +70,61 @@ end
     end
   end
 
+  def test_loading_dir_with_cache
+    mktmpdir do |path|
+      write_signatures(path: path)
+
+      mktmpdir do |cache_dir|
+        2.times do
+          loader = EnvironmentLoader.new(core_root: nil, cache: RBS::SignatureCache.new(cache_dir))
+          loader.add(path: path)
+
+          env = Environment.new
+          loader.load(env: env)
+
+          assert_operator env.class_decls, :key?, RBS::TypeName.parse("::Person")
+          assert_operator env.class_decls, :key?, RBS::TypeName.parse("::PeopleController")
+          assert_operator env.class_decls, :key?, RBS::TypeName.parse("::Person::Internal")
+        end
+
+        assert_equal 3, cache_dir.glob("**/*").count(&:file?)
+      end
+    end
+  end
+
+  def test_loading_lazy_overloads
+    mktmpdir do |path|
+      (path + "a.rbs").write("class A\n  def foo: () -> void\nend\n")
+
+      [false, true].each do |lazy|
+        loader = EnvironmentLoader.new(core_root: nil, lazy_overloads: lazy)
+        loader.add(path: path)
+
+        decl = loader.load(env: Environment.new)[0][0]
+        overloads = decl.members[0].instance_variable_get(:@overloads)
+
+        assert_equal lazy, overloads.is_a?(RBS::AST::Members::MethodDefinition::LazyOverloads)
+        assert_equal "() -> void", decl.members[0].overloads[0].method_type.to_s
+      end
+
+      (path + "b.rbs").write("class B\n  def foo: () -> Array[\nend\n")
+
+      loader = EnvironmentLoader.new(core_root: nil, lazy_overloads: true)
+      loader.add(path: path)
+      error = assert_raises(RBS::ParsingError) { loader.load(env: Environment.new) }
+      assert_equal "b.rbs", Pathname(error.location.buffer.name).basename.to_s
+    end
+  end
+
+  def test_each_buffer_without_side_effects
+    loader = EnvironmentLoader.new
+    loader.each_buffer { }
+    assert_empty loader.libs
+
+    loader.load(env: Environment.new)
+    assert_equal ["stringio"], loader.libs.map(&:name)
+  end
+
   def test_loading_stdlib
     mktmpdir do |path|
       loader = EnvironmentLoader.new
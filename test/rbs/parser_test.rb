@@ -469,6 +469,23 @@ class RBS::ParserTest < Test::Unit::TestCase
     end
   end
 
+  def test_parse_comment_after_multiline_tokens
+    RBS::Parser.parse_signature(buffer(<<~RBS)).tap do |_, _, decls|
+        class Foo
+          # Comment of foo
+          %a{multi
+             line}
+          def foo: () -> "multi
+                          line"
+          # Comment of bar
+          def bar: () -> void
+        end
+      RBS
+
+      assert_equal ["Comment of foo\n", "Comment of bar\n"], decls[0].members.map { _1.comment.string }
+    end
+  end
+
   def test_lex_error
     assert_raises do
       RBS::Parser.parse_signature(buffer("@"))
@@ -711,6 +728,21 @@ class RBS::ParserTest < Test::Unit::TestCase
     end
   end
 
+  def test_many_keywords
+    keywords = (1..30).map { "k#{_1}: top" }
+
+    RBS::Parser.parse_method_type(buffer("(#{keywords.join(", ")}, ?o: top) -> void")).tap do |method_type|
+      assert_equal [*(1..30).map { :"k#{_1}" }], method_type.type.required_keywords.keys
+      assert_equal [:o], method_type.type.optional_keywords.keys
+    end
+
+    assert_raises RBS::ParsingError do
+      RBS::Parser.parse_method_type(buffer("(#{keywords.join(", ")}, ?k17: top) -> void"))
+    end.tap do |exn|
+      assert_match(/duplicated keyword argument, token=`k17`/, exn.message)
+    end
+  end
+
   def test_duplicate_keyword
     RBS::Parser.parse_method_type(buffer("(top foo, foo: top) -> void")).tap do |method_type|
       assert_equal "top foo, foo: top", method_type.type.param_to_s
@@ -1064,6 +1096,179 @@ class RBS::ParserTest < Test::Unit::TestCase
     assert_equal [:pEOF, '', 60...60], tokens.shift.then { |t| [t[0], t[1].source, t[1].range] }
   end
 
+  def test_lex_packed
+    content = "# Comment\nclass Foo # 🐈\nend"
+    tokens = RBS::Parser.lex_packed(content)
+
+    assert_equal RBS::Parser._lex(buffer(content), content.bytesize).map { [_1, _2.range] }, tokens.map { [_1.type, _1.location.range] }
+    assert_equal [:tLINECOMMENT, :tTRIVIA, :kCLASS, :tTRIVIA, :tUIDENT, :tTRIVIA, :tCOMMENT, :tTRIVIA, :kEND, :pEOF], tokens.types
+
+    assert_equal 10, tokens.size
+    assert_equal :tCOMMENT, tokens.type(6)
+    assert_equal 20...23, tokens.range(6)
+    assert_equal "# 🐈", tokens[6].value
+    assert_equal :pEOF, tokens[-1].type
+    assert_nil tokens[10]
+    assert_raises(IndexError) { tokens.type(10) }
+  end
+
+  def test_relex
+    content = "class Foo\n  def foo: () -> void\nend\n\nclass Bar # 🐈\nend\n"
+    tokens = RBS::Parser.lex_packed(content)
+
+    [
+      ["def foo", "def foo_bar"],
+      ["class Foo\n", "class Foo\n  %a{\n"],
+      ["# 🐈", "# 🐈🐈"],
+      ["Bar", "\"Bar"],
+      ["\nend\n\n", "\n"],
+    ].each do |old_text, new_text|
+      start_byte = content.b.index(old_text.b) or raise
+      new_content = content.byteslice(0, start_byte) + new_text + content.byteslice(start_byte + old_text.bytesize..)
+
+      relexed = RBS::Parser.relex(tokens, new_content, start_byte: start_byte, old_end_byte: start_byte + old_text.bytesize, new_end_byte: start_byte + new_text.bytesize)
+      assert_equal RBS::Parser.lex_packed(new_content).bytes, relexed.bytes, "#{old_text.inspect} => #{new_text.inspect}"
+
+      content = new_content
+      tokens = relexed
+    end
+
+    # The unterminated annotation reads the rest of the input, so closing it lexes again from its line.
+    relexed = RBS::Parser.relex(tokens, content + "}", start_byte: content.bytesize, old_end_byte: content.bytesize, new_end_byte: content.bytesize + 1)
+    assert_equal RBS::Parser.lex_packed(content + "}").bytes, relexed.bytes
+    assert_includes relexed.types[relexed.relexed || raise], :tANNOTATION
+
+    # An edit on one line lexes that line only.
+    relexed = RBS::Parser.relex(RBS::Parser.lex_packed("class A\nclass B\nclass C\n"), "class A\nclass BB\nclass C\n", start_byte: 14, old_end_byte: 14, new_end_byte: 15)
+    assert_equal 4...8, relexed.relexed
+    assert_equal [:tUIDENT, "BB"], [relexed.type(6), relexed[6].value]
+
+    assert_raises(ArgumentError) do
+      RBS::Parser.relex(tokens, "class A", start_byte: 3, old_end_byte: 3, new_end_byte: 10)
+    end
+  end
+
+  def test_relex_broken_tokens
+    tokens = RBS::Parser.lex_packed("class Foo\nend\n")
+    edit = { start_byte: 6, old_end_byte: 9, new_end_byte: 9 }
+
+    # The tokens of a longer input.
+    stale = RBS::Parser.lex_packed("class Foo\n" * 100 + "end\n")
+    assert_raises(ArgumentError) do
+      RBS::Parser.relex(stale, "class Bar\nend\n", **edit)
+    end
+
+    # Positions out of the input, or out of order.
+    [
+      [0, 0, 0, 0x7fff_ffff, 0x7fff_ffff],
+      [0, 0, 0, 0xffff_fff0, 0xffff_fff0],
+      [0, 5, 5, 5, 3],
+      [0, 5, 3, 5, 5],
+    ].each do |index, start_char, end_char, start_byte, end_byte|
+      broken = tokens.bytes.dup
+      broken[index * 17 + 1, 16] = [start_char, end_char, start_byte, end_byte].pack("L<4")
+      assert_raises(ArgumentError) do
+        RBS::Parser.relex(RBS::Parser::PackedTokens.new(buffer: tokens.buffer, bytes: broken), "class Bar\nend\n", **edit)
+      end
+    end
+
+    # The edit ends past the old input.
+    assert_raises(ArgumentError) do
+      RBS::Parser.relex(tokens, "class Foo\nend\n" + "x" * 100, start_byte: 6, old_end_byte: 100, new_end_byte: 114)
+    end
+  end
+
+  def test_incremental_signature
+    content = <<~RBS
+      use Foo::Bar
+
+      class A
+        def a: () -> void
+      end
+
+      # B
+      class B
+        def b: () -> void
+      end
+
+      type c = Integer
+
+      module D
+        def d: () -> void # 🐈
+      end
+    RBS
+
+    signature = RBS::Parser::IncrementalSignature.new(false)
+    signature.parse(RBS::Buffer.new(content: content, name: Pathname("a.rbs")))
+
+    [
+      ["def b", "def bb"],
+      ["# B\n", ""],
+      ["Integer\n", "Integer\n  | String\n"],
+      ["A\n", "A\n  %a{a}\n"],
+      ["void # 🐈", "void # `🐈`"],
+      ["end\n\ntype", "end\nX: Integer\ntype"],
+    ].each do |old_text, new_text|
+      start_byte = content.b.index(old_text.b) or raise
+      new_content = content.byteslice(0, start_byte) + new_text + content.byteslice(start_byte + old_text.bytesize..)
+
+      dirs, decls = signature.update(
+        buffer = RBS::Buffer.new(content: new_content, name: Pathname("a.rbs")),
+        start_byte,
+        start_byte + old_text.bytesize,
+        start_byte + new_text.bytesize
+      )
+      expected_dirs, expected_decls = RBS::Parser._parse_signature(buffer, 0, new_content.bytesize, false)
+
+      assert_equal expected_dirs.map { _1.location&.range }, dirs.map { _1.location&.range }, "#{old_text.inspect} => #{new_text.inspect}"
+      assert_equal expected_decls.to_json, decls.to_json, "#{old_text.inspect} => #{new_text.inspect}"
+
+      content = new_content
+    end
+
+    assert_raises ArgumentError do
+      signature.update(RBS::Buffer.new(content: "class B end\n", name: Pathname("a.rbs")), 0, 0, 0)
+    end
+  end
+
+  def test_incremental_signature_syntax_error
+    signature = RBS::Parser::IncrementalSignature.new(false)
+
+    assert_raises ArgumentError do
+      signature.update(RBS::Buffer.new(content: "class A end\n", name: Pathname("a.rbs")), 0, 0, 0)
+    end
+
+    signature.parse(RBS::Buffer.new(content: "class A end\nclass B end\nclass C end\n", name: Pathname("a.rbs")))
+
+    assert_raises RBS::ParsingError do
+      signature.update(RBS::Buffer.new(content: "class A end\nclass B end\nclass C\n", name: Pathname("a.rbs")), 31, 35, 31)
+    end
+
+    # The edit after a syntax error is an edit of the input with the error.
+    _, decls = signature.update(RBS::Buffer.new(content: "class A end\nclass B end\nclass C end\n", name: Pathname("a.rbs")), 31, 31, 35)
+    assert_equal ["A", "B", "C"], decls.map { _1.name.to_s }
+  end
+
+  def test_incremental_signature_many_edits
+    content = +""
+    signature = RBS::Parser::IncrementalSignature.new(false)
+    signature.parse(RBS::Buffer.new(content: content, name: Pathname("a.rbs")))
+    decls = nil
+
+    # The arena is rebuilt from time to time, which gives the same result as the incremental parses.
+    200.times do |i|
+      text = "class C#{i}\n  def m: () -> void\nend\n"
+      start_byte = content.bytesize
+      content = content + text
+
+      _, decls = signature.update(RBS::Buffer.new(content: content, name: Pathname("a.rbs")), start_byte, start_byte, start_byte + text.bytesize)
+      assert_equal i + 1, decls.size
+    end
+
+    _, expected = RBS::Parser._parse_signature(RBS::Buffer.new(content: content, name: Pathname("a.rbs")), 0, content.bytesize, false)
+    assert_equal expected.to_json, decls.to_json
+  end
+
   def test__lex_comment_with_bare_cr
     content = "# Comment\rclass Foo"
     tokens = RBS::Parser.lex(content).value
@@ -1072,6 +1277,30 @@ class RBS::ParserTest < Test::Unit::TestCase
     assert_equal content, tokens.first.location.source
   end
 
+  def test__lex_words_and_comments
+    content = "class-alias class-foo module-self def! to= _ _1 _Foo __todo__ fooあ#{" " * 40}# #{"コメント" * 10} #{"x" * 40}"
+    tokens = RBS::Parser.lex(content).value.reject { _1.type == :tTRIVIA }
+
+    assert_equal(
+      [
+        [:kCLASSALIAS, "class-alias"],
+        [:kCLASS, "class"], [:tOPERATOR, "-"], [:tLIDENT, "foo"],
+        [:kMODULESELF, "module-self"],
+        [:tBANGIDENT, "def!"],
+        [:tEQIDENT, "to="],
+        [:tULLIDENT, "_"],
+        [:tULLIDENT, "_1"],
+        [:tULIDENT, "_Foo"],
+        [:k__TODO__, "__todo__"],
+        [:tLIDENT, "fooあ"],
+        [:tCOMMENT, "# #{"コメント" * 10} #{"x" * 40}"],
+        [:pEOF, ""]
+      ],
+      tokens.map { [_1.type, _1.location.source] }
+    )
+    assert_equal content.size, tokens.last.location.start_column
+  end
+
   def test_invalid_position_range_raises
     # Regression: start_pos > end_pos used to cause an infinite loop in the lexer.
     assert_raises(ArgumentError) do
@@ -1087,6 +1316,18 @@ class RBS::ParserTest < Test::Unit::TestCase
     end
   end
 
+  def test_byte_range_past_the_end_of_buffer
+    # Regression: the lexer scanned the input up to the end of the range, past the end of the string.
+    # Long enough for the content not to be embedded in the String object.
+    source = "Array[#{(["Integer"] * 200).join(" | ")}]"
+    type = RBS::Parser.parse_type(source, byte_range: 0...(source.bytesize + 4096))
+    assert_equal source, type.to_s
+
+    source = "class Foo\n  def foo: () -> \"文字列\"\nend\n"
+    _, decls = RBS::Parser._parse_signature(buffer(source), 0, source.bytesize + 4096, false)
+    assert_equal [RBS::TypeName.parse("Foo")], decls.map(&:name)
+  end
+
   def test_invalid_utf8_byte_in_comment_does_not_hang
     omit_on_truffle_ruby! "The C extension does not raise `RBS::ParsingError` for an invalid UTF-8 byte on TruffleRuby"
 
@@ -1229,4 +1470,391 @@ class RBS::ParserTest < Test::Unit::TestCase
     assert_equal 1, decls.size
     assert_instance_of RBS::AST::Declarations::TypeAlias, decls[0]
   end
+
+  def test_parse_signatures
+    sources = 20.times.map do |i|
+      <<~RBS
+        # resolve-type-names: false
+
+        class Foo#{i}
+          def foo: () -> Bar#{i}
+        end
+      RBS
+    end
+    sources << "# \u{3042}\ntype x = \"\u{3042}\"\n"
+
+    expected = sources.map { |source| RBS::Parser.parse_signature(source) }
+
+    [1, 4].each do |threads|
+      results = RBS::Parser.parse_signatures(sources, threads: threads)
+
+      assert_equal expected.size, results.size
+      expected.zip(results) do |(_, expected_dirs, expected_decls), (buf, dirs, decls)|
+        assert_equal expected_dirs.map(&:class), dirs.map(&:class)
+        assert_equal expected_dirs.map { _1.location.range }, dirs.map { _1.location.range }
+        assert_equal expected_decls, decls
+        assert_equal expected_decls.map(&:location).map(&:range), decls.map(&:location).map(&:range)
+        assert_same buf, decls[0].location.buffer
+      end
+    end
+  end
+
+  def test_parse_signature_with_errors
+    _, dirs, decls, errors = RBS::Parser.parse_signature_with_errors(<<~RBS)
+      use Foo::
+
+      class A
+        def a: () ->
+        def b: () -> void
+        attr_reader c Integer
+      end
+
+      interface _I
+        def self.i: () -> void
+        def j: () -> void
+      end
+
+      class B <
+      end
+
+      type t = Integer
+    RBS
+
+    assert_empty dirs
+    assert_equal ["A", "_I", "t"], decls.map { _1.name.to_s }
+    assert_equal [:b], decls[0].members.map(&:name)
+    assert_equal [:j], decls[1].members.map(&:name)
+
+    assert_equal [
+      [3, "use clause is expected"],
+      [5, "unexpected token for simple type"],
+      [6, "expected a token `pCOLON`"],
+      [10, "expected a token `pCOLON`"],
+      [15, "expected one of class/module/constant name"],
+    ], errors.map { [_1.location.start_line, _1.error_message] }
+
+    _, _, decls, errors = RBS::Parser.parse_signature_with_errors("class A\n  def a: () -> void\n")
+    assert_equal [:a], decls[0].members.map(&:name)
+    assert_equal ["unexpected token for class/module declaration member"], errors.map(&:error_message)
+
+    _, _, decls, errors = RBS::Parser.parse_signature_with_errors("class A end\n")
+    assert_equal 1, decls.size
+    assert_empty errors
+  end
+
+  def test_parse_signature_with_errors_first_error
+    [
+      "class C en",
+      "class A\n  def a: () -> void\n",
+      "module M\n  class A\n    def a: () -> void\n",
+      "interface _I\n  def a: () -> void\n",
+      "class A\n  def a: () ->\n",
+      "class A\n  def a: (\nend\nclass B\n",
+      "type t = Integer\nclass A < B[\n",
+    ].each do |source|
+      error = assert_raises(RBS::ParsingError) { RBS::Parser.parse_signature(source) }
+      _, _, _, errors = RBS::Parser.parse_signature_with_errors(source)
+
+      assert_equal [error.message, error.location.range], [errors[0].message, errors[0].location.range], source
+    end
+
+    _, _, _, errors = RBS::Parser.parse_signature_with_errors("class C en")
+    assert_equal 1, errors.size
+  end
+
+  def test_parse_signature_with_errors_internal_error
+    source = <<~RBS
+      class A
+        def a: () -> untypedf self.b: () -> void
+        def c: () -> void
+      end
+    RBS
+
+    assert_raises(RuntimeError) { RBS::Parser.parse_signature(source) }
+
+    _, _, decls, errors = RBS::Parser.parse_signature_with_errors(source)
+    assert_equal [:a, :c], decls[0].members.map(&:name)
+    assert_equal [[2, "Unexpected error"]], errors.map { [_1.location.start_line, _1.error_message] }
+  end
+
+  def test_parse_signatures_empty
+    assert_equal [], RBS::Parser.parse_signatures([])
+  end
+
+  def test_parse_signatures_error
+    sources = ["class Foo end", "class Bar < end", "class Baz end"]
+
+    yielded = []
+    error = assert_raises(RBS::ParsingError) do
+      RBS::Parser.parse_signatures(sources, threads: 2) do |buf, _, _|
+        yielded << buf.content
+      end
+    end
+
+    assert_equal ["class Foo end"], yielded
+    assert_equal "class Bar < end", error.location.buffer.content
+  end
+
+  def test_parse_signatures_lazy_overloads
+    source = <<~RBS
+      # \u{3042}
+      class A[T]
+        def foo: [X] (T, X) -> "\u{3042}" | ...
+        def self.bar: () -> A[untyped]
+        def baz: ...
+        def self?.qux: %a{pure} () -> void
+                     | () { (T) -> void } -> bool
+      end
+    RBS
+
+    _, _, decls = RBS::Parser.parse_signature(source)
+    _, _, lazy_decls = RBS::Parser.parse_signatures([source], lazy_overloads: true)[0]
+
+    foo, bar, baz, qux = lazy_decls[0].members
+
+    assert_instance_of RBS::AST::Members::MethodDefinition::LazyOverloads, foo.instance_variable_get(:@overloads)
+    assert_equal [:T], foo.instance_variable_get(:@overloads).variables
+    assert_equal [], bar.instance_variable_get(:@overloads).variables
+    assert_equal [], baz.overloads
+    assert_predicate baz, :overloading?
+
+    decls[0].members.zip([foo, bar, baz, qux]) do |expected, member|
+      assert_equal expected.to_json, member.to_json
+    end
+  end
+
+  def test_parse_signatures_lazy_overloads_syntax_error
+    source = "class A[T]\n  def foo: () -> Array[T T]\nend\n"
+
+    # The syntax error is reported when parsing, as without the option.
+    expected = assert_raises(RBS::ParsingError) { RBS::Parser.parse_signature(source) }
+    error = assert_raises(RBS::ParsingError) { RBS::Parser.parse_signatures([source], lazy_overloads: true) }
+    assert_equal expected.message, error.message
+  end
+
+  def test_parse_signatures_lazy_overloads_frozen
+    _, _, decls = RBS::Parser.parse_signatures(["class A\n  def foo: () -> void\n  def bar: () -> void\nend\n"], lazy_overloads: true)[0]
+    foo, bar = decls[0].members
+
+    # `#freeze` parses the overloads, so that the frozen definition keeps them.
+    foo.freeze
+    assert_instance_of Array, foo.instance_variable_get(:@overloads)
+    assert_equal "() -> void", foo.overloads[0].method_type.to_s
+
+    # A definition frozen without `#freeze` parses them on each call.
+    Kernel.instance_method(:freeze).bind_call(bar)
+    assert_instance_of RBS::AST::Members::MethodDefinition::LazyOverloads, bar.instance_variable_get(:@overloads)
+    assert_equal "() -> void", bar.overloads[0].method_type.to_s
+  end
+
+  def test_parse_signature_skeleton
+    source = <<~RBS
+      class A[T < Comparable[T]] < Base[T]
+        include Enumerable[T]
+
+        attr_reader name: String | Symbol
+        @items: Array[[T, ^(T) -> void]]
+        def each: () { (T) -> void } -> void
+      end
+
+      type a = { name: String, size: Integer? }
+      B: singleton(A)
+      $c: Integer & _ToS
+    RBS
+
+    _, _, decls = RBS::Parser.parse_signature(source)
+    _, _, skeleton = RBS::Parser.parse_signature_skeleton(source)
+
+    a, alias_decl, constant, global = skeleton
+
+    assert_equal decls[0].type_params, a.type_params
+    assert_equal decls[0].super_class, a.super_class
+    assert_equal decls[0].members[0], a.members[0]
+
+    [
+      [decls[0].members[1].type, a.members[1].type],
+      [decls[0].members[2].type, a.members[2].type],
+      [decls[1].type, alias_decl.type],
+      [decls[2].type, constant.type],
+      [decls[3].type, global.type]
+    ].each do |type, skipped|
+      assert_instance_of RBS::Types::Bases::Any, skipped
+      assert_equal type.location.source, skipped.location.source
+    end
+
+    assert_instance_of RBS::AST::Members::MethodDefinition::LazyOverloads, a.members[3].instance_variable_get(:@overloads)
+    assert_equal decls[0].members[3], a.members[3]
+
+    assert_raises RBS::ParsingError do
+      RBS::Parser.parse_signature_skeleton("class A\n  attr_reader name: (String\nend\n")
+    end
+  end
+
+  def test_parse_signatures_invalid_range
+    assert_raises ArgumentError do
+      RBS::Parser._parse_signatures([buffer("class Foo end")], [100], [10], false, false, 1)
+    end
+
+    assert_raises ArgumentError do
+      RBS::Parser._parse_signatures([buffer("class Foo end")], [0], [], false, false, 1)
+    end
+  end
+
+  def test_parse_signatures_interrupt
+    content = File.read(File.expand_path("../../core/array.rbs", __dir__))
+    buffers = Array.new(800) { buffer(content) }
+    interrupt = Class.new(StandardError)
+
+    thread = Thread.new do
+      Thread.current.report_on_exception = false
+      RBS::Parser._parse_signatures(buffers, [0] * buffers.size, [content.bytesize] * buffers.size, false, false, 1)
+    end
+    sleep 0.3
+
+    # The workers stop between files, instead of parsing the rest of the batch first.
+    started_at = Process.clock_gettime(Process::CLOCK_MONOTONIC)
+    thread.raise(interrupt)
+    assert_raises(interrupt) { thread.join }
+    assert_operator Process.clock_gettime(Process::CLOCK_MONOTONIC) - started_at, :<, 0.25
+
+    assert_equal 1, RBS::Parser._parse_signatures([buffer("class Foo end")], [0], [13], false, false, 2).size
+  end
+
+  def test_parse_reuses_arena
+    # The parsers of a thread share an arena, which has to be given back after errors too.
+    100.times do |i|
+      assert_equal "Array[T#{i}]", RBS::Parser.parse_type("Array[T#{i}]", variables: [:"T#{i}"]).to_s
+
+      assert_raises RBS::ParsingError do
+        RBS::Parser.parse_type("Array[")
+      end
+
+      assert_raises TypeError do
+        RBS::Parser.parse_type("bool", variables: [1])
+      end
+
+      assert_raises ArgumentError do
+        RBS::Parser.parse_type("é", byte_range: 1...2)
+      end
+    end
+
+    _, _, decls = RBS::Parser.parse_signature("class Foo\n#{"  def foo: () -> Integer\n" * 5_000}end")
+    assert_equal 5_000, decls[0].members.size
+
+    assert_equal "Integer", RBS::Parser.parse_type("Integer").to_s
+  end
+
+  def test_parse_large_comments
+    # Comment buffers grow in place at the end of the arena, and are followed by the allocations of the next declaration.
+    lines = 3_000.times.map { |i| "line #{i} #{"x" * (i % 50)}" }
+    source = 3.times.map { |i| lines.map { "# #{_1}\n" }.join + "class Foo#{i}\nend\n" }.join
+
+    _, _, decls = RBS::Parser.parse_signature(source)
+
+    assert_equal 3, decls.size
+    decls.each_with_index do |decl, i|
+      assert_equal RBS::TypeName.parse("Foo#{i}"), decl.name
+      assert_equal lines.map { "#{_1}\n" }.join, decl.comment.string
+    end
+  end
+
+  def test_last_parse_stats
+    Thread.new do
+      assert_nil RBS::Parser.last_parse_stats
+
+      RBS::Parser.parse_type("Integer")
+      small = RBS::Parser.last_parse_stats
+
+      RBS::Parser.parse_signature("class Foo\n#{"  def foo: (String) -> Integer\n" * 1_000}end")
+      large = RBS::Parser.last_parse_stats
+
+      [small, large].each do |stats|
+        assert_operator stats[:requested_bytes], :>, 0
+        assert_equal stats[:requested_bytes] + stats[:alignment_bytes] + stats[:abandoned_bytes], stats[:used_bytes]
+        assert_operator stats[:used_bytes] + stats[:slack_bytes], :<=, stats[:capacity_bytes]
+        assert_operator stats[:page_count], :>=, 1
+      end
+
+      # Node lists leave their arrays behind as they grow, which is a little of the arena.
+      assert_equal 0, small[:abandoned_bytes]
+      assert_operator large[:abandoned_bytes], :<, large[:requested_bytes] / 100
+
+      assert_operator large[:requested_bytes], :>, small[:requested_bytes] * 100
+    end.join
+  end
+
+  def test_last_parse_stats_after_large_parse
+    Thread.new do
+      RBS::Parser.parse_signature("class Foo\n#{"  def foo: () -> Integer\n" * 20_000}end")
+
+      # The pages grow from one system page again, instead of the largest page size the previous parse has reached.
+      RBS::Parser.parse_signature("class Foo\n#{"  def foo: () -> Integer\n" * 400}end")
+      stats = RBS::Parser.last_parse_stats
+
+      page_size = defined?(Etc::SC_PAGESIZE) ? Etc.sysconf(Etc::SC_PAGESIZE) : 4096
+      assert_operator stats[:capacity_bytes] - stats[:used_bytes], :<, 32 * page_size
+    end.join
+  end
+
+  def test_parse_with_overwritten_arena_variable
+    Thread.new do
+      [1, "arena", Object.new].each do |value|
+        Thread.current[:__rbs_parser_arena__] = value
+        assert_nil RBS::Parser.last_parse_stats
+
+        assert_equal "Array[Integer]", RBS::Parser.parse_type("Array[Integer]").to_s
+        assert_operator RBS::Parser.last_parse_stats[:requested_bytes], :>, 0
+      end
+    end.join
+  end
+
+  def test_parse_reuses_arena_in_threads
+    types = 4.times.map do |i|
+      Thread.new do
+        100.times.map { RBS::Parser.parse_type("Array[Integer#{i}]").to_s }.uniq
+      end
+    end.map(&:value)
+
+    assert_equal 4.times.map { |i| ["Array[Integer#{i}]"] }, types
+  end
+
+  def test_parse_symbols_in_threads
+    names = 4.times.map do |i|
+      Thread.new do
+        _, _, decls = RBS::Parser.parse_signature(<<~RBS)
+          class Foo
+            #{2000.times.map { |j| "def m#{i}_#{j}: [T#{j}] () -> :s#{j}" }.join("\n")}
+          end
+        RBS
+
+        decls[0].members.map do |member|
+          [member.name, member.overloads[0].method_type.type_params[0].name, member.overloads[0].method_type.type.return_type.literal]
+        end
+      end
+    end.map(&:value)
+
+    4.times do |i|
+      assert_equal 2000.times.map { |j| [:"m#{i}_#{j}", :"T#{j}", :"s#{j}"] }, names[i]
+    end
+  end
+
+  def test_parse_symbols_in_encodings
+    utf8 = RBS::Parser.parse_type(RBS::Buffer.new(name: "a.rbs", content: ":\u{3042}"))
+    euc = RBS::Parser.parse_type(RBS::Buffer.new(name: "a.rbs", content: ":\u{3042}".encode(Encoding::EUC_JP)))
+
+    assert_equal Encoding::UTF_8, utf8.literal.encoding
+    assert_equal Encoding::EUC_JP, euc.literal.encoding
+    assert_equal :"\u{3042}", utf8.literal
+    assert_equal :"\u{3042}".to_s.encode(Encoding::EUC_JP).to_sym, euc.literal
+
+    # `to_s` and `T` are seeded in the constant pools, and `to_t` and `S` are not
+    [Encoding::UTF_8, Encoding::EUC_JP, Encoding::ASCII_8BIT].each do |encoding|
+      _, _, decls = RBS::Parser.parse_signature(RBS::Buffer.new(name: "a.rbs", content: "class Foo[T, S]\n  def to_s: () -> :to_s\n  def to_t: () -> :to_t\nend\n".encode(encoding)))
+      foo = decls[0]
+
+      assert_equal [:T, :S], foo.type_params.map(&:name)
+      assert_equal [:to_s, :to_t], foo.members.map(&:name)
+      assert_equal [:to_s, :to_t], foo.members.map { _1.overloads[0].method_type.type.return_type.literal }
+    end
+  end
 end
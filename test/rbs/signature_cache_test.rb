@@ -0,0 +1,119 @@
+require "test_helper"
+
+class RBS::SignatureCacheTest < Test::Unit::TestCase
+  include TestHelper
+
+  SignatureCache = RBS::SignatureCache
+
+  def mktmpdir
+    Dir.mktmpdir do |path|
+      yield Pathname(path)
+    end
+  end
+
+  def buffer(content)
+    RBS::Buffer.new(name: Pathname("a.rbs"), content: content)
+  end
+
+  def test_parse_signature
+    mktmpdir do |path|
+      cache = SignatureCache.new(path)
+      content = <<~RBS
+        # resolve-type-names: false
+
+        use Foo::Bar
+
+        # A person
+        class Person[T] < Object
+          def name: () -> String
+        end
+      RBS
+
+      _, expected_dirs, expected_decls = RBS::Parser.parse_signature(content)
+
+      2.times do
+        buf = buffer(content)
+        returned_buffer, dirs, decls = cache.parse_signature(buf)
+
+        assert_same buf, returned_buffer
+        assert_equal expected_dirs.map(&:class), dirs.map(&:class)
+        assert_equal expected_decls, decls
+        assert_equal expected_decls[0].location.range, decls[0].location.range
+        assert_equal "A person\n", decls[0].comment.string
+        assert_same buf, decls[0].location.buffer
+      end
+
+      start_pos = content.index("false") + "false".size
+      assert_equal [cache.entry_path(buffer(content), start_pos)], path.glob("**/*").select(&:file?)
+    end
+  end
+
+  def test_parse_signature_keyed_by_content
+    mktmpdir do |path|
+      cache = SignatureCache.new(path)
+
+      _, _, decls1 = cache.parse_signature(buffer("class Foo end"))
+      _, _, decls2 = cache.parse_signature(buffer("class Bar end"))
+
+      assert_equal RBS::TypeName.parse("Foo"), decls1[0].name
+      assert_equal RBS::TypeName.parse("Bar"), decls2[0].name
+      assert_equal 2, path.glob("**/*").count(&:file?)
+    end
+  end
+
+  def test_parse_signature_syntax_error
+    mktmpdir do |path|
+      cache = SignatureCache.new(path)
+
+      assert_raises RBS::ParsingError do
+        cache.parse_signature(buffer("class Foo <"))
+      end
+
+      assert_equal 0, path.glob("**/*").count(&:file?)
+    end
+  end
+
+  def test_parse_signature_broken_entry
+    mktmpdir do |path|
+      cache = SignatureCache.new(path)
+      buf = buffer("class Foo end")
+
+      entry = cache.entry_path(buf, 0)
+      entry.dirname.mkpath
+      entry.binwrite("\xff\xff".b)
+
+      _, _, decls = cache.parse_signature(buf)
+      assert_equal RBS::TypeName.parse("Foo"), decls[0].name
+      assert_equal RBS::Parser._parse_signature_to_bytes(buf, 0, buf.content.bytesize, false), entry.binread.byteslice(4..)
+    end
+  end
+
+  def test_parse_signature_corrupted_entry
+    mktmpdir do |path|
+      cache = SignatureCache.new(path)
+      buf = buffer("class Foo\n  def foo: (Bar) -> Baz\nend\n")
+      cache.parse_signature(buf)
+
+      entry = cache.entry_path(buf, 0)
+      bytes = entry.binread
+
+      # A flipped byte is detected by the checksum, even if the rest still decodes.
+      (0...bytes.bytesize).each do |i|
+        broken = bytes.dup
+        broken.setbyte(i, broken.getbyte(i) ^ 0x20)
+        entry.binwrite(broken)
+
+        _, _, decls = cache.parse_signature(buffer(buf.content))
+        assert_equal "foo", decls[0].members[0].name.to_s
+        assert_equal "(Bar) -> Baz", decls[0].members[0].overloads[0].method_type.to_s
+      end
+
+      # An entry with a matching checksum, but a name that is not valid in the encoding of the buffer
+      payload = bytes.byteslice(4..).sub("Bar", "B\xffr".b)
+      entry.binwrite([Zlib.crc32(payload)].pack("V") + payload)
+
+      _, _, decls = cache.parse_signature(buffer(buf.content))
+      assert_equal "(Bar) -> Baz", decls[0].members[0].overloads[0].method_type.to_s
+    end
+  end
+end
@@ -784,6 +784,29 @@ class RBS::TypeParsingTest < Test::Unit::TestCase
     end
   end
 
+  def test_record_many_keys
+    keys = (1..40).map { "k#{_1}" }
+
+    Parser.parse_type("{ #{keys.map { "#{_1}: Integer" }.join(", ")}, \"k1\" => String, 1 => bool }").tap do |type|
+      assert_instance_of Types::Record, type
+      assert_equal [*keys.map(&:to_sym), "k1", 1], type.fields.keys
+    end
+
+    assert_raises(RBS::ParsingError) do
+      Parser.parse_type("{ #{keys.map { "#{_1}: Integer" }.join(", ")}, ?k33: String }")
+    end.tap do |error|
+      assert_equal "k33", error.location.source
+      assert_match(/duplicated record key/, error.message)
+    end
+
+    assert_raises(RBS::ParsingError) do
+      Parser.parse_type("{ #{keys.map { "#{_1}: Integer" }.join(", ")}, 'k40' => String, \"k40\" => String }")
+    end.tap do |error|
+      assert_equal '"k40"', error.location.source
+      assert_match(/duplicated record key/, error.message)
+    end
+  end
+
   def test_type_var
     Parser.parse_type("Array[A]", variables: []).yield_self do |type|
       assert_instance_of Types::ClassInstance, type
@@ -73,6 +73,15 @@ module RBS
         assert_equal :pEOF, types.last
       end
 
+      def test_last_parse_stats
+        RBS::Parser.parse_signature("class Foo\n  def foo: () -> Integer\nend\n")
+        stats = RBS::Parser.last_parse_stats
+
+        assert_operator stats[:requested_bytes], :>, 0
+        assert_equal stats[:requested_bytes] + stats[:alignment_bytes], stats[:used_bytes]
+        assert_operator stats[:used_bytes], :<=, stats[:capacity_bytes]
+      end
+
       def test_parse_error_raises_parsing_error
         error = assert_raises(RBS::ParsingError) do
           RBS::Parser.parse_signature("class 123 Broken end")
@@ -30,6 +30,10 @@ class RBS::WASM::SerializationTest < Test::Unit::TestCase
 
     diff = ast_diff([directives, decls], actual)
     assert_nil diff, "round-trip mismatch in #{buf.name}: #{diff}"
+
+    # The C decoder (src/deserialize.c) must rebuild the same objects.
+    diff = ast_diff([directives, decls], RBS::Parser._deserialize_signature(buf, bytes))
+    assert_nil diff, "C round-trip mismatch in #{buf.name}: #{diff}"
   end
 
   def test_signature_round_trip_for_bundled_rbs
@@ -82,6 +86,31 @@ class RBS::WASM::SerializationTest < Test::Unit::TestCase
     sources.each { |source| assert_round_trips(buffer(source)) }
   end
 
+  def test_deserialize_broken_signature
+    buf = buffer("class Foo[A] < Bar[A]\n  def foo: () -> A\nend\n")
+    bytes = RBS::Parser._parse_signature_to_bytes(buf, 0, buf.content.bytesize, false)
+
+    [
+      "",
+      bytes.byteslice(0, bytes.bytesize - 1),
+      bytes + "\0",
+      "\xff".b + bytes.byteslice(1..),
+    ].each do |broken|
+      assert_raises ArgumentError do
+        RBS::Parser._deserialize_signature(buf, broken)
+      end
+    end
+  end
+
+  def test_constant_table
+    buf = buffer("class Foo\n  def foo: (Foo) -> Foo\n  def bar: (Foo) -> Foo\nend\n")
+    bytes = RBS::Parser._parse_signature_to_bytes(buf, 0, buf.content.bytesize, false)
+
+    # Each name is written once, however many times it is referred to.
+    assert_equal 1, bytes.scan("Foo".b).size
+    assert_round_trips(buf)
+  end
+
   def test_type_round_trip
     types = [
       "Integer", "::Foo::Bar::Baz", "Array[Integer]", "Integer | String | nil",
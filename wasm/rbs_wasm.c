@@ -90,6 +90,20 @@ rbs_wasm_result_len(void) {
     return result_length;
 }
 
+// The arena stats of the most recent parse, for `rbs_wasm_last_parse_stats`.
+static rbs_allocator_stats_t last_parse_stats;
+static bool has_last_parse_stats = false;
+
+static void record_parse_stats(rbs_allocator_t *allocator) {
+    last_parse_stats = rbs_allocator_stats(allocator);
+    has_last_parse_stats = true;
+}
+
+static void free_parser(rbs_parser_t *parser) {
+    record_parse_stats(parser->allocator);
+    rbs_parser_free(parser);
+}
+
 // Encode the parser's error into the result buffer:
 //
 //   [i32 start_char][i32 end_char][u8 syntax_error]
@@ -126,10 +140,22 @@ static int set_error_result(rbs_parser_t *parser) {
     return RBS_WASM_PARSE_ERROR;
 }
 
+// Serialize straight into the result buffer, which is sized by a first pass over the tree.
 static int set_serialized_result(rbs_parser_t *parser, rbs_node_t *node) {
-    rbs_string_t bytes = rbs_serialize_node(parser->allocator, &parser->constant_pool, node);
-    size_t length = rbs_string_len(bytes);
-    memcpy(allocate_result(length), bytes.start, length);
+    rbs_serializer_t serializer;
+    rbs_serializer_init(&serializer, parser->allocator, &parser->constant_pool);
+
+    size_t length = rbs_serializer_measure_node(&serializer, node);
+    rbs_serializer_write_node(&serializer, node, allocate_result(length));
+    return RBS_WASM_OK;
+}
+
+static int set_serialized_list_result(rbs_parser_t *parser, rbs_node_list_t *list) {
+    rbs_serializer_t serializer;
+    rbs_serializer_init(&serializer, parser->allocator, &parser->constant_pool);
+
+    size_t length = rbs_serializer_measure_node_list(&serializer, list);
+    rbs_serializer_write_node_list(&serializer, list, allocate_result(length));
     return RBS_WASM_OK;
 }
 
@@ -185,19 +211,7 @@ static void declare_variables(rbs_parser_t *parser, const char *variables, int v
     }
 }
 
-/**
- * Parse an RBS signature from a source buffer.
- *
- * `source`/`length` is the whole buffer content; `encoding`/`encoding_length` is
- * its Ruby encoding name; `start_pos`/`end_pos` are the character range within it
- * to parse, so reported locations are absolute (this mirrors
- * RBS::Parser._parse_signature).
- *
- * @return RBS_WASM_OK on success (result is the serialized AST),
- *         RBS_WASM_PARSE_ERROR on a parse error (result is an error blob), or
- *         a negative status for a range the parser will not take.
- */
-__attribute__((export_name("rbs_wasm_parse_signature"))) int rbs_wasm_parse_signature(const char *source, int length, const char *encoding, int encoding_length, int start_pos, int end_pos) {
+static int parse_signature(const char *source, int length, const char *encoding, int encoding_length, int start_pos, int end_pos, bool skeleton) {
     if (!range_is_valid(start_pos, end_pos)) {
         allocate_result(0);
         return RBS_WASM_INVALID_RANGE;
@@ -211,7 +225,11 @@ __attribute__((export_name("rbs_wasm_parse_signature"))) int rbs_wasm_parse_sign
     }
 
     rbs_signature_t *signature = NULL;
-    rbs_parse_signature(parser, &signature);
+    if (skeleton) {
+        rbs_parse_signature_skeleton(parser, &signature);
+    } else {
+        rbs_parse_signature(parser, &signature);
+    }
 
     int status;
     if (parser->error == NULL) {
@@ -220,10 +238,35 @@ __attribute__((export_name("rbs_wasm_parse_signature"))) int rbs_wasm_parse_sign
         status = set_error_result(parser);
     }
 
-    rbs_parser_free(parser);
+    free_parser(parser);
     return status;
 }
 
+/**
+ * Parse an RBS signature from a source buffer.
+ *
+ * `source`/`length` is the whole buffer content; `encoding`/`encoding_length` is
+ * its Ruby encoding name; `start_pos`/`end_pos` are the character range within it
+ * to parse, so reported locations are absolute (this mirrors
+ * RBS::Parser._parse_signature).
+ *
+ * @return RBS_WASM_OK on success (result is the serialized AST),
+ *         RBS_WASM_PARSE_ERROR on a parse error (result is an error blob), or
+ *         a negative status for a range the parser will not take.
+ */
+__attribute__((export_name("rbs_wasm_parse_signature"))) int rbs_wasm_parse_signature(const char *source, int length, const char *encoding, int encoding_length, int start_pos, int end_pos) {
+    return parse_signature(source, length, encoding, encoding_length, start_pos, end_pos, false);
+}
+
+/**
+ * Parse an RBS signature like `rbs_wasm_parse_signature`, skipping the
+ * types of the declarations and the members (see `rbs_parse_signature_skeleton`).
+ * This mirrors RBS::Parser._parse_signature_skeleton.
+ */
+__attribute__((export_name("rbs_wasm_parse_signature_skeleton"))) int rbs_wasm_parse_signature_skeleton(const char *source, int length, const char *encoding, int encoding_length, int start_pos, int end_pos) {
+    return parse_signature(source, length, encoding, encoding_length, start_pos, end_pos, true);
+}
+
 /**
  * Parse a single RBS type.
  *
@@ -266,7 +309,7 @@ __attribute__((export_name("rbs_wasm_parse_type"))) int rbs_wasm_parse_type(cons
         status = parser->error == NULL ? set_serialized_result(parser, type) : set_error_result(parser);
     }
 
-    rbs_parser_free(parser);
+    free_parser(parser);
     return status;
 }
 
@@ -304,7 +347,48 @@ __attribute__((export_name("rbs_wasm_parse_method_type"))) int rbs_wasm_parse_me
         status = parser->error == NULL ? set_serialized_result(parser, (rbs_node_t *) method_type) : set_error_result(parser);
     }
 
-    rbs_parser_free(parser);
+    free_parser(parser);
+    return status;
+}
+
+/**
+ * Parse the overloads of a method definition that a skeleton parse skipped,
+ * mirroring RBS::Parser._parse_method_overloads. `start_char` is the character
+ * position of `start_pos`, so the parser starts there without reading the text
+ * before it. On success the result is a serialized node list.
+ *
+ * @param variables Newline-separated type variable names (length < 0 for none).
+ */
+__attribute__((export_name("rbs_wasm_parse_method_overloads"))) int rbs_wasm_parse_method_overloads(const char *source, int length, const char *encoding, int encoding_length, int start_pos, int end_pos, int start_char, const char *variables, int variables_length, int classish_allowed) {
+    if (!range_is_valid(start_pos, end_pos) || start_pos > length || start_char < 0 || start_char > start_pos) {
+        allocate_result(0);
+        return RBS_WASM_INVALID_RANGE;
+    }
+
+    rbs_string_t string = rbs_string_new(source, source + length);
+    rbs_parser_t *parser = rbs_parser_new(string, resolve_encoding(encoding, encoding_length), 0, 0);
+    rbs_parser_seek(
+        parser,
+        (rbs_lexer_checkpoint_t) {
+            .position = { .byte_pos = start_pos, .char_pos = start_char },
+            .first_token_of_line = false,
+        },
+        clamp_end_pos(end_pos, length)
+    );
+
+    declare_variables(parser, variables, variables_length);
+
+    rbs_node_list_t *overloads = NULL;
+    rbs_parse_method_overloads(parser, classish_allowed != 0, &overloads);
+
+    int status;
+    if (parser->error == NULL) {
+        status = set_serialized_list_result(parser, overloads);
+    } else {
+        status = set_error_result(parser);
+    }
+
+    free_parser(parser);
     return status;
 }
 
@@ -334,16 +418,13 @@ __attribute__((export_name("rbs_wasm_parse_type_params"))) int rbs_wasm_parse_ty
         rbs_parse_type_params(parser, module_type_params != 0, &params);
 
         if (parser->error == NULL) {
-            rbs_string_t bytes = rbs_serialize_node_list(parser->allocator, &parser->constant_pool, params);
-            size_t n = rbs_string_len(bytes);
-            memcpy(allocate_result(n), bytes.start, n);
-            status = RBS_WASM_OK;
+            status = set_serialized_list_result(parser, params);
         } else {
             status = set_error_result(parser);
         }
     }
 
-    rbs_parser_free(parser);
+    free_parser(parser);
     return status;
 }
 
@@ -376,7 +457,7 @@ static int parse_inline_annotation(const char *source, int length, const char *e
         status = set_serialized_result(parser, (rbs_node_t *) annotation);
     }
 
-    rbs_parser_free(parser);
+    free_parser(parser);
     return status;
 }
 
@@ -426,29 +507,166 @@ __attribute__((export_name("rbs_wasm_lex"))) int rbs_wasm_lex(const char *source
     // Byte 0 is always a position the lexer can start on, so this is never NULL.
     rbs_lexer_t *lexer = rbs_lexer_new(allocator, rbs_string_new(source, source + length), resolve_encoding(encoding, encoding_length), 0, clamp_end_pos(end_pos, length));
 
+    size_t count;
+    rbs_token_t *tokens = rbs_lexer_tokenize_all(lexer, &count);
+
     rbs_buffer_t buffer;
     rbs_buffer_init(allocator, &buffer);
 
-    rbs_token_t token = NullToken;
-    while (token.type != pEOF) {
-        token = rbs_lexer_next_token(lexer);
-
-        const char *type_name = rbs_token_type_str(token.type);
+    for (size_t i = 0; i < count; i++) {
+        const char *type_name = rbs_token_type_str(tokens[i].type);
         uint32_t type_name_length = (uint32_t) strlen(type_name);
         w_lex_u32(allocator, &buffer, type_name_length);
         rbs_buffer_append_string(allocator, &buffer, type_name, type_name_length);
-        w_lex_u32(allocator, &buffer, (uint32_t) token.range.start.char_pos);
-        w_lex_u32(allocator, &buffer, (uint32_t) token.range.end.char_pos);
+        w_lex_u32(allocator, &buffer, (uint32_t) tokens[i].range.start.char_pos);
+        w_lex_u32(allocator, &buffer, (uint32_t) tokens[i].range.end.char_pos);
     }
 
     rbs_string_t bytes = rbs_buffer_to_string(&buffer);
     size_t n = rbs_string_len(bytes);
     memcpy(allocate_result(n), bytes.start, n);
 
+    record_parse_stats(allocator);
+    rbs_allocator_free(allocator);
+    return RBS_WASM_OK;
+}
+
+/**
+ * Lex the source into packed tokens (see rbs_pack_tokens): a 17-byte record
+ * per token, with no leading count:
+ *
+ *   [u8 type][u32 start_char][u32 end_char][u32 start_byte][u32 end_byte]
+ *
+ * The type indexes the names of rbs_wasm_token_types. The final token is
+ * always pEOF, mirroring RBS::Parser._lex_packed.
+ *
+ * @return RBS_WASM_OK, or RBS_WASM_INVALID_RANGE for a negative `end_pos`.
+ */
+__attribute__((export_name("rbs_wasm_lex_packed"))) int rbs_wasm_lex_packed(const char *source, int length, const char *encoding, int encoding_length, int end_pos) {
+    if (!range_is_valid(0, end_pos)) {
+        allocate_result(0);
+        return RBS_WASM_INVALID_RANGE;
+    }
+
+    rbs_allocator_t *allocator = rbs_allocator_init();
+    rbs_lexer_t *lexer = rbs_lexer_new(allocator, rbs_string_new(source, source + length), resolve_encoding(encoding, encoding_length), 0, clamp_end_pos(end_pos, length));
+
+    size_t count;
+    rbs_token_t *tokens = rbs_lexer_tokenize_all(lexer, &count);
+    rbs_pack_tokens(tokens, count, (uint8_t *) allocate_result(count * RBS_PACKED_TOKEN_SIZE));
+
+    record_parse_stats(allocator);
+    rbs_allocator_free(allocator);
+    return RBS_WASM_OK;
+}
+
+/**
+ * Lex the source again after an edit, from the packed tokens of the source
+ * before the edit (see rbs_lexer_relex). The edit replaced the bytes from
+ * `start_byte` to `old_end_byte` with the bytes from `start_byte` to
+ * `new_end_byte` of the source. The result is the range of the tokens lexed
+ * again, followed by the packed tokens of the source:
+ *
+ *   [u32 relexed_start][u32 relexed_count][packed tokens...]
+ *
+ * @return RBS_WASM_OK, or RBS_WASM_INVALID_RANGE with an empty result for
+ *         an edit outside of the source or broken packed tokens.
+ */
+__attribute__((export_name("rbs_wasm_relex_packed"))) int rbs_wasm_relex_packed(const char *source, int length, const char *encoding, int encoding_length, int end_pos, const uint8_t *old_bytes, int old_length, int start_byte, int old_end_byte, int new_end_byte) {
+    end_pos = clamp_end_pos(end_pos, length);
+    size_t old_count = (size_t) (old_length > 0 ? old_length : 0) / RBS_PACKED_TOKEN_SIZE;
+
+    rbs_lexer_edit_t edit = { .start_byte = start_byte, .old_end_byte = old_end_byte, .new_end_byte = new_end_byte };
+
+    if (!range_is_valid(0, end_pos) || start_byte < 0 || start_byte > old_end_byte || start_byte > new_end_byte || new_end_byte > end_pos || old_length <= 0 || !rbs_packed_tokens_valid_p(old_bytes, (size_t) old_length, edit, end_pos)) {
+        allocate_result(0);
+        return RBS_WASM_INVALID_RANGE;
+    }
+
+    rbs_allocator_t *allocator = rbs_allocator_init();
+    rbs_lexer_t *lexer = rbs_lexer_new(allocator, rbs_string_new(source, source + length), resolve_encoding(encoding, encoding_length), 0, end_pos);
+
+    rbs_token_t *old_tokens = rbs_allocator_alloc_many(allocator, old_count, rbs_token_t);
+    rbs_unpack_tokens(old_bytes, old_count, old_tokens);
+
+    size_t count, relexed_start, relexed_count;
+    rbs_token_t *tokens = rbs_lexer_relex(lexer, old_tokens, old_count, edit, &count, &relexed_start, &relexed_count);
+
+    uint8_t *result = (uint8_t *) allocate_result(8 + count * RBS_PACKED_TOKEN_SIZE);
+    uint32_t header[2] = { (uint32_t) relexed_start, (uint32_t) relexed_count };
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 4; j++) {
+            result[i * 4 + j] = (uint8_t) ((header[i] >> (8 * j)) & 0xff);
+        }
+    }
+    rbs_pack_tokens(tokens, count, result + 8);
+
+    record_parse_stats(allocator);
     rbs_allocator_free(allocator);
     return RBS_WASM_OK;
 }
 
+/**
+ * The names of the token types, in the order of their numbers, each followed
+ * by a newline. This is RBS::Parser::TOKEN_TYPES.
+ *
+ * @return RBS_WASM_OK.
+ */
+__attribute__((export_name("rbs_wasm_token_types"))) int rbs_wasm_token_types(void) {
+    rbs_allocator_t *allocator = rbs_allocator_init();
+    rbs_buffer_t buffer;
+    rbs_buffer_init(allocator, &buffer);
+
+    for (int type = 0; type < RBS_TOKEN_TYPE_COUNT; type++) {
+        rbs_buffer_append_cstr(allocator, &buffer, rbs_token_type_str((enum RBSTokenType) type));
+        rbs_buffer_append_string(allocator, &buffer, "\n", 1);
+    }
+
+    rbs_string_t names = rbs_buffer_to_string(&buffer);
+    size_t n = rbs_string_len(names);
+    memcpy(allocate_result(n), names.start, n);
+
+    rbs_allocator_free(allocator);
+    return RBS_WASM_OK;
+}
+
+/**
+ * The arena stats of the most recent parse (see `rbs_allocator_stats`). The
+ * result is eight u32 values, in the order of `rbs_allocator_stats_t`:
+ *
+ *   [requested_bytes][alignment_bytes][abandoned_bytes][slack_bytes]
+ *   [used_bytes][capacity_bytes][page_count][large_page_count]
+ *
+ * @return RBS_WASM_OK, or RBS_WASM_PARSE_ERROR with an empty result if
+ *         nothing has been parsed yet.
+ */
+__attribute__((export_name("rbs_wasm_last_parse_stats"))) int rbs_wasm_last_parse_stats(void) {
+    if (!has_last_parse_stats) {
+        allocate_result(0);
+        return RBS_WASM_PARSE_ERROR;
+    }
+
+    size_t values[] = {
+        last_parse_stats.requested_bytes,
+        last_parse_stats.alignment_bytes,
+        last_parse_stats.abandoned_bytes,
+        last_parse_stats.slack_bytes,
+        last_parse_stats.used_bytes,
+        last_parse_stats.capacity_bytes,
+        last_parse_stats.page_count,
+        last_parse_stats.large_page_count,
+    };
+    size_t count = sizeof(values) / sizeof(values[0]);
+
+    char *p = allocate_result(count * 4);
+    for (size_t i = 0; i < count; i++) {
+        uint32_t value = (uint32_t) values[i];
+        memcpy(p + i * 4, &value, 4);
+    }
+
+    return RBS_WASM_OK;
+}
+
 /**
  * Parse a small, fixed RBS document, used as a build smoke test
  * (`wasmtime run --invoke rbs_wasm_selftest rbs_parser.wasm`).